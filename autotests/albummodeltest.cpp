@@ -118,13 +118,6 @@ private:
          {QUrl::fromLocalFile(QStringLiteral("file://image$18"))}, 3, true}
     };
 
-    QHash<QString, QUrl> mNewCovers = {
-        {QStringLiteral("album1"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("album2"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("album3"), QUrl::fromLocalFile(QStringLiteral("album3"))},
-        {QStringLiteral("album4"), QUrl::fromLocalFile(QStringLiteral("album4"))}
-    };
-
 private Q_SLOTS:
 
     void initTestCase()
@@ -142,8 +135,8 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AlbumModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AlbumModel::albumModified);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AlbumModel::albumsModified);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -159,7 +152,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 0);
         QCOMPARE(endInsertRowsSpy.count(), 0);
@@ -193,10 +186,10 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AlbumModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AlbumModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AlbumModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AlbumModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AlbumModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -212,7 +205,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 0);
         QCOMPARE(endInsertRowsSpy.count(), 0);
@@ -245,9 +238,13 @@ private Q_SLOTS:
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
         QCOMPARE(endInsertRowsSpy.count(), 1);
-        QCOMPARE(beginRemoveRowsSpy.count(), 4);
-        QCOMPARE(endRemoveRowsSpy.count(), 4);
+        QCOMPARE(beginRemoveRowsSpy.count(), 1);
+        QCOMPARE(endRemoveRowsSpy.count(), 1);
         QCOMPARE(dataChangedSpy.count(), 0);
+
+        QCOMPARE(beginRemoveRowsSpy.at(0).at(1).toInt(), 0);
+        QCOMPARE(beginRemoveRowsSpy.at(0).at(2).toInt(), 3);
+        QCOMPARE(albumsModel.rowCount(), 0);
     }
 
     void addOneTrack()
@@ -255,8 +252,8 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AlbumModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AlbumModel::albumModified);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AlbumModel::albumsModified);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -278,7 +275,7 @@ private Q_SLOTS:
             newFiles.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 0);
         QCOMPARE(endInsertRowsSpy.count(), 0);
@@ -305,7 +302,7 @@ private Q_SLOTS:
             newFiles2.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(newTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 2);
         QCOMPARE(endInsertRowsSpy.count(), 2);
@@ -313,10 +310,10 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        QCOMPARE(beginInsertRowsSpy.at(1).at(1).toInt(), 4);
-        QCOMPARE(beginInsertRowsSpy.at(1).at(2).toInt(), 4);
+        QCOMPARE(beginInsertRowsSpy.at(1).at(1).toInt(), 1);
+        QCOMPARE(beginInsertRowsSpy.at(1).at(2).toInt(), 1);
 
-        QCOMPARE(albumsModel.data(albumsModel.index(4, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track6"));
+        QCOMPARE(albumsModel.data(albumsModel.index(1, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track6"));
 
         auto secondNewTrack = MusicAudioTrack{true, QStringLiteral("$20"), QStringLiteral("0"), QStringLiteral("track5"),
                 QStringLiteral("artist2"), QStringLiteral("album1"), QStringLiteral("Various Artists"), 5, 1, QTime::fromMSecsSinceStartOfDay(20), {QUrl::fromLocalFile(QStringLiteral("/$20"))},
@@ -329,7 +326,7 @@ private Q_SLOTS:
             newFiles3.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(secondNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(secondNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 3);
         QCOMPARE(endInsertRowsSpy.count(), 3);
@@ -337,10 +334,11 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        QCOMPARE(beginInsertRowsSpy.at(2).at(1).toInt(), 4);
-        QCOMPARE(beginInsertRowsSpy.at(2).at(2).toInt(), 4);
+        QCOMPARE(beginInsertRowsSpy.at(2).at(1).toInt(), 1);
+        QCOMPARE(beginInsertRowsSpy.at(2).at(2).toInt(), 1);
 
-        QCOMPARE(albumsModel.data(albumsModel.index(4, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track5"));
+        QCOMPARE(albumsModel.data(albumsModel.index(1, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track5"));
+        QCOMPARE(albumsModel.data(albumsModel.index(2, 0), AlbumModel::TitleRole).toString(), QStringLiteral("track6"));
     }
 
     void modifyOneTrack()
@@ -348,8 +346,8 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AlbumModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AlbumModel::albumModified);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AlbumModel::albumsModified);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -371,7 +369,7 @@ private Q_SLOTS:
             newFiles.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 0);
         QCOMPARE(endInsertRowsSpy.count(), 0);
@@ -393,7 +391,7 @@ private Q_SLOTS:
             QTime::fromMSecsSinceStartOfDay(3), {QUrl::fromLocalFile(QStringLiteral("/$3"))},
             {QUrl::fromLocalFile(QStringLiteral("file://image$3"))}, 5, true};
 
-        musicDb.modifyTracksList({modifiedTrack}, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.modifyTracksList({modifiedTrack}, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
         QCOMPARE(endInsertRowsSpy.count(), 1);
@@ -406,6 +404,131 @@ private Q_SLOTS:
 
         QCOMPARE(albumsModel.data(albumsModel.index(2, 0), AlbumModel::TrackNumberRole).toInt(), 5);
     }
+
+    void diffModifiedAlbum()
+    {
+        AlbumModel albumsModel;
+
+        auto newTrack = [](qulonglong databaseId, const QString &title, int trackNumber) {
+            auto track = MusicAudioTrack{true, QStringLiteral("$%1").arg(databaseId), QStringLiteral("0"), title,
+                    QStringLiteral("artist1"), QStringLiteral("album1"), QStringLiteral("artist1"), trackNumber, 1,
+                    QTime::fromMSecsSinceStartOfDay(1), {QUrl::fromLocalFile(QStringLiteral("/$%1").arg(databaseId))},
+                    {QUrl::fromLocalFile(QStringLiteral("file://image$1"))}, 1, true};
+            track.setDatabaseId(databaseId);
+            return track;
+        };
+
+        auto album = MusicAlbum();
+        album.setValid(true);
+        album.setDatabaseId(1);
+        album.setTitle(QStringLiteral("album1"));
+        album.setTracks({newTrack(1, QStringLiteral("track1"), 1), newTrack(2, QStringLiteral("track2"), 2),
+                         newTrack(3, QStringLiteral("track3"), 3), newTrack(4, QStringLiteral("track4"), 4),
+                         newTrack(5, QStringLiteral("track5"), 5), newTrack(6, QStringLiteral("track6"), 6)});
+        album.setTracksCount(6);
+
+        albumsModel.setAlbumData(album);
+
+        QCOMPARE(albumsModel.rowCount(), 6);
+
+        QSignalSpy beginInsertRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeInserted);
+        QSignalSpy beginRemoveRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeRemoved);
+        QSignalSpy beginMoveRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeMoved);
+        QSignalSpy dataChangedSpy(&albumsModel, &AlbumModel::dataChanged);
+
+        auto modifiedAlbum = album;
+        modifiedAlbum.setTracks({newTrack(1, QStringLiteral("track1"), 1), newTrack(5, QStringLiteral("track5"), 2),
+                                 newTrack(3, QStringLiteral("track3"), 3), newTrack(4, QStringLiteral("track4"), 4),
+                                 newTrack(7, QStringLiteral("track7"), 5), newTrack(6, QStringLiteral("track6"), 6)});
+
+        albumsModel.albumModified(modifiedAlbum);
+
+        QCOMPARE(beginRemoveRowsSpy.count(), 1);
+        QCOMPARE(beginRemoveRowsSpy.at(0).at(1).toInt(), 1);
+        QCOMPARE(beginRemoveRowsSpy.at(0).at(2).toInt(), 1);
+
+        QCOMPARE(beginMoveRowsSpy.count(), 1);
+        QCOMPARE(beginMoveRowsSpy.at(0).at(1).toInt(), 3);
+        QCOMPARE(beginMoveRowsSpy.at(0).at(4).toInt(), 1);
+
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(beginInsertRowsSpy.at(0).at(1).toInt(), 4);
+        QCOMPARE(beginInsertRowsSpy.at(0).at(2).toInt(), 4);
+
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(dataChangedSpy.at(0).at(0).toModelIndex(), albumsModel.index(1, 0));
+        QCOMPARE(dataChangedSpy.at(0).at(1).toModelIndex(), albumsModel.index(1, 0));
+
+        QCOMPARE(albumsModel.rowCount(), 6);
+
+        const auto expectedTitles = QStringList{QStringLiteral("track1"), QStringLiteral("track5"), QStringLiteral("track3"),
+                QStringLiteral("track4"), QStringLiteral("track7"), QStringLiteral("track6")};
+        for (int row = 0; row < expectedTitles.size(); ++row) {
+            QCOMPARE(albumsModel.data(albumsModel.index(row, 0), AlbumModel::TitleRole).toString(), expectedTitles[row]);
+        }
+
+        QCOMPARE(albumsModel.data(albumsModel.index(1, 0), AlbumModel::TrackNumberRole).toInt(), 2);
+    }
+
+    void diffModifiedAlbumWithRenumberedTrack()
+    {
+        AlbumModel albumsModel;
+
+        auto newTrack = [](qulonglong databaseId, const QString &title, int trackNumber) {
+            auto track = MusicAudioTrack{true, QStringLiteral("$%1").arg(databaseId), QStringLiteral("0"), title,
+                    QStringLiteral("artist1"), QStringLiteral("album1"), QStringLiteral("artist1"), trackNumber, 1,
+                    QTime::fromMSecsSinceStartOfDay(1), {QUrl::fromLocalFile(QStringLiteral("/$%1").arg(databaseId))},
+                    {QUrl::fromLocalFile(QStringLiteral("file://image$1"))}, 1, true};
+            track.setDatabaseId(databaseId);
+            return track;
+        };
+
+        auto album = MusicAlbum();
+        album.setValid(true);
+        album.setDatabaseId(1);
+        album.setTitle(QStringLiteral("album1"));
+        album.setTracks({newTrack(1, QStringLiteral("track1"), 1), newTrack(2, QStringLiteral("track2"), 2),
+                         newTrack(3, QStringLiteral("track3"), 3), newTrack(4, QStringLiteral("track4"), 4)});
+        album.setTracksCount(4);
+
+        albumsModel.setAlbumData(album);
+
+        QCOMPARE(albumsModel.rowCount(), 4);
+
+        QSignalSpy beginInsertRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeInserted);
+        QSignalSpy beginRemoveRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeRemoved);
+        QSignalSpy beginMoveRowsSpy(&albumsModel, &AlbumModel::rowsAboutToBeMoved);
+        QSignalSpy dataChangedSpy(&albumsModel, &AlbumModel::dataChanged);
+
+        auto modifiedAlbum = album;
+        modifiedAlbum.setTracks({newTrack(1, QStringLiteral("track1"), 1), newTrack(2, QStringLiteral("track2"), 2),
+                                 newTrack(3, QStringLiteral("track3"), 3), newTrack(5, QStringLiteral("track5"), 5),
+                                 newTrack(4, QStringLiteral("track4"), 10)});
+        modifiedAlbum.setTracksCount(5);
+
+        albumsModel.albumModified(modifiedAlbum);
+
+        QCOMPARE(beginRemoveRowsSpy.count(), 0);
+        QCOMPARE(beginMoveRowsSpy.count(), 0);
+
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(beginInsertRowsSpy.at(0).at(1).toInt(), 3);
+        QCOMPARE(beginInsertRowsSpy.at(0).at(2).toInt(), 3);
+
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(dataChangedSpy.at(0).at(0).toModelIndex(), albumsModel.index(4, 0));
+        QCOMPARE(dataChangedSpy.at(0).at(1).toModelIndex(), albumsModel.index(4, 0));
+
+        QCOMPARE(albumsModel.rowCount(), 5);
+
+        const auto expectedTitles = QStringList{QStringLiteral("track1"), QStringLiteral("track2"), QStringLiteral("track3"),
+                QStringLiteral("track5"), QStringLiteral("track4")};
+        for (int row = 0; row < expectedTitles.size(); ++row) {
+            QCOMPARE(albumsModel.data(albumsModel.index(row, 0), AlbumModel::TitleRole).toString(), expectedTitles[row]);
+        }
+
+        QCOMPARE(albumsModel.data(albumsModel.index(4, 0), AlbumModel::TrackNumberRole).toInt(), 10);
+    }
 };
 
 QTEST_GUILESS_MAIN(AlbumModelTests)
@@ -118,13 +118,6 @@ private:
          {QUrl::fromLocalFile(QStringLiteral("file://image$18"))}, 3, true}
     };
 
-    QHash<QString, QUrl> mNewCovers = {
-        {QStringLiteral("album1"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("album2"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("album3"), QUrl::fromLocalFile(QStringLiteral("album3"))},
-        {QStringLiteral("album4"), QUrl::fromLocalFile(QStringLiteral("album4"))}
-    };
-
 private Q_SLOTS:
 
     void initTestCase()
@@ -142,12 +135,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllAlbumsModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumAdded,
-                &albumsModel, &AllAlbumsModel::albumAdded);
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AllAlbumsModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AllAlbumsModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -163,13 +156,13 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 1);
 
         auto trackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1);
 
@@ -177,11 +170,11 @@ private Q_SLOTS:
 
         musicDb.removeTracksList({firstTrack.resourceURI()});
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 5);
+        QCOMPARE(dataChangedSpy.count(), 2);
     }
 
     void removeOneAlbum()
@@ -189,12 +182,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllAlbumsModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumAdded,
-                &albumsModel, &AllAlbumsModel::albumAdded);
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AllAlbumsModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AllAlbumsModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -210,13 +203,67 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
+
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
+        QCOMPARE(beginRemoveRowsSpy.count(), 0);
+        QCOMPARE(endRemoveRowsSpy.count(), 0);
+        QCOMPARE(dataChangedSpy.count(), 1);
+
+        auto firstTrackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"),
+                                                                         QStringLiteral("album1"), 1, 1);
+        auto firstTrack = musicDb.trackFromDatabaseId(firstTrackId);
+        auto secondTrackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist2"),
+                                                                          QStringLiteral("album1"), 2, 2);
+        auto secondTrack = musicDb.trackFromDatabaseId(secondTrackId);
+        auto thirdTrackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track3"), QStringLiteral("artist3"),
+                                                                         QStringLiteral("album1"), 3, 3);
+        auto thirdTrack = musicDb.trackFromDatabaseId(thirdTrackId);
+        auto fourthTrackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track4"), QStringLiteral("artist4"),
+                                                                          QStringLiteral("album1"), 4, 4);
+        auto fourthTrack = musicDb.trackFromDatabaseId(fourthTrackId);
+
+        musicDb.removeTracksList({firstTrack.resourceURI(), secondTrack.resourceURI(), thirdTrack.resourceURI(), fourthTrack.resourceURI()});
+
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
+        QCOMPARE(beginRemoveRowsSpy.count(), 1);
+        QCOMPARE(endRemoveRowsSpy.count(), 1);
+        QCOMPARE(dataChangedSpy.count(), 1);
+    }
+
+    void applyBatchedChanges()
+    {
+        DatabaseInterface musicDb;
+        AllAlbumsModel albumsModel;
+
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy beginInsertRowsSpy(&albumsModel, &AllAlbumsModel::rowsAboutToBeInserted);
+        QSignalSpy endInsertRowsSpy(&albumsModel, &AllAlbumsModel::rowsInserted);
+        QSignalSpy beginRemoveRowsSpy(&albumsModel, &AllAlbumsModel::rowsAboutToBeRemoved);
+        QSignalSpy endRemoveRowsSpy(&albumsModel, &AllAlbumsModel::rowsRemoved);
+        QSignalSpy dataChangedSpy(&albumsModel, &AllAlbumsModel::dataChanged);
+        QSignalSpy albumCountChangedSpy(&albumsModel, &AllAlbumsModel::albumCountChanged);
+
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(albumCountChangedSpy.count(), 1);
+
+        QCOMPARE(albumsModel.rowCount(), 4);
 
         auto firstTrackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"),
                                                                          QStringLiteral("album1"), 1, 1);
@@ -233,11 +280,18 @@ private Q_SLOTS:
 
         musicDb.removeTracksList({firstTrack.resourceURI(), secondTrack.resourceURI(), thirdTrack.resourceURI(), fourthTrack.resourceURI()});
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 1);
         QCOMPARE(endRemoveRowsSpy.count(), 1);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(albumCountChangedSpy.count(), 2);
+
+        QCOMPARE(albumsModel.rowCount(), 3);
+
+        for (int row = 0; row < albumsModel.rowCount(); ++row) {
+            QVERIFY(albumsModel.data(albumsModel.index(row, 0), AllAlbumsModel::TitleRole).toString() != QStringLiteral("album1"));
+        }
     }
 
     void addOneTrack()
@@ -245,12 +299,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllAlbumsModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumAdded,
-                &albumsModel, &AllAlbumsModel::albumAdded);
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AllAlbumsModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AllAlbumsModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -266,13 +320,13 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 1);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track6"),
                 QStringLiteral("artist2"), QStringLiteral("album4"), QStringLiteral("artist2"), 6, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
@@ -280,13 +334,13 @@ private Q_SLOTS:
         auto newTracks = QList<MusicAudioTrack>();
         newTracks.push_back(newTrack);
 
-        musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(newTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 5);
+        QCOMPARE(dataChangedSpy.count(), 2);
     }
 
     void addOneAlbum()
@@ -294,12 +348,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllAlbumsModel albumsModel;
 
-        connect(&musicDb, &DatabaseInterface::albumAdded,
-                &albumsModel, &AllAlbumsModel::albumAdded);
-        connect(&musicDb, &DatabaseInterface::albumModified,
-                &albumsModel, &AllAlbumsModel::albumModified);
-        connect(&musicDb, &DatabaseInterface::albumRemoved,
-                &albumsModel, &AllAlbumsModel::albumRemoved);
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &AllAlbumsModel::albumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &AllAlbumsModel::albumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &AllAlbumsModel::albumsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -321,13 +375,13 @@ private Q_SLOTS:
             newFiles.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 4);
-        QCOMPARE(endInsertRowsSpy.count(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 4);
+        QCOMPARE(dataChangedSpy.count(), 1);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track1"),
                 QStringLiteral("artist2"), QStringLiteral("album5"), QStringLiteral("artist2"), 1, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
@@ -335,22 +389,67 @@ private Q_SLOTS:
         auto newTracks = QList<MusicAudioTrack>();
         newTracks.push_back(newTrack);
 
-        auto newCover = QUrl::fromLocalFile(QStringLiteral("album5"));
-        auto newCovers = QHash<QString, QUrl>();
-        newCovers[QStringLiteral("album5")] = newCover;
-
         auto newFiles2 = QList<QUrl>();
         for (const auto &oneTrack : newTracks) {
             newFiles2.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(newTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 5);
-        QCOMPARE(endInsertRowsSpy.count(), 5);
+        QCOMPARE(beginInsertRowsSpy.count(), 2);
+        QCOMPARE(endInsertRowsSpy.count(), 2);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
-        QCOMPARE(dataChangedSpy.count(), 5);
+        QCOMPARE(dataChangedSpy.count(), 2);
+    }
+
+    void displayRolesFollowModifications()
+    {
+        AllAlbumsModel albumsModel;
+
+        auto newAlbums = QList<MusicAlbum>();
+        for (int i = 1; i <= 3; ++i) {
+            auto oneAlbum = MusicAlbum();
+            oneAlbum.setValid(true);
+            oneAlbum.setDatabaseId(i);
+            oneAlbum.setTitle(QStringLiteral("album%1").arg(i));
+            oneAlbum.setAlbumArtURI(QUrl::fromLocalFile(QStringLiteral("/cover%1.jpg").arg(i)));
+
+            auto oneTrack = MusicAudioTrack();
+            oneTrack.setValid(true);
+            oneTrack.setDatabaseId(i);
+            oneTrack.setTitle(QStringLiteral("track%1").arg(i));
+            oneTrack.setArtist(QStringLiteral("artist%1").arg(i));
+            oneAlbum.setTracks({oneTrack});
+
+            newAlbums.push_back(oneAlbum);
+        }
+
+        albumsModel.albumsAdded(newAlbums);
+
+        QCOMPARE(albumsModel.data(albumsModel.index(2, 0), AllAlbumsModel::AllArtistsRole).toString(), QStringLiteral("artist3"));
+
+        albumsModel.albumsRemoved({newAlbums[0]});
+
+        QCOMPARE(albumsModel.data(albumsModel.index(0, 0), AllAlbumsModel::AllArtistsRole).toString(), QStringLiteral("artist2"));
+        QCOMPARE(albumsModel.data(albumsModel.index(0, 0), AllAlbumsModel::ImageRole).toUrl(), QUrl::fromLocalFile(QStringLiteral("/cover2.jpg")));
+
+        auto modifiedAlbum = newAlbums[2];
+        auto otherTrack = MusicAudioTrack();
+        otherTrack.setValid(true);
+        otherTrack.setDatabaseId(4);
+        otherTrack.setTitle(QStringLiteral("track4"));
+        otherTrack.setArtist(QStringLiteral("artist4"));
+        modifiedAlbum.setTracks({modifiedAlbum.trackFromIndex(0), otherTrack});
+        modifiedAlbum.setAlbumArtURI({});
+
+        albumsModel.albumsModified({modifiedAlbum});
+
+        QCOMPARE(albumsModel.data(albumsModel.index(0, 0), AllAlbumsModel::AllArtistsRole).toString(), QStringLiteral("artist2"));
+        QCOMPARE(albumsModel.data(albumsModel.index(1, 0), AllAlbumsModel::AllArtistsRole).toString(), QStringLiteral("artist3, artist4"));
+        QCOMPARE(albumsModel.data(albumsModel.index(1, 0), AllAlbumsModel::AllTracksTitleRole).toStringList(),
+                 QStringList({QStringLiteral("track3"), QStringLiteral("track4")}));
+        QCOMPARE(albumsModel.data(albumsModel.index(1, 0), AllAlbumsModel::ImageRole).isValid(), false);
     }
 };
 
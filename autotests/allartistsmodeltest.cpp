@@ -118,13 +118,6 @@ private:
          {QUrl::fromLocalFile(QStringLiteral("file://image$18"))}, 3, true}
     };
 
-    QHash<QString, QUrl> mNewCovers = {
-        {QStringLiteral("album1"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("album2"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("album3"), QUrl::fromLocalFile(QStringLiteral("album3"))},
-        {QStringLiteral("album4"), QUrl::fromLocalFile(QStringLiteral("album4"))}
-    };
-
 private Q_SLOTS:
 
     void initTestCase()
@@ -142,12 +135,12 @@ private Q_SLOTS:
         DatabaseInterface musicDb;
         AllArtistsModel artistsModel;
 
-        connect(&musicDb, &DatabaseInterface::artistAdded,
-                &artistsModel, &AllArtistsModel::artistAdded);
+        connect(&musicDb, &DatabaseInterface::artistsAdded,
+                &artistsModel, &AllArtistsModel::artistsAdded);
         connect(&musicDb, &DatabaseInterface::artistModified,
                 &artistsModel, &AllArtistsModel::artistModified);
-        connect(&musicDb, &DatabaseInterface::artistRemoved,
-                &artistsModel, &AllArtistsModel::artistRemoved);
+        connect(&musicDb, &DatabaseInterface::artistsRemoved,
+                &artistsModel, &AllArtistsModel::artistsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -169,10 +162,10 @@ private Q_SLOTS:
             newFiles.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 6);
-        QCOMPARE(endInsertRowsSpy.count(), 6);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
@@ -183,24 +176,64 @@ private Q_SLOTS:
 
         musicDb.removeTracksList({firstTrack.resourceURI()});
 
-        QCOMPARE(beginInsertRowsSpy.count(), 6);
-        QCOMPARE(endInsertRowsSpy.count(), 6);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 1);
         QCOMPARE(endRemoveRowsSpy.count(), 1);
         QCOMPARE(dataChangedSpy.count(), 0);
     }
 
+    void applyBatchedChanges()
+    {
+        DatabaseInterface musicDb;
+        AllArtistsModel artistsModel;
+
+        connect(&musicDb, &DatabaseInterface::artistsAdded,
+                &artistsModel, &AllArtistsModel::artistsAdded);
+        connect(&musicDb, &DatabaseInterface::artistsRemoved,
+                &artistsModel, &AllArtistsModel::artistsRemoved);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        QSignalSpy beginInsertRowsSpy(&artistsModel, &AllArtistsModel::rowsAboutToBeInserted);
+        QSignalSpy endInsertRowsSpy(&artistsModel, &AllArtistsModel::rowsInserted);
+        QSignalSpy beginRemoveRowsSpy(&artistsModel, &AllArtistsModel::rowsAboutToBeRemoved);
+        QSignalSpy endRemoveRowsSpy(&artistsModel, &AllArtistsModel::rowsRemoved);
+
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
+
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
+        QCOMPARE(beginRemoveRowsSpy.count(), 0);
+        QCOMPARE(endRemoveRowsSpy.count(), 0);
+
+        QCOMPARE(artistsModel.rowCount(), 6);
+
+        auto trackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track6"), QStringLiteral("artist1 and artist2"), QStringLiteral("album2"), 6, 1);
+
+        auto firstTrack = musicDb.trackFromDatabaseId(trackId);
+
+        musicDb.removeTracksList({firstTrack.resourceURI()});
+
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
+        QCOMPARE(beginRemoveRowsSpy.count(), 1);
+        QCOMPARE(endRemoveRowsSpy.count(), 1);
+
+        QCOMPARE(artistsModel.rowCount(), 5);
+    }
+
     void addOneArtist()
     {
         DatabaseInterface musicDb;
         AllArtistsModel artistsModel;
 
-        connect(&musicDb, &DatabaseInterface::artistAdded,
-                &artistsModel, &AllArtistsModel::artistAdded);
+        connect(&musicDb, &DatabaseInterface::artistsAdded,
+                &artistsModel, &AllArtistsModel::artistsAdded);
         connect(&musicDb, &DatabaseInterface::artistModified,
                 &artistsModel, &AllArtistsModel::artistModified);
-        connect(&musicDb, &DatabaseInterface::artistRemoved,
-                &artistsModel, &AllArtistsModel::artistRemoved);
+        connect(&musicDb, &DatabaseInterface::artistsRemoved,
+                &artistsModel, &AllArtistsModel::artistsRemoved);
 
         musicDb.init(QStringLiteral("testDb"));
 
@@ -222,10 +255,10 @@ private Q_SLOTS:
             newFiles.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 6);
-        QCOMPARE(endInsertRowsSpy.count(), 6);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(endInsertRowsSpy.count(), 1);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
@@ -241,10 +274,10 @@ private Q_SLOTS:
             newFiles2.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(newTracks, QStringLiteral("autoTest"));
 
-        QCOMPARE(beginInsertRowsSpy.count(), 7);
-        QCOMPARE(endInsertRowsSpy.count(), 7);
+        QCOMPARE(beginInsertRowsSpy.count(), 2);
+        QCOMPARE(endInsertRowsSpy.count(), 2);
         QCOMPARE(beginRemoveRowsSpy.count(), 0);
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
@@ -118,13 +118,6 @@ private:
          {QUrl::fromLocalFile(QStringLiteral("file://image$18"))}, 3, true}
     };
 
-    QHash<QString, QUrl> mNewCovers = {
-        {QStringLiteral("album1"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("album2"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("album3"), QUrl::fromLocalFile(QStringLiteral("album3"))},
-        {QStringLiteral("album4"), QUrl::fromLocalFile(QStringLiteral("album4"))}
-    };
-
 private Q_SLOTS:
 
     void initTestCase()
@@ -163,7 +156,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
         QCOMPARE(endInsertRowsSpy.count(), 1);
@@ -215,7 +208,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
         QCOMPARE(endInsertRowsSpy.count(), 1);
@@ -275,7 +268,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
         QCOMPARE(endInsertRowsSpy.count(), 1);
@@ -291,7 +284,7 @@ private Q_SLOTS:
         auto newTracks = QList<MusicAudioTrack>();
         newTracks.push_back(newTrack);
 
-        musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(newTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 2);
         QCOMPARE(endInsertRowsSpy.count(), 2);
@@ -334,7 +327,7 @@ private Q_SLOTS:
             newFiles.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
         QCOMPARE(endInsertRowsSpy.count(), 1);
@@ -350,16 +343,12 @@ private Q_SLOTS:
         auto newTracks = QList<MusicAudioTrack>();
         newTracks.push_back(newTrack);
 
-        auto newCover = QUrl::fromLocalFile(QStringLiteral("album5"));
-        auto newCovers = QHash<QString, QUrl>();
-        newCovers[QStringLiteral("album5")] = newCover;
-
         auto newFiles2 = QList<QUrl>();
         for (const auto &oneTrack : newTracks) {
             newFiles2.push_back(oneTrack.resourceURI());
         }
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(newTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 2);
         QCOMPARE(endInsertRowsSpy.count(), 2);
@@ -431,7 +420,7 @@ private Q_SLOTS:
         QCOMPARE(endRemoveRowsSpy.count(), 0);
         QCOMPARE(dataChangedSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
         QCOMPARE(endInsertRowsSpy.count(), 1);
@@ -448,7 +437,7 @@ private Q_SLOTS:
         auto newTracks = QList<MusicAudioTrack>();
         newTracks.push_back(newTrack);
 
-        musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(newTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(beginInsertRowsSpy.count(), 1);
         QCOMPARE(endInsertRowsSpy.count(), 1);
@@ -496,6 +485,96 @@ private Q_SLOTS:
 
         QCOMPARE(tracksModel.rowCount(), 0);
     }
+
+    void removeTracksInRanges()
+    {
+        AllTracksModel tracksModel;
+
+        auto newTracks = QList<MusicAudioTrack>();
+        for (int i = 1; i <= 10; ++i) {
+            auto oneTrack = MusicAudioTrack();
+            oneTrack.setValid(true);
+            oneTrack.setDatabaseId(i);
+            oneTrack.setTitle(QStringLiteral("track%1").arg(i));
+            newTracks.push_back(oneTrack);
+        }
+
+        tracksModel.tracksAdded(newTracks);
+
+        QCOMPARE(tracksModel.rowCount(), 10);
+
+        QSignalSpy beginRemoveRowsSpy(&tracksModel, &AllTracksModel::rowsAboutToBeRemoved);
+        QSignalSpy endRemoveRowsSpy(&tracksModel, &AllTracksModel::rowsRemoved);
+        QSignalSpy dataChangedSpy(&tracksModel, &AllTracksModel::dataChanged);
+
+        tracksModel.tracksRemoved({8, 3, 2, 4, 42});
+
+        QCOMPARE(beginRemoveRowsSpy.count(), 2);
+        QCOMPARE(endRemoveRowsSpy.count(), 2);
+        QCOMPARE(endRemoveRowsSpy.at(0).at(1).toInt(), 7);
+        QCOMPARE(endRemoveRowsSpy.at(0).at(2).toInt(), 7);
+        QCOMPARE(endRemoveRowsSpy.at(1).at(1).toInt(), 1);
+        QCOMPARE(endRemoveRowsSpy.at(1).at(2).toInt(), 3);
+
+        QCOMPARE(tracksModel.rowCount(), 6);
+
+        const auto remainingIds = QList<qulonglong>{1, 5, 6, 7, 9, 10};
+        for (int i = 0; i < remainingIds.size(); ++i) {
+            QCOMPARE(tracksModel.data(tracksModel.index(i, 0), AllTracksModel::DatabaseIdRole).toULongLong(), remainingIds[i]);
+        }
+
+        auto modifiedTrack = newTracks[8];
+        modifiedTrack.setTitle(QStringLiteral("modified"));
+
+        tracksModel.trackModified(modifiedTrack);
+
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(dataChangedSpy.constFirst().constFirst().toModelIndex().row(), 4);
+        QCOMPARE(tracksModel.data(tracksModel.index(4, 0), AllTracksModel::TitleRole).toString(), QStringLiteral("modified"));
+
+        tracksModel.trackRemoved(1);
+
+        QCOMPARE(beginRemoveRowsSpy.count(), 3);
+        QCOMPARE(endRemoveRowsSpy.count(), 3);
+        QCOMPARE(tracksModel.rowCount(), 5);
+        QCOMPARE(tracksModel.data(tracksModel.index(0, 0), AllTracksModel::DatabaseIdRole).toULongLong(), qulonglong(5));
+    }
+
+    void displayRolesFollowModifications()
+    {
+        AllTracksModel tracksModel;
+
+        auto newTracks = QList<MusicAudioTrack>();
+        for (int i = 1; i <= 4; ++i) {
+            auto oneTrack = MusicAudioTrack();
+            oneTrack.setValid(true);
+            oneTrack.setDatabaseId(i);
+            oneTrack.setDuration(QTime::fromMSecsSinceStartOfDay(i * 61000));
+            oneTrack.setAlbumCover(QUrl::fromLocalFile(QStringLiteral("/cover%1.jpg").arg(i)));
+            newTracks.push_back(oneTrack);
+        }
+
+        tracksModel.tracksAdded(newTracks);
+
+        QCOMPARE(tracksModel.data(tracksModel.index(1, 0), AllTracksModel::DurationRole).toString(), QStringLiteral("02:02"));
+        QCOMPARE(tracksModel.data(tracksModel.index(1, 0), AllTracksModel::ImageRole).toUrl(), QUrl::fromLocalFile(QStringLiteral("/cover2.jpg")));
+
+        tracksModel.tracksRemoved({1});
+
+        QCOMPARE(tracksModel.data(tracksModel.index(0, 0), AllTracksModel::DurationRole).toString(), QStringLiteral("02:02"));
+        QCOMPARE(tracksModel.data(tracksModel.index(2, 0), AllTracksModel::DurationRole).toString(), QStringLiteral("04:04"));
+
+        auto modifiedTrack = newTracks[2];
+        modifiedTrack.setDuration(QTime(1, 2, 3));
+        modifiedTrack.setAlbumCover({});
+
+        tracksModel.trackModified(modifiedTrack);
+
+        QCOMPARE(tracksModel.data(tracksModel.index(0, 0), AllTracksModel::DurationRole).toString(), QStringLiteral("02:02"));
+        QCOMPARE(tracksModel.data(tracksModel.index(1, 0), AllTracksModel::DurationRole).toString(), QStringLiteral("01:02:03"));
+        QCOMPARE(tracksModel.data(tracksModel.index(1, 0), AllTracksModel::ImageRole).isValid(), false);
+        QCOMPARE(tracksModel.data(tracksModel.index(2, 0), AllTracksModel::ImageRole).toUrl(), QUrl::fromLocalFile(QStringLiteral("/cover4.jpg")));
+    }
 };
 
 QTEST_GUILESS_MAIN(AllTracksModelTests)
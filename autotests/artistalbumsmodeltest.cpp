@@ -0,0 +1,220 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+#include "databaseinterface.h"
+#include "artistalbumsmodel.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QHash>
+#include <QVector>
+
+#include <QDebug>
+
+#include <QtTest>
+
+class ArtistAlbumsModelTests: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    QList<MusicAudioTrack> mNewTracks = {
+        {true, QStringLiteral("$1"), QStringLiteral("0"), QStringLiteral("track1"),
+         QStringLiteral("artist1"), QStringLiteral("album1"), QStringLiteral("Various Artists"),
+         1, 1, QTime::fromMSecsSinceStartOfDay(1), {QUrl::fromLocalFile(QStringLiteral("/$1"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$1"))}, 1, false},
+        {true, QStringLiteral("$2"), QStringLiteral("0"), QStringLiteral("track2"),
+         QStringLiteral("artist2"), QStringLiteral("album1"), QStringLiteral("Various Artists"),
+         2, 2, QTime::fromMSecsSinceStartOfDay(2), {QUrl::fromLocalFile(QStringLiteral("/$2"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$2"))}, 2, false},
+        {true, QStringLiteral("$3"), QStringLiteral("0"), QStringLiteral("track3"),
+         QStringLiteral("artist3"), QStringLiteral("album1"), QStringLiteral("Various Artists"),
+         3, 3, QTime::fromMSecsSinceStartOfDay(3), {QUrl::fromLocalFile(QStringLiteral("/$3"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$3"))}, 3, false},
+        {true, QStringLiteral("$4"), QStringLiteral("0"), QStringLiteral("track4"),
+         QStringLiteral("artist4"), QStringLiteral("album1"), QStringLiteral("Various Artists"),
+         4, 4, QTime::fromMSecsSinceStartOfDay(4), {QUrl::fromLocalFile(QStringLiteral("/$4"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$4"))}, 4, false},
+        {true, QStringLiteral("$5"), QStringLiteral("0"), QStringLiteral("track1"),
+         QStringLiteral("artist1"), QStringLiteral("album2"), QStringLiteral("artist1"),
+         1, 1, QTime::fromMSecsSinceStartOfDay(5), {QUrl::fromLocalFile(QStringLiteral("/$5"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$5"))}, 5, true},
+        {true, QStringLiteral("$6"), QStringLiteral("0"), QStringLiteral("track2"),
+         QStringLiteral("artist1"), QStringLiteral("album2"), QStringLiteral("artist1"),
+         2, 1, QTime::fromMSecsSinceStartOfDay(6), {QUrl::fromLocalFile(QStringLiteral("/$6"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$6"))}, 1, true},
+        {true, QStringLiteral("$7"), QStringLiteral("0"), QStringLiteral("track3"),
+         QStringLiteral("artist1"), QStringLiteral("album2"), QStringLiteral("artist1"),
+         3, 1, QTime::fromMSecsSinceStartOfDay(7), {QUrl::fromLocalFile(QStringLiteral("/$7"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$7"))}, 2, true},
+        {true, QStringLiteral("$8"), QStringLiteral("0"), QStringLiteral("track4"),
+         QStringLiteral("artist1"), QStringLiteral("album2"), QStringLiteral("artist1"),
+         4, 1, QTime::fromMSecsSinceStartOfDay(8), {QUrl::fromLocalFile(QStringLiteral("/$8"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$8"))}, 3, true},
+        {true, QStringLiteral("$9"), QStringLiteral("0"), QStringLiteral("track5"),
+         QStringLiteral("artist1"), QStringLiteral("album2"), QStringLiteral("artist1"),
+         5, 1, QTime::fromMSecsSinceStartOfDay(9), {QUrl::fromLocalFile(QStringLiteral("/$9"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$9"))}, 4, true},
+        {true, QStringLiteral("$10"), QStringLiteral("0"), QStringLiteral("track6"),
+         QStringLiteral("artist1 and artist2"), QStringLiteral("album2"), QStringLiteral("artist1"),
+         6, 1, QTime::fromMSecsSinceStartOfDay(10), {QUrl::fromLocalFile(QStringLiteral("/$10"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$10"))}, 5, true},
+        {true, QStringLiteral("$11"), QStringLiteral("0"), QStringLiteral("track1"),
+         QStringLiteral("artist2"), QStringLiteral("album3"), QStringLiteral("artist2"),
+         1, 1, QTime::fromMSecsSinceStartOfDay(11), {QUrl::fromLocalFile(QStringLiteral("/$11"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$11"))}, 1, true},
+        {true, QStringLiteral("$12"), QStringLiteral("0"), QStringLiteral("track2"),
+         QStringLiteral("artist2"), QStringLiteral("album3"), QStringLiteral("artist2"),
+         2, 1, QTime::fromMSecsSinceStartOfDay(12), {QUrl::fromLocalFile(QStringLiteral("/$12"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$12"))}, 2, true},
+        {true, QStringLiteral("$13"), QStringLiteral("0"), QStringLiteral("track3"),
+         QStringLiteral("artist2"), QStringLiteral("album3"), QStringLiteral("artist2"),
+         3, 1, QTime::fromMSecsSinceStartOfDay(13), {QUrl::fromLocalFile(QStringLiteral("/$13"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$13"))}, 3, true},
+        {true, QStringLiteral("$14"), QStringLiteral("0"), QStringLiteral("track1"),
+         QStringLiteral("artist2"), QStringLiteral("album4"), QStringLiteral("artist2"),
+         1, 1, QTime::fromMSecsSinceStartOfDay(14), {QUrl::fromLocalFile(QStringLiteral("/$14"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$14"))}, 4, true},
+        {true, QStringLiteral("$15"), QStringLiteral("0"), QStringLiteral("track2"),
+         QStringLiteral("artist2"), QStringLiteral("album4"), QStringLiteral("artist2"),
+         2, 1, QTime::fromMSecsSinceStartOfDay(15), {QUrl::fromLocalFile(QStringLiteral("/$15"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$15"))}, 5, true},
+        {true, QStringLiteral("$16"), QStringLiteral("0"), QStringLiteral("track3"),
+         QStringLiteral("artist2"), QStringLiteral("album4"), QStringLiteral("artist2"),
+         3, 1, QTime::fromMSecsSinceStartOfDay(16), {QUrl::fromLocalFile(QStringLiteral("/$16"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$16"))}, 1, true},
+        {true, QStringLiteral("$17"), QStringLiteral("0"), QStringLiteral("track4"),
+         QStringLiteral("artist2"), QStringLiteral("album4"), QStringLiteral("artist2"),
+         4, 1, QTime::fromMSecsSinceStartOfDay(17), {QUrl::fromLocalFile(QStringLiteral("/$17"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$17"))}, 2, true},
+        {true, QStringLiteral("$18"), QStringLiteral("0"), QStringLiteral("track5"),
+         QStringLiteral("artist2"), QStringLiteral("album4"), QStringLiteral("artist2"),
+         5, 1, QTime::fromMSecsSinceStartOfDay(18), {QUrl::fromLocalFile(QStringLiteral("/$18"))},
+         {QUrl::fromLocalFile(QStringLiteral("file://image$18"))}, 3, true}
+    };
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QHash<qulonglong,int>>("QHash<qulonglong,int>");
+        qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
+        qRegisterMetaType<QVector<qlonglong>>("QVector<qlonglong>");
+        qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
+        qRegisterMetaType<MusicArtist>("MusicArtist");
+    }
+
+    void fetchAlbumsFromArtist()
+    {
+        DatabaseInterface musicDb;
+        ArtistAlbumsModel albumsModel;
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
+
+        const auto &artistAlbums = musicDb.albumsFromAuthor(QStringLiteral("artist2"));
+
+        QCOMPARE(artistAlbums.size(), 3);
+
+        albumsModel.setArtist(QStringLiteral("artist2"));
+
+        QCOMPARE(albumsModel.rowCount(), 0);
+
+        albumsModel.albumsFromArtistFetched(QStringLiteral("artist1"), musicDb.albumsFromAuthor(QStringLiteral("artist1")));
+
+        QCOMPARE(albumsModel.rowCount(), 0);
+
+        albumsModel.albumsFromArtistFetched(QStringLiteral("artist2"), artistAlbums);
+
+        QCOMPARE(albumsModel.rowCount(), 3);
+
+        auto allTitles = QStringList();
+        for (int row = 0; row < albumsModel.rowCount(); ++row) {
+            allTitles.push_back(albumsModel.data(albumsModel.index(row, 0), AllAlbumsModel::TitleRole).toString());
+        }
+        allTitles.sort();
+
+        QCOMPARE(allTitles, QStringList({QStringLiteral("album1"), QStringLiteral("album3"), QStringLiteral("album4")}));
+    }
+
+    void followLibraryChanges()
+    {
+        DatabaseInterface musicDb;
+        ArtistAlbumsModel albumsModel;
+
+        connect(&musicDb, &DatabaseInterface::albumsAdded,
+                &albumsModel, &ArtistAlbumsModel::libraryAlbumsAdded);
+        connect(&musicDb, &DatabaseInterface::albumsModified,
+                &albumsModel, &ArtistAlbumsModel::libraryAlbumsModified);
+        connect(&musicDb, &DatabaseInterface::albumsRemoved,
+                &albumsModel, &ArtistAlbumsModel::libraryAlbumsRemoved);
+
+        musicDb.init(QStringLiteral("testDb"));
+
+        albumsModel.setArtist(QStringLiteral("artist2"));
+
+        QSignalSpy beginInsertRowsSpy(&albumsModel, &ArtistAlbumsModel::rowsAboutToBeInserted);
+        QSignalSpy beginRemoveRowsSpy(&albumsModel, &ArtistAlbumsModel::rowsAboutToBeRemoved);
+
+        musicDb.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
+
+        QCOMPARE(albumsModel.rowCount(), 3);
+        QCOMPARE(beginRemoveRowsSpy.count(), 0);
+
+        auto otherArtistTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track1"),
+                QStringLiteral("artist3"), QStringLiteral("album5"), QStringLiteral("artist3"), 1, 1,
+                QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
+                {QUrl::fromLocalFile(QStringLiteral("file://image$19"))}, 1, true};
+
+        musicDb.insertTracksList({otherArtistTrack}, QStringLiteral("autoTest"));
+
+        QCOMPARE(albumsModel.rowCount(), 3);
+
+        auto modifiedTrack = MusicAudioTrack{true, QStringLiteral("$6"), QStringLiteral("0"), QStringLiteral("track2"),
+                QStringLiteral("artist2"), QStringLiteral("album2"), QStringLiteral("artist1"), 2, 1,
+                QTime::fromMSecsSinceStartOfDay(6), {QUrl::fromLocalFile(QStringLiteral("/$6"))},
+                {QUrl::fromLocalFile(QStringLiteral("file://image$6"))}, 1, true};
+
+        musicDb.modifyTracksList({modifiedTrack}, QStringLiteral("autoTest"));
+
+        QCOMPARE(albumsModel.rowCount(), 4);
+        QCOMPARE(beginRemoveRowsSpy.count(), 0);
+
+        musicDb.removeTracksList({QUrl::fromLocalFile(QStringLiteral("/$14")), QUrl::fromLocalFile(QStringLiteral("/$15")),
+                                  QUrl::fromLocalFile(QStringLiteral("/$16")), QUrl::fromLocalFile(QStringLiteral("/$17")),
+                                  QUrl::fromLocalFile(QStringLiteral("/$18"))});
+
+        QCOMPARE(albumsModel.rowCount(), 3);
+        QCOMPARE(beginRemoveRowsSpy.count(), 1);
+
+        for (int row = 0; row < albumsModel.rowCount(); ++row) {
+            QVERIFY(albumsModel.data(albumsModel.index(row, 0), AllAlbumsModel::TitleRole).toString() != QStringLiteral("album4"));
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(ArtistAlbumsModelTests)
+
+
+#include "artistalbumsmodeltest.moc"
@@ -0,0 +1,115 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "audiotagreader.h"
+#include "elisautils.h"
+#include "musicaudiotrack.h"
+
+#include "config-upnp-qt.h"
+#include "mediaplaylisttestconfig.h"
+
+#include <KFileMetaData/ExtractorCollection>
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QStringList>
+#include <QMimeDatabase>
+
+#include <QtTest>
+
+class AudioTagReaderTests: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    AudioTagReaderTests(QObject *parent = nullptr) : QObject(parent)
+    {
+    }
+
+private:
+
+    KFileMetaData::ExtractorCollection mExtractors;
+
+    QMimeDatabase mMimeDb;
+
+private Q_SLOTS:
+
+    void readTags_data()
+    {
+        QTest::addColumn<QString>("fileName");
+        QTest::addColumn<QString>("title");
+        QTest::addColumn<QString>("artist");
+        QTest::addColumn<QString>("album");
+
+        QTest::newRow("mp3") << QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/test.mp3")
+                             << QStringLiteral("Title") << QStringLiteral("Artist") << QStringLiteral("Test");
+        QTest::newRow("m4a") << QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/test.m4a")
+                             << QStringLiteral("Title") << QStringLiteral("Artist") << QStringLiteral("Test");
+        QTest::newRow("ogg") << QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/test.ogg")
+                             << QStringLiteral("Title") << QStringLiteral("Artist") << QStringLiteral("Test");
+        QTest::newRow("ogg2") << QStringLiteral(MEDIAPLAYLIST_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/test2.ogg")
+                              << QStringLiteral("Title2") << QStringLiteral("Artist2") << QStringLiteral("Test2");
+    }
+
+    void readTags()
+    {
+        QFETCH(QString, fileName);
+        QFETCH(QString, title);
+        QFETCH(QString, artist);
+        QFETCH(QString, album);
+
+        AudioTagReader tagReader;
+        MusicAudioTrack fastTrack;
+
+        QCOMPARE(tagReader.readTrack(fileName, fastTrack), true);
+
+        QCOMPARE(fastTrack.title(), title);
+        QCOMPARE(fastTrack.artist(), artist);
+        QCOMPARE(fastTrack.albumName(), album);
+        QCOMPARE(fastTrack.albumArtist(), QStringLiteral("Album Artist"));
+        QCOMPARE(fastTrack.trackNumber(), 1);
+        QCOMPARE(fastTrack.discNumber(), 1);
+
+        const auto &extractedTrack = ElisaUtils::scanOneFile(QUrl::fromLocalFile(fileName), mMimeDb, mExtractors);
+
+        QCOMPARE(fastTrack.title(), extractedTrack.title());
+        QCOMPARE(fastTrack.artist(), extractedTrack.artist());
+        QCOMPARE(fastTrack.albumName(), extractedTrack.albumName());
+        QCOMPARE(fastTrack.albumArtist(), extractedTrack.albumArtist());
+        QCOMPARE(fastTrack.trackNumber(), extractedTrack.trackNumber());
+        QCOMPARE(fastTrack.discNumber(), extractedTrack.discNumber());
+        QVERIFY(qAbs(fastTrack.duration().msecsSinceStartOfDay() - extractedTrack.duration().msecsSinceStartOfDay()) < 1000);
+    }
+
+    void fallbackForUnknownFiles()
+    {
+        AudioTagReader tagReader;
+        MusicAudioTrack fastTrack;
+
+        QCOMPARE(tagReader.readTrack(QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/cover.jpg"), fastTrack), false);
+        QCOMPARE(tagReader.readTrack(QStringLiteral("/directoryNotExist/test.ogg"), fastTrack), false);
+    }
+};
+
+QTEST_GUILESS_MAIN(AudioTagReaderTests)
+
+
+#include "audiotagreadertest.moc"
@@ -23,6 +23,7 @@
 
 #include <QObject>
 #include <QUrl>
+#include <QDateTime>
 #include <QString>
 #include <QHash>
 #include <QVector>
@@ -39,6 +40,43 @@
 
 #include <algorithm>
 
+template <typename T>
+static int itemsCount(const QSignalSpy &spy)
+{
+    auto result = 0;
+
+    for (const auto &oneSignal : spy) {
+        result += oneSignal.at(0).value<QList<T>>().size();
+    }
+
+    return result;
+}
+
+template <typename T>
+static QList<qulonglong> itemIds(const QSignalSpy &spy)
+{
+    auto result = QList<qulonglong>();
+
+    for (const auto &oneSignal : spy) {
+        for (const auto &oneItem : oneSignal.at(0).value<QList<T>>()) {
+            result.push_back(oneItem.databaseId());
+        }
+    }
+
+    return result;
+}
+
+static QList<MusicAudioTrack> tracksWithCovers(QList<MusicAudioTrack> tracks, const QHash<QString, QUrl> &covers)
+{
+    for (auto &oneTrack : tracks) {
+        if (oneTrack.albumCover().isEmpty()) {
+            oneTrack.setAlbumCover(covers.value(oneTrack.resourceURI().toString()));
+        }
+    }
+
+    return tracks;
+}
+
 class DatabaseInterfaceTests: public QObject
 {
     Q_OBJECT
@@ -131,6 +169,8 @@ private Q_SLOTS:
         qRegisterMetaType<QVector<qlonglong>>("QVector<qlonglong>");
         qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
         qRegisterMetaType<MusicArtist>("MusicArtist");
+        qRegisterMetaType<QList<MusicArtist>>("QList<MusicArtist>");
+        qRegisterMetaType<QList<MusicAlbum>>("QList<MusicAlbum>");
     }
 
     void avoidCrashInTrackIdFromTitleAlbumArtist()
@@ -157,27 +197,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -190,20 +230,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 1);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -245,27 +285,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -284,20 +324,20 @@ private Q_SLOTS:
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
         newCovers[QStringLiteral("file:///$20")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 2);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 2);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 2);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -350,27 +390,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -391,20 +431,20 @@ private Q_SLOTS:
         newCovers[QStringLiteral("file:///$20")] = QUrl::fromLocalFile(QStringLiteral("album3"));
         newCovers[QStringLiteral("file:///$21")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 1);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 3);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -478,27 +518,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -515,20 +555,20 @@ private Q_SLOTS:
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
         newCovers[QStringLiteral("file:///$20")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 3);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 2);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -588,10 +628,10 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
@@ -619,7 +659,7 @@ private Q_SLOTS:
 
             musicDb.init(QStringLiteral("testDb1"), myTempDatabase.fileName());
 
-            musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
 
@@ -642,7 +682,7 @@ private Q_SLOTS:
 
             musicDb.init(QStringLiteral("testDb2"), myTempDatabase.fileName());
 
-            musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
 
@@ -679,7 +719,7 @@ private Q_SLOTS:
             auto newCovers = mNewCovers;
             newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-            musicDb.insertTracksList(allNewTracks, newCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(allNewTracks, newCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
 
@@ -722,7 +762,7 @@ private Q_SLOTS:
             auto newCovers = mNewCovers;
             newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-            musicDb.insertTracksList(allNewTracks, newCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(allNewTracks, newCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
 
@@ -761,10 +801,10 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
@@ -841,20 +881,20 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDbVariousArtistAlbum"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
 
         auto allAlbums = musicDb.allAlbums();
@@ -1026,17 +1066,17 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDbVariousArtistAlbum"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track6"),
@@ -1053,13 +1093,13 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("image$19"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest2"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest2"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 7);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 7);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 14);
 
         auto allTracks = musicDb.allTracksFromSource(QStringLiteral("autoTest"));
@@ -1078,29 +1118,29 @@ private Q_SLOTS:
         {
             DatabaseInterface musicDb;
 
-            QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-            QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+            QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+            QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
             QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
 
             QCOMPARE(musicDb.allAlbums().count(), 0);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+            QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+            QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
             QCOMPARE(musicDbTrackAddedSpy.count(), 0);
 
             musicDb.init(QStringLiteral("testDbVariousArtistAlbum1"), myDatabaseFile.fileName());
 
             QCOMPARE(musicDb.allAlbums().count(), 0);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+            QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+            QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
             QCOMPARE(musicDbTrackAddedSpy.count(), 0);
 
-            musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+            QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+            QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
             QCOMPARE(musicDbTrackAddedSpy.count(), 13);
 
             auto allAlbums = musicDb.allAlbums();
@@ -1269,29 +1309,29 @@ private Q_SLOTS:
         {
             DatabaseInterface musicDb;
 
-            QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-            QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+            QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+            QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
             QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
 
             QCOMPARE(musicDb.allAlbums().count(), 0);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+            QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+            QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
             QCOMPARE(musicDbTrackAddedSpy.count(), 0);
 
             musicDb.init(QStringLiteral("testDbVariousArtistAlbum2"), myDatabaseFile.fileName());
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+            QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+            QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
             QCOMPARE(musicDbTrackAddedSpy.count(), 13);
 
-            musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+            QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+            QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
             QCOMPARE(musicDbTrackAddedSpy.count(), 13);
 
             auto allAlbums = musicDb.allAlbums();
@@ -1472,13 +1512,13 @@ private Q_SLOTS:
             auto newCovers = mNewCovers;
             newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("image$19"));
 
-            musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
 
             QCOMPARE(musicDb.allAlbums().count(), 3);
-            QCOMPARE(musicDbArtistAddedSpy.count(), 7);
-            QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+            QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 7);
+            QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
             QCOMPARE(musicDbTrackAddedSpy.count(), 14);
         }
     }
@@ -1488,17 +1528,17 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDbVariousArtistAlbum"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
 
         auto allTracks = musicDb.tracksFromAuthor(QStringLiteral("artist1"));
@@ -1523,44 +1563,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -1588,14 +1628,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 1);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -1623,6 +1663,115 @@ private Q_SLOTS:
         QCOMPARE(removedTrackId, qulonglong(0));
     }
 
+    void renameOneTrack()
+    {
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        qDebug() << "renameOneTrack" << databaseFile.fileName();
+
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
+
+        QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
+        QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
+        QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+
+        musicDbTrackAddedSpy.wait(300);
+
+        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
+        QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
+
+        auto trackId = musicDb.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist1"),
+                                                                    QStringLiteral("album1"), 1, 1);
+
+        auto firstTrack = musicDb.trackFromDatabaseId(trackId);
+        auto renamedFile = QUrl::fromLocalFile(QStringLiteral("/renamed/$1"));
+
+        musicDb.renameTracksList({{firstTrack.resourceURI(), renamedFile}});
+
+        QCOMPARE(musicDbTrackAddedSpy.count(), 13);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
+        QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
+        QCOMPARE(musicDbTrackModifiedSpy.count(), 2);
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+
+        QCOMPARE(musicDb.trackIdFromFileName(renamedFile), trackId);
+        QCOMPARE(musicDb.trackIdFromFileName(firstTrack.resourceURI()), qulonglong(0));
+        QCOMPARE(musicDb.trackFromDatabaseId(trackId).resourceURI(), renamedFile);
+        QCOMPARE(musicDbTrackModifiedSpy.at(1).at(0).value<MusicAudioTrack>().databaseId(), trackId);
+    }
+
+    void recordExtractionFailures()
+    {
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        qDebug() << "recordExtractionFailures" << databaseFile.fileName();
+
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
+
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        QCOMPARE(musicDb.extractionFailures().isEmpty(), true);
+
+        const auto firstFile = QUrl::fromLocalFile(QStringLiteral("/hanging/$1"));
+        const auto secondFile = QUrl::fromLocalFile(QStringLiteral("/crashing/$2"));
+        const auto firstTime = QDateTime::fromMSecsSinceEpoch(1500000000000);
+        const auto secondTime = QDateTime::fromMSecsSinceEpoch(1500000060000);
+
+        musicDb.insertExtractionFailure(firstFile, firstTime);
+        musicDb.insertExtractionFailure(secondFile, firstTime);
+        musicDb.insertExtractionFailure(secondFile, secondTime);
+
+        const auto &allFailures = musicDb.extractionFailures();
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(allFailures.size(), 2);
+        QCOMPARE(allFailures.value(firstFile), firstTime);
+        QCOMPARE(allFailures.value(secondFile), secondTime);
+    }
+
+    void resolveTracksFromFileNames()
+    {
+        QTemporaryFile databaseFile;
+        databaseFile.open();
+
+        qDebug() << "resolveTracksFromFileNames" << databaseFile.fileName();
+
+        DatabaseInterface musicDb;
+
+        musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
+
+        QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
+
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
+
+        const auto firstFile = QUrl::fromLocalFile(QStringLiteral("/$1"));
+        const auto secondFile = QUrl::fromLocalFile(QStringLiteral("/$2"));
+        const auto unknownFile = QUrl::fromLocalFile(QStringLiteral("/unknown/$1"));
+
+        const auto &allTracks = musicDb.tracksFromFileNames({firstFile, unknownFile, secondFile});
+
+        QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
+        QCOMPARE(allTracks.size(), 2);
+        QCOMPARE(allTracks.contains(unknownFile), false);
+        QCOMPARE(allTracks.value(firstFile).databaseId(), musicDb.trackIdFromFileName(firstFile));
+        QCOMPARE(allTracks.value(firstFile).title(), QStringLiteral("track1"));
+        QCOMPARE(allTracks.value(secondFile).databaseId(), musicDb.trackIdFromFileName(secondFile));
+        QCOMPARE(allTracks.value(secondFile).title(), QStringLiteral("track2"));
+    }
+
     void removeOneTrackAndModifyIt()
     {
         QTemporaryFile databaseFile;
@@ -1634,44 +1783,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -1699,14 +1848,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 1);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -1735,20 +1884,20 @@ private Q_SLOTS:
 
         firstTrack.setDatabaseId(0);
 
-        musicDb.modifyTracksList({firstTrack}, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.modifyTracksList(tracksWithCovers({firstTrack}, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 1);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 5);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 5);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -1784,44 +1933,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -1864,14 +2013,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 2);
         QCOMPARE(musicDb.allArtists().count(), 5);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 1);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 6);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -1886,44 +2035,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -1950,14 +2099,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 5);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 1);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
     }
@@ -1968,44 +2117,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2018,20 +2167,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("image$19"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
     }
@@ -2042,27 +2191,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2075,20 +2224,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 1);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2149,20 +2298,20 @@ private Q_SLOTS:
         auto newCovers2 = mNewCovers;
         newCovers2[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("image$19"));
 
-        musicDb.insertTracksList(newTracks2, newCovers2, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks2, newCovers2), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(50);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 2);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 2);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 2);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2226,27 +2375,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2259,20 +2408,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 1);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2335,20 +2484,20 @@ private Q_SLOTS:
         auto newCovers2 = mNewCovers;
         newCovers2[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks2, newCovers2, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks2, newCovers2), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(50);
 
         QCOMPARE(musicDb.allAlbums().count(), 2);
         QCOMPARE(musicDb.allArtists().count(), 2);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 2);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 2);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 2);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2413,9 +2562,9 @@ private Q_SLOTS:
         QCOMPARE(secondAlbumTracksCount, 1);
         QCOMPARE(secondAlbumIsSingleDiscAlbum, true);
 
-        auto modifiedAlbumIds = QList<qulonglong>{musicDbAlbumModifiedSpy.at(0).at(1).toULongLong(),
-                                 musicDbAlbumModifiedSpy.at(1).at(1).toULongLong(),
-                                 musicDbAlbumModifiedSpy.at(2).at(1).toULongLong(),};
+        auto modifiedAlbumIds = itemIds<MusicAlbum>(musicDbAlbumModifiedSpy);
+
+        QCOMPARE(modifiedAlbumIds.size(), 3);
 
         std::sort(modifiedAlbumIds.begin(), modifiedAlbumIds.end());
         QCOMPARE(modifiedAlbumIds.at(0), qulonglong(2));
@@ -2434,27 +2583,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2467,20 +2616,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 1);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2544,20 +2693,20 @@ private Q_SLOTS:
         auto newCovers2 = mNewCovers;
         newCovers2[QStringLiteral("file:///$20")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks2, newCovers2, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks2, newCovers2), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(50);
 
         QCOMPARE(musicDb.allAlbums().count(), 2);
         QCOMPARE(musicDb.allArtists().count(), 2);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 2);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 2);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 2);
         QCOMPARE(musicDbTrackAddedSpy.count(), 2);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 2);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2622,8 +2771,7 @@ private Q_SLOTS:
         QCOMPARE(secondAlbumTracksCount, 1);
         QCOMPARE(secondAlbumIsSingleDiscAlbum, true);
 
-        QCOMPARE(musicDbAlbumModifiedSpy.at(0).at(1).toULongLong(), qulonglong(2));
-        QCOMPARE(musicDbAlbumModifiedSpy.at(1).at(1).toULongLong(), qulonglong(3));
+        QCOMPARE(itemIds<MusicAlbum>(musicDbAlbumModifiedSpy), (QList<qulonglong>{2, 3}));
     }
 
     void addTwoTracksInAlbumWithoutCover()
@@ -2632,44 +2780,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2682,20 +2830,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl();
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 4);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 4);
         QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2715,20 +2863,20 @@ private Q_SLOTS:
         auto newCovers2 = mNewCovers;
         newCovers2[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album6"));
 
-        musicDb.insertTracksList(newTracks2, newCovers2, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks2, newCovers2), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 4);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 4);
         QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 5);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 5);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 2);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2751,44 +2899,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2796,18 +2944,18 @@ private Q_SLOTS:
                 QStringLiteral("artist3"), QStringLiteral("album1"), QStringLiteral("Various Artists"), 5, 3,
                 QTime::fromMSecsSinceStartOfDay(3), {QUrl::fromLocalFile(QStringLiteral("/$3"))}, {QUrl::fromLocalFile(QStringLiteral("file://image$3"))}, 5, true};
 
-        musicDb.modifyTracksList({modifiedTrack}, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.modifyTracksList(tracksWithCovers({modifiedTrack}, mNewCovers), QStringLiteral("autoTest"));
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 2);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2826,44 +2974,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2877,20 +3025,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = newCover;
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 4);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 4);
         QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2904,44 +3052,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -2959,20 +3107,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("file://image$19"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 7);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 7);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 7);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 4);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
     }
@@ -2991,34 +3139,34 @@ private Q_SLOTS:
 
             musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-            musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
         }
 
         DatabaseInterface musicDb2;
 
-        QSignalSpy musicDbArtistAddedSpy2(&musicDb2, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy2(&musicDb2, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy2(&musicDb2, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy2(&musicDb2, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy2(&musicDb2, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy2(&musicDb2, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy2(&musicDb2, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy2(&musicDb2, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy2(&musicDb2, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy2(&musicDb2, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy2(&musicDb2, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy2(&musicDb2, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy2(&musicDb2, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy2(&musicDb2, &DatabaseInterface::trackModified);
 
         QCOMPARE(musicDb2.allAlbums().count(), 0);
         QCOMPARE(musicDb2.allArtists().count(), 0);
         QCOMPARE(musicDb2.allTracks().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 0);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 0);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 0);
 
         musicDb2.init(QStringLiteral("testDb2"), databaseFile.fileName());
@@ -3028,14 +3176,14 @@ private Q_SLOTS:
         QCOMPARE(musicDb2.allAlbums().count(), 3);
         QCOMPARE(musicDb2.allArtists().count(), 6);
         QCOMPARE(musicDb2.allTracks().count(), 13);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 0);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 0);
 
         auto newTrack = MusicAudioTrack{true, QStringLiteral("$19"), QStringLiteral("0"), QStringLiteral("track6"),
@@ -3052,19 +3200,19 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("file://image$19"));
 
-        musicDb2.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb2.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         QCOMPARE(musicDb2.allAlbums().count(), 3);
         QCOMPARE(musicDb2.allArtists().count(), 7);
         QCOMPARE(musicDb2.allTracks().count(), 14);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 7);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 7);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 1);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 0);
 
         auto invalidTracks = musicDb2.allInvalidTracksFromSource(QStringLiteral("autoTest"));
@@ -3082,14 +3230,14 @@ private Q_SLOTS:
         QCOMPARE(musicDb2.allAlbums().count(), 1);
         QCOMPARE(musicDb2.allArtists().count(), 2);
         QCOMPARE(musicDb2.allTracks().count(), 1);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 7);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 7);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 14);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 5);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 2);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 5);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 2);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 13);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 2);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 0);
     }
 
@@ -3107,34 +3255,34 @@ private Q_SLOTS:
 
             musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-            musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
         }
 
         DatabaseInterface musicDb2;
 
-        QSignalSpy musicDbArtistAddedSpy2(&musicDb2, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy2(&musicDb2, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy2(&musicDb2, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy2(&musicDb2, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy2(&musicDb2, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy2(&musicDb2, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy2(&musicDb2, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy2(&musicDb2, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy2(&musicDb2, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy2(&musicDb2, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy2(&musicDb2, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy2(&musicDb2, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy2(&musicDb2, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy2(&musicDb2, &DatabaseInterface::trackModified);
 
         QCOMPARE(musicDb2.allAlbums().count(), 0);
         QCOMPARE(musicDb2.allArtists().count(), 0);
         QCOMPARE(musicDb2.allTracks().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 0);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 0);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 0);
 
         musicDb2.init(QStringLiteral("testDb2"), databaseFile.fileName());
@@ -3144,29 +3292,29 @@ private Q_SLOTS:
         QCOMPARE(musicDb2.allAlbums().count(), 3);
         QCOMPARE(musicDb2.allArtists().count(), 6);
         QCOMPARE(musicDb2.allTracks().count(), 13);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 0);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 0);
 
-        musicDb2.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb2.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         QCOMPARE(musicDb2.allAlbums().count(), 3);
         QCOMPARE(musicDb2.allArtists().count(), 6);
         QCOMPARE(musicDb2.allTracks().count(), 13);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 1);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 1);
 
         auto invalidTracks = musicDb2.allInvalidTracksFromSource(QStringLiteral("autoTest"));
@@ -3184,14 +3332,14 @@ private Q_SLOTS:
         QCOMPARE(musicDb2.allAlbums().count(), 3);
         QCOMPARE(musicDb2.allArtists().count(), 6);
         QCOMPARE(musicDb2.allTracks().count(), 13);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 1);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 1);
     }
 
@@ -3209,34 +3357,34 @@ private Q_SLOTS:
 
             musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-            musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+            musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
             musicDbTrackAddedSpy.wait(300);
         }
 
         DatabaseInterface musicDb2;
 
-        QSignalSpy musicDbArtistAddedSpy2(&musicDb2, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy2(&musicDb2, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy2(&musicDb2, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy2(&musicDb2, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy2(&musicDb2, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy2(&musicDb2, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy2(&musicDb2, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy2(&musicDb2, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy2(&musicDb2, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy2(&musicDb2, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy2(&musicDb2, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy2(&musicDb2, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy2(&musicDb2, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy2(&musicDb2, &DatabaseInterface::trackModified);
 
         QCOMPARE(musicDb2.allAlbums().count(), 0);
         QCOMPARE(musicDb2.allArtists().count(), 0);
         QCOMPARE(musicDb2.allTracks().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 0);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 0);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 0);
 
         musicDb2.init(QStringLiteral("testDb2"), databaseFile.fileName());
@@ -3246,29 +3394,29 @@ private Q_SLOTS:
         QCOMPARE(musicDb2.allAlbums().count(), 3);
         QCOMPARE(musicDb2.allArtists().count(), 6);
         QCOMPARE(musicDb2.allTracks().count(), 13);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 0);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 0);
 
-        musicDb2.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb2.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         QCOMPARE(musicDb2.allAlbums().count(), 3);
         QCOMPARE(musicDb2.allArtists().count(), 6);
         QCOMPARE(musicDb2.allTracks().count(), 13);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 1);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 1);
 
         musicDb2.cleanInvalidTracks();
@@ -3276,14 +3424,14 @@ private Q_SLOTS:
         QCOMPARE(musicDb2.allAlbums().count(), 3);
         QCOMPARE(musicDb2.allArtists().count(), 6);
         QCOMPARE(musicDb2.allTracks().count(), 13);
-        QCOMPARE(musicDbArtistAddedSpy2.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy2.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy2), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy2), 3);
         QCOMPARE(musicDbTrackAddedSpy2.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy2.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy2), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy2), 0);
         QCOMPARE(musicDbTrackRemovedSpy2.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy2.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy2.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy2), 1);
         QCOMPARE(musicDbTrackModifiedSpy2.count(), 1);
     }
 
@@ -3293,44 +3441,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"));
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3338,14 +3486,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
     }
@@ -3361,44 +3509,44 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
-        musicDb.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(mNewTracks, mNewCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 3);
         QCOMPARE(musicDb.allArtists().count(), 6);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 6);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 3);
         QCOMPARE(musicDbTrackAddedSpy.count(), 13);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 3);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 1);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3433,20 +3581,20 @@ private Q_SLOTS:
              {QUrl::fromLocalFile(QStringLiteral("file://image$2"))}, 2, false},
         };
 
-        musicDb.insertTracksList(secondNewTracks, mNewCovers, QStringLiteral("autoTestSource2"));
+        musicDb.insertTracksList(tracksWithCovers(secondNewTracks, mNewCovers), QStringLiteral("autoTestSource2"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 4);
         QCOMPARE(musicDb.allArtists().count(), 7);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 7);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 7);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 4);
         QCOMPARE(musicDbTrackAddedSpy.count(), 19);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 5);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 5);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 2);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3454,14 +3602,14 @@ private Q_SLOTS:
 
         QCOMPARE(musicDb.allAlbums().count(), 2);
         QCOMPARE(musicDb.allArtists().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 7);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 4);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 7);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 4);
         QCOMPARE(musicDbTrackAddedSpy.count(), 19);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 4);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 2);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 4);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 2);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 12);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 6);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 6);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 2);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
     }
@@ -3477,27 +3625,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3532,20 +3680,20 @@ private Q_SLOTS:
              {QUrl::fromLocalFile(QStringLiteral("file://image$2"))}, 2, false},
         };
 
-        musicDb.insertTracksList(newTracks, mNewCovers, QStringLiteral("autoTestSource2"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, mNewCovers), QStringLiteral("autoTestSource2"));
 
         musicDbTrackAddedSpy.wait(100);
 
         QCOMPARE(musicDb.allAlbums().count(), 2);
         QCOMPARE(musicDb.allArtists().count(), 3);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 3);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 2);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 3);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 2);
         QCOMPARE(musicDbTrackAddedSpy.count(), 7);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 2);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3563,27 +3711,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3596,20 +3744,20 @@ private Q_SLOTS:
         auto newCovers = mNewCovers;
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 1);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3638,20 +3786,20 @@ private Q_SLOTS:
         auto newCovers2 = mNewCovers;
         newCovers2[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks2, newCovers2, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks2, newCovers2), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 1);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 1);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
     }
@@ -3667,27 +3815,27 @@ private Q_SLOTS:
 
         musicDb.init(QStringLiteral("testDb"), databaseFile.fileName());
 
-        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistAdded);
-        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumAdded);
+        QSignalSpy musicDbArtistAddedSpy(&musicDb, &DatabaseInterface::artistsAdded);
+        QSignalSpy musicDbAlbumAddedSpy(&musicDb, &DatabaseInterface::albumsAdded);
         QSignalSpy musicDbTrackAddedSpy(&musicDb, &DatabaseInterface::trackAdded);
-        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistRemoved);
-        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumRemoved);
+        QSignalSpy musicDbArtistRemovedSpy(&musicDb, &DatabaseInterface::artistsRemoved);
+        QSignalSpy musicDbAlbumRemovedSpy(&musicDb, &DatabaseInterface::albumsRemoved);
         QSignalSpy musicDbTrackRemovedSpy(&musicDb, &DatabaseInterface::trackRemoved);
         QSignalSpy musicDbArtistModifiedSpy(&musicDb, &DatabaseInterface::artistModified);
-        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumModified);
+        QSignalSpy musicDbAlbumModifiedSpy(&musicDb, &DatabaseInterface::albumsModified);
         QSignalSpy musicDbTrackModifiedSpy(&musicDb, &DatabaseInterface::trackModified);
         QSignalSpy musicDbDatabaseErrorSpy(&musicDb, &DatabaseInterface::databaseError);
 
         QCOMPARE(musicDb.allAlbums().count(), 0);
         QCOMPARE(musicDb.allArtists().count(), 0);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 0);
         QCOMPARE(musicDbTrackAddedSpy.count(), 0);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 0);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3702,20 +3850,20 @@ private Q_SLOTS:
         newCovers[QStringLiteral("file:///$19")] = QUrl::fromLocalFile(QStringLiteral("album3"));
         newCovers[QStringLiteral("file:///$20")] = QUrl::fromLocalFile(QStringLiteral("album3"));
 
-        musicDb.insertTracksList(newTracks, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 2);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 2);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 1);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 1);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
@@ -3725,20 +3873,20 @@ private Q_SLOTS:
                       QStringLiteral("artist4"), QStringLiteral("album3"), {}, 6, 1, QTime::fromMSecsSinceStartOfDay(19), {QUrl::fromLocalFile(QStringLiteral("/$19"))},
                       {QUrl::fromLocalFile(QStringLiteral("album3"))}, 5, true}};
 
-        musicDb.insertTracksList(newTracks2, newCovers, QStringLiteral("autoTest"));
+        musicDb.insertTracksList(tracksWithCovers(newTracks2, newCovers), QStringLiteral("autoTest"));
 
         musicDbTrackAddedSpy.wait(300);
 
         QCOMPARE(musicDb.allAlbums().count(), 1);
         QCOMPARE(musicDb.allArtists().count(), 2);
-        QCOMPARE(musicDbArtistAddedSpy.count(), 2);
-        QCOMPARE(musicDbAlbumAddedSpy.count(), 1);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistAddedSpy), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumAddedSpy), 1);
         QCOMPARE(musicDbTrackAddedSpy.count(), 2);
-        QCOMPARE(musicDbArtistRemovedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumRemovedSpy.count(), 0);
+        QCOMPARE(itemsCount<MusicArtist>(musicDbArtistRemovedSpy), 0);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumRemovedSpy), 0);
         QCOMPARE(musicDbTrackRemovedSpy.count(), 0);
         QCOMPARE(musicDbArtistModifiedSpy.count(), 0);
-        QCOMPARE(musicDbAlbumModifiedSpy.count(), 2);
+        QCOMPARE(itemsCount<MusicAlbum>(musicDbAlbumModifiedSpy), 2);
         QCOMPARE(musicDbTrackModifiedSpy.count(), 0);
         QCOMPARE(musicDbDatabaseErrorSpy.count(), 0);
 
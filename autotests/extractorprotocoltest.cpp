@@ -0,0 +1,125 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "extractor/extractorprotocol.h"
+
+#include "musicaudiotrack.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QTime>
+
+#include <QtTest>
+
+class ExtractorProtocolTests: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    ExtractorProtocolTests(QObject *parent = nullptr) : QObject(parent)
+    {
+    }
+
+private Q_SLOTS:
+
+    void requestRoundTrip()
+    {
+        const auto scanFile = QUrl::fromLocalFile(QStringLiteral("/music/artist/album/01 - title.flac"));
+
+        auto buffer = ExtractorProtocol::frame(ExtractorProtocol::encodeRequest(scanFile));
+
+        QByteArray payload;
+        QUrl decodedFile;
+
+        QCOMPARE(ExtractorProtocol::takeFrame(buffer, payload), true);
+        QCOMPARE(buffer.isEmpty(), true);
+        QCOMPARE(ExtractorProtocol::decodeRequest(payload, decodedFile), true);
+        QCOMPARE(decodedFile, scanFile);
+    }
+
+    void responseRoundTrip()
+    {
+        const auto track = MusicAudioTrack(true, QStringLiteral("$1"), QStringLiteral("0"), QStringLiteral("track1"),
+                                           QStringLiteral("artist1"), QStringLiteral("album1"), QStringLiteral("Various Artists"),
+                                           1, 2, QTime::fromMSecsSinceStartOfDay(1000), QUrl::fromLocalFile(QStringLiteral("/$1")),
+                                           QUrl::fromLocalFile(QStringLiteral("/cover.jpg")), 4, false);
+
+        auto buffer = ExtractorProtocol::frame(ExtractorProtocol::encodeResponse(track, 123456));
+
+        QByteArray payload;
+        MusicAudioTrack decodedTrack;
+        quint64 bytesRead = 0;
+
+        QCOMPARE(ExtractorProtocol::takeFrame(buffer, payload), true);
+        QCOMPARE(ExtractorProtocol::decodeResponse(payload, decodedTrack, bytesRead), true);
+        QCOMPARE(bytesRead, quint64(123456));
+        QCOMPARE(decodedTrack.isValid(), true);
+        QCOMPARE(decodedTrack, track);
+        QCOMPARE(decodedTrack.albumArtist(), track.albumArtist());
+        QCOMPARE(decodedTrack.discNumber(), 2);
+        QCOMPARE(decodedTrack.rating(), 4);
+        QCOMPARE(decodedTrack.isSingleDiscAlbum(), false);
+        QCOMPARE(decodedTrack.albumCover(), track.albumCover());
+    }
+
+    void partialAndConsecutiveFrames()
+    {
+        const auto firstFile = QUrl::fromLocalFile(QStringLiteral("/first.ogg"));
+        const auto secondFile = QUrl::fromLocalFile(QStringLiteral("/second.ogg"));
+
+        const auto &allData = ExtractorProtocol::frame(ExtractorProtocol::encodeRequest(firstFile)) +
+                ExtractorProtocol::frame(ExtractorProtocol::encodeRequest(secondFile));
+
+        QByteArray buffer = allData.left(3);
+        QByteArray payload;
+        QUrl decodedFile;
+
+        QCOMPARE(ExtractorProtocol::takeFrame(buffer, payload), false);
+
+        buffer = allData.left(allData.size() - 1);
+
+        QCOMPARE(ExtractorProtocol::takeFrame(buffer, payload), true);
+        QCOMPARE(ExtractorProtocol::decodeRequest(payload, decodedFile), true);
+        QCOMPARE(decodedFile, firstFile);
+        QCOMPARE(ExtractorProtocol::takeFrame(buffer, payload), false);
+
+        buffer.append(allData.right(1));
+
+        QCOMPARE(ExtractorProtocol::takeFrame(buffer, payload), true);
+        QCOMPARE(ExtractorProtocol::decodeRequest(payload, decodedFile), true);
+        QCOMPARE(decodedFile, secondFile);
+    }
+
+    void oversizedFrame()
+    {
+        QByteArray buffer("\xff\xff\xff\xff" "garbage", 11);
+        QByteArray payload;
+        QUrl decodedFile;
+
+        QCOMPARE(ExtractorProtocol::takeFrame(buffer, payload), true);
+        QCOMPARE(buffer.isEmpty(), true);
+        QCOMPARE(ExtractorProtocol::decodeRequest(payload, decodedFile), false);
+    }
+};
+
+QTEST_GUILESS_MAIN(ExtractorProtocolTests)
+
+
+#include "extractorprotocoltest.moc"
@@ -0,0 +1,104 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "indexingstatistics.h"
+
+#include <QObject>
+#include <QVariantMap>
+
+#include <QtTest>
+
+class IndexingStatisticsTests: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    IndexingStatisticsTests(QObject *parent = nullptr) : QObject(parent)
+    {
+    }
+
+private Q_SLOTS:
+
+    void emptyStatistics()
+    {
+        IndexingStatistics statistics;
+
+        QCOMPARE(statistics.count(IndexingStatistics::Extract), 0);
+        QCOMPARE(statistics.percentile(IndexingStatistics::Extract, 50), qint64(0));
+        QCOMPARE(statistics.maximum(IndexingStatistics::Extract), qint64(0));
+        QCOMPARE(statistics.filesCount(), 0);
+        QCOMPARE(statistics.bytesRead(), qint64(0));
+    }
+
+    void percentiles()
+    {
+        IndexingStatistics statistics;
+
+        for (int i = 1; i <= 1000; ++i) {
+            statistics.addDuration(IndexingStatistics::Extract, i);
+        }
+
+        QCOMPARE(statistics.count(IndexingStatistics::Extract), 1000);
+        QCOMPARE(statistics.count(IndexingStatistics::Walk), 0);
+        QCOMPARE(statistics.maximum(IndexingStatistics::Extract), qint64(1000));
+        QCOMPARE(statistics.totalDuration(IndexingStatistics::Extract), qint64(500500));
+
+        const auto median = statistics.percentile(IndexingStatistics::Extract, 50);
+        QVERIFY(median >= 500);
+        QVERIFY(median <= 600);
+
+        const auto highPercentile = statistics.percentile(IndexingStatistics::Extract, 95);
+        QVERIFY(highPercentile >= 950);
+        QVERIFY(highPercentile <= 1000);
+
+        QCOMPARE(statistics.percentile(IndexingStatistics::Extract, 100), qint64(1000));
+    }
+
+    void filesAndReset()
+    {
+        IndexingStatistics statistics;
+
+        statistics.addFiles(3, 3000);
+        statistics.addFiles(1, 24);
+        statistics.addDuration(IndexingStatistics::Commit, 42);
+
+        QCOMPARE(statistics.filesCount(), 4);
+        QCOMPARE(statistics.bytesRead(), qint64(3024));
+
+        auto otherStatistics = statistics;
+
+        statistics.reset();
+
+        QCOMPARE(statistics.filesCount(), 0);
+        QCOMPARE(statistics.count(IndexingStatistics::Commit), 0);
+        QCOMPARE(otherStatistics.filesCount(), 4);
+        QCOMPARE(otherStatistics.maximum(IndexingStatistics::Commit), qint64(42));
+
+        const auto &diagnostics = otherStatistics.toVariantMap();
+        QCOMPARE(diagnostics[QStringLiteral("files")].toInt(), 4);
+        QCOMPARE(diagnostics[QStringLiteral("commit")].toMap()[QStringLiteral("max")].toLongLong(), qint64(42));
+        QVERIFY(otherStatistics.summary().contains(QStringLiteral("commit 42/42/42us")));
+    }
+};
+
+QTEST_GUILESS_MAIN(IndexingStatisticsTests)
+
+
+#include "indexingstatisticstest.moc"
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "librarydiffworker.h"
+#include "alltracksmodel.h"
+#include "allalbumsmodel.h"
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+
+#include <QObject>
+#include <QList>
+#include <QString>
+#include <QCoreApplication>
+
+#include <QtTest>
+
+class LibraryDiffWorkerTests: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    static MusicAudioTrack buildTrack(int index)
+    {
+        auto result = MusicAudioTrack();
+
+        result.setValid(true);
+        result.setDatabaseId(index);
+        result.setTitle(QStringLiteral("track%1").arg(index));
+
+        return result;
+    }
+
+    static MusicAlbum buildAlbum(int index)
+    {
+        auto result = MusicAlbum();
+
+        result.setValid(true);
+        result.setDatabaseId(index);
+        result.setTitle(QStringLiteral("album%1").arg(index));
+
+        return result;
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<TracksModelDiff>("TracksModelDiff");
+        qRegisterMetaType<AlbumsModelDiff>("AlbumsModelDiff");
+    }
+
+    void coalesceTracksChanges()
+    {
+        LibraryDiffWorker diffWorker;
+        AllTracksModel tracksModel;
+
+        connect(&diffWorker, &LibraryDiffWorker::tracksChangesComputed,
+                &tracksModel, &AllTracksModel::applyChanges);
+
+        QSignalSpy tracksChangesSpy(&diffWorker, &LibraryDiffWorker::tracksChangesComputed);
+        QSignalSpy beginInsertRowsSpy(&tracksModel, &AllTracksModel::rowsAboutToBeInserted);
+        QSignalSpy beginRemoveRowsSpy(&tracksModel, &AllTracksModel::rowsAboutToBeRemoved);
+        QSignalSpy dataChangedSpy(&tracksModel, &AllTracksModel::dataChanged);
+
+        auto newTracks = QList<MusicAudioTrack>();
+        for (int i = 1; i <= 10; ++i) {
+            newTracks.push_back(buildTrack(i));
+        }
+
+        auto modifiedTrack = buildTrack(5);
+        modifiedTrack.setTitle(QStringLiteral("modified"));
+
+        diffWorker.tracksAdded(newTracks);
+        diffWorker.tracksRemoved({3, 4});
+        diffWorker.trackModified(modifiedTrack);
+        diffWorker.tracksAdded({buildTrack(11)});
+
+        QCOMPARE(tracksChangesSpy.count(), 0);
+
+        QCoreApplication::processEvents();
+
+        QCOMPARE(tracksChangesSpy.count(), 1);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(beginRemoveRowsSpy.count(), 0);
+        QCOMPARE(dataChangedSpy.count(), 0);
+
+        QCOMPARE(tracksModel.rowCount(), 9);
+        QCOMPARE(tracksModel.data(tracksModel.index(2, 0), AllTracksModel::TitleRole).toString(), QStringLiteral("modified"));
+        QCOMPARE(tracksModel.data(tracksModel.index(8, 0), AllTracksModel::DatabaseIdRole).toULongLong(), qulonglong(11));
+
+        modifiedTrack = buildTrack(8);
+        modifiedTrack.setTitle(QStringLiteral("modified"));
+
+        diffWorker.tracksRemoved({1, 2, 6});
+        diffWorker.trackModified(modifiedTrack);
+
+        QCoreApplication::processEvents();
+
+        QCOMPARE(tracksChangesSpy.count(), 2);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(beginRemoveRowsSpy.count(), 2);
+        QCOMPARE(beginRemoveRowsSpy.at(0).at(1).toInt(), 3);
+        QCOMPARE(beginRemoveRowsSpy.at(0).at(2).toInt(), 3);
+        QCOMPARE(beginRemoveRowsSpy.at(1).at(1).toInt(), 0);
+        QCOMPARE(beginRemoveRowsSpy.at(1).at(2).toInt(), 1);
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(dataChangedSpy.constFirst().constFirst().toModelIndex().row(), 2);
+
+        QCOMPARE(tracksModel.rowCount(), 6);
+
+        const auto remainingIds = QList<qulonglong>{5, 7, 8, 9, 10, 11};
+        for (int i = 0; i < remainingIds.size(); ++i) {
+            QCOMPARE(tracksModel.data(tracksModel.index(i, 0), AllTracksModel::DatabaseIdRole).toULongLong(), remainingIds[i]);
+        }
+        QCOMPARE(tracksModel.data(tracksModel.index(2, 0), AllTracksModel::TitleRole).toString(), QStringLiteral("modified"));
+    }
+
+    void directChangesAfterComputedChanges()
+    {
+        LibraryDiffWorker diffWorker;
+        AllTracksModel tracksModel;
+
+        connect(&diffWorker, &LibraryDiffWorker::tracksChangesComputed,
+                &tracksModel, &AllTracksModel::applyChanges);
+
+        QSignalSpy beginInsertRowsSpy(&tracksModel, &AllTracksModel::rowsAboutToBeInserted);
+        QSignalSpy dataChangedSpy(&tracksModel, &AllTracksModel::dataChanged);
+
+        diffWorker.tracksAdded({buildTrack(1), buildTrack(2), buildTrack(3), buildTrack(4), buildTrack(5)});
+
+        QCoreApplication::processEvents();
+
+        diffWorker.tracksRemoved({2});
+
+        QCoreApplication::processEvents();
+
+        QCOMPARE(tracksModel.rowCount(), 4);
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+
+        tracksModel.tracksAdded({buildTrack(3)});
+
+        QCOMPARE(beginInsertRowsSpy.count(), 1);
+        QCOMPARE(tracksModel.rowCount(), 4);
+
+        auto modifiedTrack = buildTrack(4);
+        modifiedTrack.setTitle(QStringLiteral("modified"));
+
+        tracksModel.trackModified(modifiedTrack);
+
+        QCOMPARE(dataChangedSpy.count(), 1);
+        QCOMPARE(dataChangedSpy.constFirst().constFirst().toModelIndex().row(), 2);
+        QCOMPARE(tracksModel.data(tracksModel.index(2, 0), AllTracksModel::TitleRole).toString(), QStringLiteral("modified"));
+    }
+
+    void removeAndAddAgainAlbum()
+    {
+        LibraryDiffWorker diffWorker;
+        AllAlbumsModel albumsModel;
+
+        connect(&diffWorker, &LibraryDiffWorker::albumsChangesComputed,
+                &albumsModel, &AllAlbumsModel::applyChanges);
+
+        QSignalSpy albumsChangesSpy(&diffWorker, &LibraryDiffWorker::albumsChangesComputed);
+        QSignalSpy albumCountChangedSpy(&albumsModel, &AllAlbumsModel::albumCountChanged);
+
+        diffWorker.albumsAdded({buildAlbum(1), buildAlbum(2), buildAlbum(3)});
+
+        QCoreApplication::processEvents();
+
+        QCOMPARE(albumsChangesSpy.count(), 1);
+        QCOMPARE(albumCountChangedSpy.count(), 1);
+        QCOMPARE(albumsModel.rowCount(), 3);
+
+        auto modifiedAlbum = buildAlbum(1);
+        modifiedAlbum.setTitle(QStringLiteral("modified"));
+
+        diffWorker.albumsRemoved({buildAlbum(1)});
+        diffWorker.albumsAdded({modifiedAlbum});
+
+        QCoreApplication::processEvents();
+
+        QCOMPARE(albumsChangesSpy.count(), 2);
+        QCOMPARE(albumCountChangedSpy.count(), 2);
+        QCOMPARE(albumsModel.rowCount(), 3);
+        QCOMPARE(albumsModel.data(albumsModel.index(0, 0), AllAlbumsModel::TitleRole).toString(), QStringLiteral("album2"));
+        QCOMPARE(albumsModel.data(albumsModel.index(2, 0), AllAlbumsModel::TitleRole).toString(), QStringLiteral("modified"));
+
+        diffWorker.albumsModified({buildAlbum(42)});
+
+        QCoreApplication::processEvents();
+
+        QCOMPARE(albumsChangesSpy.count(), 2);
+    }
+
+};
+
+QTEST_GUILESS_MAIN(LibraryDiffWorkerTests)
+
+
+#include "librarydiffworkertest.moc"
@@ -0,0 +1,248 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "librarysortfilterproxymodel.h"
+#include "alltracksmodel.h"
+#include "musicaudiotrack.h"
+
+#include <QObject>
+#include <QString>
+#include <QList>
+
+#include <QtTest>
+
+class LibrarySortFilterProxyModelTests: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    static MusicAudioTrack newTrack(qulonglong databaseId, const QString &albumArtist, const QString &albumName,
+                                    int discNumber, int trackNumber, const QString &title, int rating)
+    {
+        auto result = MusicAudioTrack();
+
+        result.setValid(true);
+        result.setDatabaseId(databaseId);
+        result.setAlbumArtist(albumArtist);
+        result.setArtist(albumArtist);
+        result.setAlbumName(albumName);
+        result.setDiscNumber(discNumber);
+        result.setTrackNumber(trackNumber);
+        result.setTitle(title);
+        result.setRating(rating);
+
+        return result;
+    }
+
+    static QList<qulonglong> proxyIds(const LibrarySortFilterProxyModel &proxyModel)
+    {
+        auto result = QList<qulonglong>();
+
+        for (int row = 0; row < proxyModel.rowCount(); ++row) {
+            result.push_back(proxyModel.data(proxyModel.index(row, 0), AllTracksModel::DatabaseIdRole).toULongLong());
+        }
+
+        return result;
+    }
+
+    QList<MusicAudioTrack> mNewTracks = {
+        newTrack(1, QStringLiteral("Zoé"), QStringLiteral("B"), 1, 2, QStringLiteral("Été"), 2),
+        newTrack(2, QStringLiteral("Alice"), QStringLiteral("A"), 1, 10, QStringLiteral("Night"), 4),
+        newTrack(3, QStringLiteral("Alice"), QStringLiteral("A"), 1, 2, QStringLiteral("Day"), 0),
+        newTrack(4, QStringLiteral("Bob"), QStringLiteral("C"), 2, 1, QStringLiteral("Élan"), 5),
+    };
+
+private Q_SLOTS:
+
+    void foldText()
+    {
+        QCOMPARE(LibrarySortFilterProxyModel::foldedText(QStringLiteral("Éléonore")), QStringLiteral("eleonore"));
+        QCOMPARE(LibrarySortFilterProxyModel::foldedText(QStringLiteral("STRASSE")), QStringLiteral("strasse"));
+        QCOMPARE(LibrarySortFilterProxyModel::foldedText(QStringLiteral("Ångström")), QStringLiteral("angstrom"));
+    }
+
+    void sortWithSeveralKeys()
+    {
+        AllTracksModel tracksModel;
+        LibrarySortFilterProxyModel proxyModel;
+
+        proxyModel.setSourceModel(&tracksModel);
+        proxyModel.setSortRoles({AllTracksModel::AlbumArtistRole, AllTracksModel::AlbumRole,
+                                 AllTracksModel::DiscNumberRole, AllTracksModel::TrackNumberRole});
+
+        tracksModel.tracksAdded(mNewTracks);
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({3, 2, 4, 1}));
+
+        tracksModel.tracksAdded({newTrack(5, QStringLiteral("Alice"), QStringLiteral("A"), 1, 3, QStringLiteral("Dusk"), 1)});
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({3, 5, 2, 4, 1}));
+
+        proxyModel.setSortRoles({});
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({1, 2, 3, 4, 5}));
+    }
+
+    void filterFoldedText()
+    {
+        AllTracksModel tracksModel;
+        LibrarySortFilterProxyModel proxyModel;
+
+        tracksModel.tracksAdded(mNewTracks);
+
+        proxyModel.setFilterRoles({AllTracksModel::TitleRole, AllTracksModel::ArtistRole});
+        proxyModel.setSortRoles({AllTracksModel::AlbumArtistRole});
+        proxyModel.setSourceModel(&tracksModel);
+
+        QCOMPARE(proxyModel.rowCount(), 4);
+
+        proxyModel.setFilterText(QStringLiteral("ete"));
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({1}));
+
+        proxyModel.setFilterText(QStringLiteral("ELAN"));
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({4}));
+
+        proxyModel.setFilterText(QStringLiteral("zoe"));
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({1}));
+
+        proxyModel.setFilterText(QStringLiteral("et"));
+
+        tracksModel.tracksAdded({newTrack(5, QStringLiteral("Aaron"), QStringLiteral("Z"), 1, 1, QStringLiteral("Ete bis"), 1)});
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({5, 1}));
+
+        tracksModel.trackModified(newTrack(5, QStringLiteral("Aaron"), QStringLiteral("Z"), 1, 1, QStringLiteral("Dawn"), 1));
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({1}));
+
+        tracksModel.tracksRemoved({1});
+
+        QCOMPARE(proxyModel.rowCount(), 0);
+
+        proxyModel.setFilterText({});
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({5, 2, 3, 4}));
+    }
+
+    void filterRating()
+    {
+        AllTracksModel tracksModel;
+        LibrarySortFilterProxyModel proxyModel;
+
+        proxyModel.setSourceModel(&tracksModel);
+        proxyModel.setRatingRole(AllTracksModel::RatingRole);
+
+        tracksModel.tracksAdded(mNewTracks);
+
+        QCOMPARE(proxyModel.rowCount(), 4);
+
+        proxyModel.setFilterRating(4);
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({2, 4}));
+
+        auto modifiedTrack = mNewTracks[0];
+        modifiedTrack.setRating(5);
+        tracksModel.trackModified(modifiedTrack);
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({1, 2, 4}));
+    }
+
+    void sectionIndex()
+    {
+        AllTracksModel tracksModel;
+        LibrarySortFilterProxyModel proxyModel;
+
+        proxyModel.setSourceModel(&tracksModel);
+        proxyModel.setSortRoles({AllTracksModel::AlbumArtistRole, AllTracksModel::AlbumRole});
+
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("A")), -1);
+
+        tracksModel.tracksAdded(mNewTracks);
+        tracksModel.tracksAdded({newTrack(5, QStringLiteral("Émile"), QStringLiteral("D"), 1, 1, QStringLiteral("Dawn"), 1),
+                                 newTrack(6, QStringLiteral("1990s"), QStringLiteral("E"), 1, 1, QStringLiteral("Dusk"), 1),
+                                 newTrack(7, QStringLiteral("Ångel"), QStringLiteral("F"), 1, 1, QStringLiteral("Noon"), 1)});
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({6, 2, 3, 7, 4, 5, 1}));
+        QCOMPARE(proxyModel.sections(), QStringList({QStringLiteral("#"), QStringLiteral("A"), QStringLiteral("B"),
+                                                     QStringLiteral("E"), QStringLiteral("Z")}));
+        QCOMPARE(proxyModel.data(proxyModel.index(3, 0), LibrarySortFilterProxyModel::SectionRole).toString(), QStringLiteral("A"));
+        QCOMPARE(proxyModel.data(proxyModel.index(5, 0), LibrarySortFilterProxyModel::SectionRole).toString(), QStringLiteral("E"));
+        QCOMPARE(proxyModel.roleNames().value(LibrarySortFilterProxyModel::SectionRole), QByteArray("section"));
+
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("#")), 0);
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("A")), 1);
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("B")), 4);
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("C")), 5);
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("Z")), 6);
+
+        QSignalSpy sectionsChangedSpy(&proxyModel, &LibrarySortFilterProxyModel::sectionsChanged);
+
+        tracksModel.tracksRemoved({4});
+
+        QCOMPARE(sectionsChangedSpy.count(), 1);
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("B")), 4);
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("E")), 4);
+
+        tracksModel.trackModified(newTrack(1, QStringLiteral("Adam"), QStringLiteral("B"), 1, 2, QStringLiteral("Été"), 2));
+
+        QCOMPARE(sectionsChangedSpy.count(), 2);
+        QCOMPARE(proxyModel.sections(), QStringList({QStringLiteral("#"), QStringLiteral("A"), QStringLiteral("E")}));
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("E")), 5);
+
+        tracksModel.tracksAdded({newTrack(8, QStringLiteral("Anna"), QStringLiteral("G"), 1, 1, QStringLiteral("Dusk"), 1)});
+
+        QCOMPARE(sectionsChangedSpy.count(), 2);
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("E")), 6);
+    }
+
+    void sectionsFollowTrimmedSortOrder()
+    {
+        AllTracksModel tracksModel;
+        LibrarySortFilterProxyModel proxyModel;
+
+        proxyModel.setSourceModel(&tracksModel);
+        proxyModel.setSortRoles({AllTracksModel::AlbumArtistRole});
+
+        QSignalSpy sectionsChangedSpy(&proxyModel, &LibrarySortFilterProxyModel::sectionsChanged);
+
+        tracksModel.tracksAdded({newTrack(1, QStringLiteral("  Zoé"), QStringLiteral("A"), 1, 1, QStringLiteral("Dawn"), 1),
+                                 newTrack(2, QStringLiteral("Bob"), QStringLiteral("B"), 1, 1, QStringLiteral("Dusk"), 1),
+                                 newTrack(3, QStringLiteral(" Alice"), QStringLiteral("C"), 1, 1, QStringLiteral("Noon"), 1)});
+
+        QCOMPARE(sectionsChangedSpy.count(), 0);
+
+        QCOMPARE(proxyIds(proxyModel), QList<qulonglong>({3, 2, 1}));
+        QCOMPARE(proxyModel.sections(), QStringList({QStringLiteral("A"), QStringLiteral("B"), QStringLiteral("Z")}));
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("Z")), 2);
+
+        tracksModel.tracksAdded({newTrack(4, QStringLiteral(" Carl"), QStringLiteral("D"), 1, 1, QStringLiteral("Dusk"), 1)});
+
+        QCOMPARE(sectionsChangedSpy.count(), 1);
+        QCOMPARE(proxyModel.sectionFirstRow(QStringLiteral("Z")), 3);
+    }
+};
+
+QTEST_GUILESS_MAIN(LibrarySortFilterProxyModelTests)
+
+
+#include "librarysortfilterproxymodeltest.moc"
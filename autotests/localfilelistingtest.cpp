@@ -32,6 +32,7 @@
 #include <QStandardPaths>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
 
 #include <QDebug>
 
@@ -58,6 +59,7 @@ private Q_SLOTS:
     {
         qRegisterMetaType<QHash<qulonglong,int>>("QHash<qulonglong,int>");
         qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
+        qRegisterMetaType<QHash<QUrl,QUrl>>("QHash<QUrl,QUrl>");
         qRegisterMetaType<QList<MusicAudioTrack>>("QList<MusicAudioTrack>");
         qRegisterMetaType<QVector<qlonglong>>("QVector<qlonglong>");
         qRegisterMetaType<QHash<qlonglong,int>>("QHash<qlonglong,int>");
@@ -133,10 +135,11 @@ private Q_SLOTS:
 
         auto newTracksSignal = tracksListSpy.at(0);
         auto newTracks = newTracksSignal.at(0).value<QList<MusicAudioTrack>>();
-        auto newCovers = newTracksSignal.at(1).value<QHash<QString, QUrl>>();
 
         QCOMPARE(newTracks.count(), 3);
-        QCOMPARE(newCovers.count(), 3);
+        for (const auto &oneTrack : newTracks) {
+            QCOMPARE(oneTrack.albumCover().fileName(), QStringLiteral("cover.jpg"));
+        }
     }
 
     void addAndRemoveTracks()
@@ -195,10 +198,9 @@ private Q_SLOTS:
 
         auto newTracksSignal = tracksListSpy.at(0);
         auto newTracks = newTracksSignal.at(0).value<QList<MusicAudioTrack>>();
-        auto newCovers = newTracksSignal.at(1).value<QHash<QString, QUrl>>();
 
         QCOMPARE(newTracks.count(), 1);
-        QCOMPARE(newCovers.count(), 1);
+        QCOMPARE(newTracks.first().albumCover().fileName(), QStringLiteral("cover.jpg"));
 
         QString commandLine(QStringLiteral("rm -rf ") + musicPath);
         system(commandLine.toLatin1().data());
@@ -227,10 +229,9 @@ private Q_SLOTS:
 
         auto newTracksSignalLast = tracksListSpy.at(1);
         auto newTracksLast = newTracksSignalLast.at(0).value<QList<MusicAudioTrack>>();
-        auto newCoversLast = newTracksSignalLast.at(1).value<QHash<QString, QUrl>>();
 
         QCOMPARE(newTracksLast.count(), 1);
-        QCOMPARE(newCoversLast.count(), 1);
+        QCOMPARE(newTracksLast.first().albumCover().fileName(), QStringLiteral("cover.jpg"));
     }
 
     void addTracksAndRemoveDirectory()
@@ -291,10 +292,9 @@ private Q_SLOTS:
 
         auto newTracksSignal = tracksListSpy.at(0);
         auto newTracks = newTracksSignal.at(0).value<QList<MusicAudioTrack>>();
-        auto newCovers = newTracksSignal.at(1).value<QHash<QString, QUrl>>();
 
         QCOMPARE(newTracks.count(), 1);
-        QCOMPARE(newCovers.count(), 1);
+        QCOMPARE(newTracks.first().albumCover().fileName(), QStringLiteral("cover.jpg"));
 
         QString commandLine(QStringLiteral("rm -rf ") + innerMusicPath);
         system(commandLine.toLatin1().data());
@@ -323,10 +323,9 @@ private Q_SLOTS:
 
         auto newTracksSignalLast = tracksListSpy.at(1);
         auto newTracksLast = newTracksSignalLast.at(0).value<QList<MusicAudioTrack>>();
-        auto newCoversLast = newTracksSignalLast.at(1).value<QHash<QString, QUrl>>();
 
         QCOMPARE(newTracksLast.count(), 1);
-        QCOMPARE(newCoversLast.count(), 1);
+        QCOMPARE(newTracksLast.first().albumCover().fileName(), QStringLiteral("cover.jpg"));
     }
 
     void addAndMoveTracks()
@@ -397,10 +396,9 @@ private Q_SLOTS:
 
         auto newTracksSignal = tracksListSpy.at(0);
         auto newTracks = newTracksSignal.at(0).value<QList<MusicAudioTrack>>();
-        auto newCovers = newTracksSignal.at(1).value<QHash<QString, QUrl>>();
 
         QCOMPARE(newTracks.count(), 1);
-        QCOMPARE(newCovers.count(), 1);
+        QCOMPARE(newTracks.first().albumCover().fileName(), QStringLiteral("cover.jpg"));
 
         QString commandLine(QStringLiteral("mv ") + musicPath + QStringLiteral(" ") + musicFriendPath);
         system(commandLine.toLatin1().data());
@@ -432,10 +430,212 @@ private Q_SLOTS:
 
         auto newTracksSignalLast = tracksListSpy.at(1);
         auto newTracksLast = newTracksSignalLast.at(0).value<QList<MusicAudioTrack>>();
-        auto newCoversLast = newTracksSignalLast.at(1).value<QHash<QString, QUrl>>();
 
         QCOMPARE(newTracksLast.count(), 1);
-        QCOMPARE(newCoversLast.count(), 1);
+        QCOMPARE(newTracksLast.first().albumCover().fileName(), QStringLiteral("cover.jpg"));
+    }
+
+    void addAndRenameDirectory()
+    {
+        LocalFileListing myListing;
+
+        QString musicOriginPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music2/data/innerData");
+        QDir musicDirectory(musicPath);
+
+        QString renamedMusicPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music2/data/renamedData");
+
+        QString musicParentPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music2");
+        QDir musicParentDirectory(musicParentPath);
+
+        QCOMPARE(musicParentDirectory.removeRecursively(), true);
+
+        musicDirectory.mkpath(musicPath);
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+        QSignalSpy renamedTracksListSpy(&myListing, &LocalFileListing::renamedTracksList);
+
+        myListing.init();
+
+        myListing.setRootPath(musicParentPath);
+
+        myListing.refreshContent();
+
+        QFile myTrack(musicOriginPath + QStringLiteral("/test.ogg"));
+        myTrack.copy(musicPath + QStringLiteral("/test.ogg"));
+        QFile myCover(musicOriginPath + QStringLiteral("/cover.jpg"));
+        myCover.copy(musicPath + QStringLiteral("/cover.jpg"));
+
+        QCOMPARE(tracksListSpy.wait(), true);
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+        QCOMPARE(renamedTracksListSpy.count(), 0);
+
+        const auto &canonicalMusicPath = QFileInfo(musicPath).canonicalFilePath();
+
+        QCOMPARE(QDir().rename(musicPath, renamedMusicPath), true);
+
+        const auto &canonicalRenamedMusicPath = QFileInfo(renamedMusicPath).canonicalFilePath();
+
+        QCOMPARE(renamedTracksListSpy.wait(), true);
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+        QCOMPARE(renamedTracksListSpy.count(), 1);
+
+        auto renamedTracks = renamedTracksListSpy.at(0).at(0).value<QHash<QUrl, QUrl>>();
+
+        QCOMPARE(renamedTracks.value(QUrl::fromLocalFile(canonicalMusicPath + QStringLiteral("/test.ogg"))),
+                 QUrl::fromLocalFile(canonicalRenamedMusicPath + QStringLiteral("/test.ogg")));
+        QCOMPARE(renamedTracks.value(QUrl::fromLocalFile(canonicalMusicPath + QStringLiteral("/cover.jpg"))),
+                 QUrl::fromLocalFile(canonicalRenamedMusicPath + QStringLiteral("/cover.jpg")));
+
+        QCOMPARE(removedTracksListSpy.wait(1500), false);
+        QCOMPARE(tracksListSpy.count(), 1);
+    }
+
+    void pollingDetectsNewTracks()
+    {
+        LocalFileListing myListing;
+
+        QString musicOriginPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music2/data/innerData");
+        QDir musicDirectory(musicPath);
+
+        QString musicParentPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music2");
+        QDir musicParentDirectory(musicParentPath);
+
+        QCOMPARE(musicParentDirectory.removeRecursively(), true);
+
+        musicDirectory.mkpath(musicPath);
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+
+        myListing.init();
+
+        myListing.setRootPath(musicParentPath);
+        myListing.setForcePolling(true);
+        myListing.setPollingInterval(300);
+        myListing.setPollingJitter(0);
+
+        myListing.refreshContent();
+
+        QCOMPARE(tracksListSpy.count(), 0);
+
+        QFile myTrack(musicOriginPath + QStringLiteral("/test.ogg"));
+        QCOMPARE(myTrack.copy(musicPath + QStringLiteral("/test.ogg")), true);
+
+        QCOMPARE(tracksListSpy.wait(), true);
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+
+        QCOMPARE(QFile::remove(musicPath + QStringLiteral("/test.ogg")), true);
+
+        QCOMPARE(removedTracksListSpy.wait(), true);
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(removedTracksListSpy.count(), 1);
+    }
+
+    void pollingDetectsMovedDirectory()
+    {
+        LocalFileListing myListing;
+
+        QString musicOriginPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QString musicParentPath = QStringLiteral(LOCAL_FILE_TESTS_WORKING_PATH) + QStringLiteral("/music2");
+        QDir musicParentDirectory(musicParentPath);
+
+        QString musicPath = musicParentPath + QStringLiteral("/z/innerData");
+        QString movedMusicPath = musicParentPath + QStringLiteral("/a/innerData");
+
+        QCOMPARE(musicParentDirectory.removeRecursively(), true);
+
+        QCOMPARE(QDir().mkpath(musicPath), true);
+        QCOMPARE(QDir().mkpath(musicParentPath + QStringLiteral("/a")), true);
+
+        QCOMPARE(QFile::copy(musicOriginPath + QStringLiteral("/test.ogg"), musicPath + QStringLiteral("/test.ogg")), true);
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy removedTracksListSpy(&myListing, &LocalFileListing::removedTracksList);
+        QSignalSpy renamedTracksListSpy(&myListing, &LocalFileListing::renamedTracksList);
+
+        myListing.init();
+
+        myListing.setRootPath(musicParentPath);
+        myListing.setForcePolling(true);
+        myListing.setPollingInterval(300);
+        myListing.setPollingJitter(0);
+
+        myListing.refreshContent();
+
+        if (tracksListSpy.count() == 0) {
+            QCOMPARE(tracksListSpy.wait(), true);
+        }
+
+        QCOMPARE(tracksListSpy.count(), 1);
+
+        const auto &canonicalMusicPath = QFileInfo(musicPath).canonicalFilePath();
+
+        QCOMPARE(QDir().rename(musicPath, movedMusicPath), true);
+
+        const auto &canonicalMovedMusicPath = QFileInfo(movedMusicPath).canonicalFilePath();
+
+        QCOMPARE(renamedTracksListSpy.wait(), true);
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(removedTracksListSpy.count(), 0);
+        QCOMPARE(renamedTracksListSpy.count(), 1);
+
+        auto renamedTracks = renamedTracksListSpy.at(0).at(0).value<QHash<QUrl, QUrl>>();
+
+        QCOMPARE(renamedTracks.value(QUrl::fromLocalFile(canonicalMusicPath + QStringLiteral("/test.ogg"))),
+                 QUrl::fromLocalFile(canonicalMovedMusicPath + QStringLiteral("/test.ogg")));
+    }
+
+    void pendingBatchesAndAdaptiveBatchSize()
+    {
+        LocalFileListing myListing;
+
+        QString musicPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        QSignalSpy tracksListSpy(&myListing, &LocalFileListing::tracksList);
+        QSignalSpy pendingBatchesCountChangedSpy(&myListing, &LocalFileListing::pendingBatchesCountChanged);
+        QSignalSpy batchSizeChangedSpy(&myListing, &LocalFileListing::batchSizeChanged);
+
+        myListing.setMaximumPendingBatches(1);
+
+        QCOMPARE(myListing.pendingBatchesCount(), 0);
+        QCOMPARE(myListing.batchSize(), 500);
+
+        myListing.init();
+        myListing.setRootPath(musicPath);
+        myListing.refreshContent();
+
+        QCOMPARE(tracksListSpy.count(), 1);
+        QCOMPARE(pendingBatchesCountChangedSpy.count(), 1);
+        QCOMPARE(myListing.pendingBatchesCount(), 1);
+
+        myListing.tracksListCommitted(500, 2000);
+
+        QCOMPARE(pendingBatchesCountChangedSpy.count(), 2);
+        QCOMPARE(myListing.pendingBatchesCount(), 0);
+        QCOMPARE(batchSizeChangedSpy.count(), 1);
+        QVERIFY(myListing.batchSize() < 500);
+
+        const auto reducedBatchSize = myListing.batchSize();
+
+        myListing.tracksListCommitted(reducedBatchSize, 1);
+
+        QCOMPARE(myListing.pendingBatchesCount(), 0);
+        QCOMPARE(batchSizeChangedSpy.count(), 2);
+        QVERIFY(myListing.batchSize() > reducedBatchSize);
     }
 };
 
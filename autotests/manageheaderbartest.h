@@ -129,23 +129,6 @@ private:
          {QUrl::fromLocalFile(QStringLiteral("file://image$10"))}, 5, true}
     };
 
-    QHash<QString, QUrl> mNewCovers = {
-        {QStringLiteral("file:///$1"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("file:///$2"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("file:///$3"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("file:///$4"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("file:///$4Bis"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("file:///$5"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("file:///$6"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("file:///$7"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("file:///$8"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("file:///$9"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("file:///$0"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("file:///$11"), QUrl::fromLocalFile(QStringLiteral("album3"))},
-        {QStringLiteral("file:///$12"), QUrl::fromLocalFile(QStringLiteral("album3"))},
-        {QStringLiteral("file:///$13"), QUrl::fromLocalFile(QStringLiteral("album3"))},
-    };
-
 };
 
 #endif // MANAGEHEADERBARTEST_H
@@ -105,11 +105,6 @@ private:
          {QUrl::fromLocalFile(QStringLiteral("file://image$10"))}, 5, true}
     };
 
-    QHash<QString, QUrl> mNewCovers = {
-        {QStringLiteral("album1"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("album2"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-    };
-
 };
 
 #endif // MANAGEMEDIAPLAYERCONTROLTEST_H
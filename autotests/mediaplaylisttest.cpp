@@ -27,11 +27,15 @@
 #include "trackslistener.h"
 
 #include <QtTest>
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+#include <QAbstractItemModelTester>
+#endif
 #include <QStandardItemModel>
 #include <QStandardItem>
 #include <QUrl>
 #include <QTime>
 #include <QTemporaryFile>
+#include <QTemporaryDir>
 
 MediaPlayListTest::MediaPlayListTest(QObject *parent) : QObject(parent)
 {
@@ -130,11 +134,6 @@ void MediaPlayListTest::initTestCase()
     {QUrl::fromLocalFile(QStringLiteral("file://image$22"))}, 9, true},
     };
 
-    mNewCovers[QStringLiteral("album1")] = QUrl::fromLocalFile(QStringLiteral("album1"));
-    mNewCovers[QStringLiteral("album2")] = QUrl::fromLocalFile(QStringLiteral("album2"));
-    mNewCovers[QStringLiteral("album3")] = QUrl::fromLocalFile(QStringLiteral("album3"));
-    mNewCovers[QStringLiteral("album4")] = QUrl::fromLocalFile(QStringLiteral("album4"));
-
     qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
     qRegisterMetaType<QHash<QString,QVector<MusicAudioTrack>>>("QHash<QString,QVector<MusicAudioTrack>>");
     qRegisterMetaType<QVector<qlonglong>>("QVector<qlonglong>");
@@ -198,7 +197,7 @@ void MediaPlayListTest::simpleInitialCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -264,6 +263,7 @@ void MediaPlayListTest::enqueueAlbumCase()
     QSignalSpy persistentStateChangedSpy(&myPlayList, &MediaPlayList::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
     QSignalSpy newTrackByIdInListSpy(&myPlayList, &MediaPlayList::newTrackByIdInList);
+    QSignalSpy newTracksByIdInListSpy(&myPlayList, &MediaPlayList::newTracksByIdInList);
     QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
     QSignalSpy newTrackByFileNameInListSpy(&myPlayList, &MediaPlayList::newTrackByFileNameInList);
     QSignalSpy newArtistInListSpy(&myPlayList, &MediaPlayList::newArtistInList);
@@ -305,7 +305,7 @@ void MediaPlayListTest::enqueueAlbumCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -325,14 +325,15 @@ void MediaPlayListTest::enqueueAlbumCase()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 6);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 0);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 6);
-    QCOMPARE(trackHasBeenAddedSpy.count(), 6);
-    QCOMPARE(persistentStateChangedSpy.count(), 6);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(trackHasBeenAddedSpy.count(), 1);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByIdInListSpy.count(), 6);
+    QCOMPARE(newTrackByIdInListSpy.count(), 0);
+    QCOMPARE(newTracksByIdInListSpy.count(), 1);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
@@ -434,7 +435,7 @@ void MediaPlayListTest::enqueueArtistCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -540,6 +541,7 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     QSignalSpy persistentStateChangedSpy(&myPlayList, &MediaPlayList::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
     QSignalSpy newTrackByIdInListSpy(&myPlayList, &MediaPlayList::newTrackByIdInList);
+    QSignalSpy newTracksByIdInListSpy(&myPlayList, &MediaPlayList::newTracksByIdInList);
     QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
     QSignalSpy newTrackByFileNameInListSpy(&myPlayList, &MediaPlayList::newTrackByFileNameInList);
     QSignalSpy newArtistInListSpy(&myPlayList, &MediaPlayList::newArtistInList);
@@ -581,7 +583,7 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -601,14 +603,15 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 6);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 0);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 6);
-    QCOMPARE(trackHasBeenAddedSpy.count(), 6);
-    QCOMPARE(persistentStateChangedSpy.count(), 6);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(trackHasBeenAddedSpy.count(), 1);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
     QCOMPARE(dataChangedSpy.count(), 0);
-    QCOMPARE(newTrackByIdInListSpy.count(), 6);
+    QCOMPARE(newTrackByIdInListSpy.count(), 0);
+    QCOMPARE(newTracksByIdInListSpy.count(), 1);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
@@ -624,14 +627,15 @@ void MediaPlayListTest::removeFirstTrackOfAlbum()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 1);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 6);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 1);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 6);
-    QCOMPARE(trackHasBeenAddedSpy.count(), 6);
-    QCOMPARE(persistentStateChangedSpy.count(), 7);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(trackHasBeenAddedSpy.count(), 1);
+    QCOMPARE(persistentStateChangedSpy.count(), 2);
     QCOMPARE(dataChangedSpy.count(), 1);
-    QCOMPARE(newTrackByIdInListSpy.count(), 6);
+    QCOMPARE(newTrackByIdInListSpy.count(), 0);
+    QCOMPARE(newTracksByIdInListSpy.count(), 1);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
@@ -700,7 +704,7 @@ void MediaPlayListTest::testHasHeader()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -1038,7 +1042,7 @@ void MediaPlayListTest::testHasHeaderWithRestore()
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(dataChangedSpy.wait(), true);
     QCOMPARE(dataChangedSpy.wait(), true);
@@ -1145,7 +1149,7 @@ void MediaPlayListTest::testHasHeaderWithRemove()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -1404,7 +1408,7 @@ void MediaPlayListTest::testHasHeaderMoveFirst()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -1657,7 +1661,7 @@ void MediaPlayListTest::testHasHeaderMoveAnother()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -1910,7 +1914,7 @@ void MediaPlayListTest::testHasHeaderMoveFirstLikeQml()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -2163,7 +2167,7 @@ void MediaPlayListTest::testHasHeaderMoveAnotherLikeQml()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -2416,7 +2420,7 @@ void MediaPlayListTest::testHasHeaderYetAnotherMoveLikeQml()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -2661,6 +2665,7 @@ void MediaPlayListTest::enqueueClearAndEnqueue()
     QSignalSpy persistentStateChangedSpy(&myPlayList, &MediaPlayList::persistentStateChanged);
     QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
     QSignalSpy newTrackByIdInListSpy(&myPlayList, &MediaPlayList::newTrackByIdInList);
+    QSignalSpy newTracksByIdInListSpy(&myPlayList, &MediaPlayList::newTracksByIdInList);
     QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
     QSignalSpy newTrackByFileNameInListSpy(&myPlayList, &MediaPlayList::newTrackByFileNameInList);
     QSignalSpy newArtistInListSpy(&myPlayList, &MediaPlayList::newArtistInList);
@@ -2702,7 +2707,7 @@ void MediaPlayListTest::enqueueClearAndEnqueue()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -2802,14 +2807,15 @@ void MediaPlayListTest::enqueueClearAndEnqueue()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 1);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 6);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 3);
     QCOMPARE(rowsRemovedSpy.count(), 1);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 6);
-    QCOMPARE(trackHasBeenAddedSpy.count(), 6);
-    QCOMPARE(persistentStateChangedSpy.count(), 6);
+    QCOMPARE(rowsInsertedSpy.count(), 3);
+    QCOMPARE(trackHasBeenAddedSpy.count(), 3);
+    QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 2);
-    QCOMPARE(newTrackByIdInListSpy.count(), 6);
+    QCOMPARE(newTrackByIdInListSpy.count(), 2);
+    QCOMPARE(newTracksByIdInListSpy.count(), 1);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
@@ -2900,7 +2906,7 @@ void MediaPlayListTest::crashOnEnqueue()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -3086,7 +3092,7 @@ void MediaPlayListTest::restoreMultipleIdenticalTracks()
     QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), false);
     QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::HasAlbumHeader).toBool(), false);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -3206,7 +3212,7 @@ void MediaPlayListTest::testHasHeaderAlbumWithSameTitle()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -3486,6 +3492,7 @@ void MediaPlayListTest::testSavePersistentState()
     QSignalSpy dataChangedSpyRead(&myPlayListRead, &MediaPlayList::dataChanged);
     QSignalSpy newTrackByIdInListSpyRead(&myPlayListRead, &MediaPlayList::newTrackByIdInList);
     QSignalSpy newTrackByNameInListSpyRead(&myPlayListRead, &MediaPlayList::newTrackByNameInList);
+    QSignalSpy newTracksByNameInListSpyRead(&myPlayListRead, &MediaPlayList::newTracksByNameInList);
     QSignalSpy newTrackByFileNameInListSpyRead(&myPlayListRead, &MediaPlayList::newTrackByFileNameInList);
     QSignalSpy newArtistInListSpyRead(&myPlayListRead, &MediaPlayList::newArtistInList);
 
@@ -3548,6 +3555,9 @@ void MediaPlayListTest::testSavePersistentState()
     connect(&myPlayListRead, &MediaPlayList::newTrackByNameInList,
             &myListenerRead, &TracksListener::trackByNameInList,
             Qt::QueuedConnection);
+    connect(&myPlayListRead, &MediaPlayList::newTracksByNameInList,
+            &myListenerRead, &TracksListener::tracksByNameInList,
+            Qt::QueuedConnection);
     connect(&myPlayListRead, &MediaPlayList::newTrackByFileNameInList,
             &myListenerRead, &TracksListener::trackByFileNameInList,
             Qt::QueuedConnection);
@@ -3557,7 +3567,7 @@ void MediaPlayListTest::testSavePersistentState()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListenerRead, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpySave.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpySave.count(), 0);
@@ -3815,15 +3825,16 @@ void MediaPlayListTest::testSavePersistentState()
     QCOMPARE(newArtistInListSpySave.count(), 0);
     QCOMPARE(rowsAboutToBeRemovedSpyRead.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpyRead.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpyRead.count(), 3);
+    QCOMPARE(rowsAboutToBeInsertedSpyRead.count(), 1);
     QCOMPARE(rowsRemovedSpyRead.count(), 0);
     QCOMPARE(rowsMovedSpyRead.count(), 0);
-    QCOMPARE(rowsInsertedSpyRead.count(), 3);
-    QCOMPARE(trackHasBeenAddedSpyRead.count(), 3);
-    QCOMPARE(persistentStateChangedSpyRead.count(), 4);
-    QCOMPARE(dataChangedSpyRead.count(), 6);
+    QCOMPARE(rowsInsertedSpyRead.count(), 1);
+    QCOMPARE(trackHasBeenAddedSpyRead.count(), 1);
+    QCOMPARE(persistentStateChangedSpyRead.count(), 2);
+    QCOMPARE(dataChangedSpyRead.count(), 4);
     QCOMPARE(newTrackByIdInListSpyRead.count(), 0);
-    QCOMPARE(newTrackByNameInListSpyRead.count(), 3);
+    QCOMPARE(newTrackByNameInListSpyRead.count(), 0);
+    QCOMPARE(newTracksByNameInListSpyRead.count(), 1);
     QCOMPARE(newArtistInListSpyRead.count(), 0);
 
     QCOMPARE(myPlayListRead.tracksCount(), 3);
@@ -3926,7 +3937,7 @@ void MediaPlayListTest::testClearAndEnqueueArtist()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -4096,7 +4107,7 @@ void MediaPlayListTest::testClearAndEnqueueTrackId()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -4276,7 +4287,7 @@ void MediaPlayListTest::testClearAndEnqueueTrackData()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -4432,7 +4443,7 @@ void MediaPlayListTest::testSetData()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -4694,7 +4705,7 @@ void MediaPlayListTest::testRemoveSelection()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -4789,14 +4800,14 @@ void MediaPlayListTest::testRemoveSelection()
 
     myPlayList.removeSelection({2, 4, 5});
 
-    QCOMPARE(rowsAboutToBeRemovedSpy.count(), 3);
+    QCOMPARE(rowsAboutToBeRemovedSpy.count(), 2);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeInsertedSpy.count(), 2);
-    QCOMPARE(rowsRemovedSpy.count(), 3);
+    QCOMPARE(rowsRemovedSpy.count(), 2);
     QCOMPARE(rowsMovedSpy.count(), 0);
     QCOMPARE(rowsInsertedSpy.count(), 2);
     QCOMPARE(trackHasBeenAddedSpy.count(), 0);
-    QCOMPARE(persistentStateChangedSpy.count(), 5);
+    QCOMPARE(persistentStateChangedSpy.count(), 3);
     QCOMPARE(dataChangedSpy.count(), 1);
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
@@ -4885,7 +4896,7 @@ void MediaPlayListTest::testTrackBeenRemoved()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -5097,7 +5108,7 @@ void MediaPlayListTest::testBringUpCase()
     QCOMPARE(repeatPlayChangedSpy.count(), 0);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5160,7 +5171,7 @@ void MediaPlayListTest::testBringUpCaseFromNewAlbum()
     QCOMPARE(repeatPlayChangedSpy.count(), 0);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5218,7 +5229,7 @@ void MediaPlayListTest::testBringUpAndDownCase()
     QCOMPARE(repeatPlayChangedSpy.count(), 0);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5285,7 +5296,7 @@ void MediaPlayListTest::testBringUpAndRemoveCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5352,7 +5363,7 @@ void MediaPlayListTest::testBringUpAndRemoveMultipleCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5426,7 +5437,7 @@ void MediaPlayListTest::testBringUpAndRemoveMultipleNotBeginCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5516,7 +5527,7 @@ void MediaPlayListTest::testBringUpAndPlayCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5584,7 +5595,7 @@ void MediaPlayListTest::testBringUpAndSkipNextCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5652,7 +5663,7 @@ void MediaPlayListTest::testBringUpAndSkipPreviousCase()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5741,7 +5752,7 @@ void MediaPlayListTest::testBringUpAndSkipPreviousAndContinueCase()
     QCOMPARE(repeatPlayChangedSpy.count(), 1);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5903,7 +5914,7 @@ void MediaPlayListTest::finishPlayList()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -5980,7 +5991,7 @@ void MediaPlayListTest::randomPlayList()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -6093,7 +6104,7 @@ void MediaPlayListTest::randomAndContinuePlayList()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -6215,7 +6226,7 @@ void MediaPlayListTest::continuePlayList()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -6347,7 +6358,7 @@ void MediaPlayListTest::testRestoreSettings()
     QCOMPARE(repeatPlayChangedSpy.count(), 1);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     myPlayList.enqueue({QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album2"), 1, 1});
     myPlayList.enqueue({QStringLiteral("track3"), QStringLiteral("artist3"), QStringLiteral("album1"), 3, 3});
@@ -6443,7 +6454,7 @@ void MediaPlayListTest::testSaveAndRestoreSettings()
     QCOMPARE(repeatPlayChangedRestoreSpy.count(), 0);
     QCOMPARE(playListFinishedRestoreSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSaveSpy.count(), 0);
     QCOMPARE(randomPlayChangedSaveSpy.count(), 0);
@@ -6581,7 +6592,7 @@ void MediaPlayListTest::removeBeforeCurrentTrack()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -6676,7 +6687,7 @@ void MediaPlayListTest::switchToTrackTest()
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -6752,7 +6763,7 @@ void MediaPlayListTest::singleTrack()
     QCOMPARE(repeatPlayChangedSpy.count(), 0);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -6824,7 +6835,7 @@ void MediaPlayListTest::testBringUpAndRemoveLastCase()
     QCOMPARE(repeatPlayChangedSpy.count(), 0);
     QCOMPARE(playListFinishedSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSpy.count(), 0);
     QCOMPARE(randomPlayChangedSpy.count(), 0);
@@ -6970,7 +6981,7 @@ void MediaPlayListTest::testSaveLoadPlayList()
     QCOMPARE(playListLoadedRestoreSpy.count(), 0);
     QCOMPARE(playListLoadFailedRestoreSpy.count(), 0);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(currentTrackChangedSaveSpy.count(), 0);
     QCOMPARE(randomPlayChangedSaveSpy.count(), 0);
@@ -7089,6 +7100,7 @@ void MediaPlayListTest::testEnqueueFiles()
     QSignalSpy newTrackByIdInListSpy(&myPlayList, &MediaPlayList::newTrackByIdInList);
     QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
     QSignalSpy newTrackByFileNameInListSpy(&myPlayList, &MediaPlayList::newTrackByFileNameInList);
+    QSignalSpy newTracksByFileNameInListSpy(&myPlayList, &MediaPlayList::newTracksByFileNameInList);
     QSignalSpy newArtistInListSpy(&myPlayList, &MediaPlayList::newArtistInList);
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
@@ -7103,6 +7115,7 @@ void MediaPlayListTest::testEnqueueFiles()
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -7122,13 +7135,16 @@ void MediaPlayListTest::testEnqueueFiles()
     connect(&myPlayList, &MediaPlayList::newTrackByFileNameInList,
             &myListener, &TracksListener::trackByFileNameInList,
             Qt::QueuedConnection);
+    connect(&myPlayList, &MediaPlayList::newTracksByFileNameInList,
+            &myListener, &TracksListener::tracksByFileNameInList,
+            Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -7142,22 +7158,24 @@ void MediaPlayListTest::testEnqueueFiles()
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
     myPlayList.enqueue({QStringLiteral("/$1"), QStringLiteral("/$2")});
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 2);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 0);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 2);
-    QCOMPARE(trackHasBeenAddedSpy.count(), 2);
-    QCOMPARE(persistentStateChangedSpy.count(), 2);
-    QCOMPARE(dataChangedSpy.count(), 2);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(trackHasBeenAddedSpy.count(), 1);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
+    QCOMPARE(dataChangedSpy.count(), 1);
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
-    QCOMPARE(newTrackByFileNameInListSpy.count(), 2);
+    QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByFileNameInListSpy.count(), 1);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
     QCOMPARE(myPlayList.rowCount(), 2);
@@ -7166,16 +7184,17 @@ void MediaPlayListTest::testEnqueueFiles()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 2);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 0);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 2);
-    QCOMPARE(trackHasBeenAddedSpy.count(), 2);
-    QCOMPARE(persistentStateChangedSpy.count(), 2);
-    QCOMPARE(dataChangedSpy.count(), 4);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(trackHasBeenAddedSpy.count(), 1);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
+    QCOMPARE(dataChangedSpy.count(), 3);
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
-    QCOMPARE(newTrackByFileNameInListSpy.count(), 2);
+    QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByFileNameInListSpy.count(), 1);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
@@ -7210,6 +7229,7 @@ void MediaPlayListTest::testEnqueueSampleFiles()
     QSignalSpy newTrackByIdInListSpy(&myPlayList, &MediaPlayList::newTrackByIdInList);
     QSignalSpy newTrackByNameInListSpy(&myPlayList, &MediaPlayList::newTrackByNameInList);
     QSignalSpy newTrackByFileNameInListSpy(&myPlayList, &MediaPlayList::newTrackByFileNameInList);
+    QSignalSpy newTracksByFileNameInListSpy(&myPlayList, &MediaPlayList::newTracksByFileNameInList);
     QSignalSpy newArtistInListSpy(&myPlayList, &MediaPlayList::newArtistInList);
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
@@ -7224,6 +7244,7 @@ void MediaPlayListTest::testEnqueueSampleFiles()
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
     myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
@@ -7243,13 +7264,16 @@ void MediaPlayListTest::testEnqueueSampleFiles()
     connect(&myPlayList, &MediaPlayList::newTrackByFileNameInList,
             &myListener, &TracksListener::trackByFileNameInList,
             Qt::QueuedConnection);
+    connect(&myPlayList, &MediaPlayList::newTracksByFileNameInList,
+            &myListener, &TracksListener::tracksByFileNameInList,
+            Qt::QueuedConnection);
     connect(&myPlayList, &MediaPlayList::newArtistInList,
             &myListener, &TracksListener::newArtistInList,
             Qt::QueuedConnection);
     connect(&myDatabaseContent, &DatabaseInterface::tracksAdded,
             &myListener, &TracksListener::tracksAdded);
 
-    myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
@@ -7263,6 +7287,7 @@ void MediaPlayListTest::testEnqueueSampleFiles()
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
     QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByFileNameInListSpy.count(), 0);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
     myPlayList.enqueue({QStringLiteral(MEDIAPLAYLIST_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/test.ogg"),
@@ -7270,16 +7295,17 @@ void MediaPlayListTest::testEnqueueSampleFiles()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 2);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 0);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 2);
-    QCOMPARE(trackHasBeenAddedSpy.count(), 2);
-    QCOMPARE(persistentStateChangedSpy.count(), 2);
-    QCOMPARE(dataChangedSpy.count(), 2);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(trackHasBeenAddedSpy.count(), 1);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
+    QCOMPARE(dataChangedSpy.count(), 1);
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
-    QCOMPARE(newTrackByFileNameInListSpy.count(), 2);
+    QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByFileNameInListSpy.count(), 1);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
     QCOMPARE(myPlayList.rowCount(), 2);
@@ -7288,16 +7314,17 @@ void MediaPlayListTest::testEnqueueSampleFiles()
 
     QCOMPARE(rowsAboutToBeRemovedSpy.count(), 0);
     QCOMPARE(rowsAboutToBeMovedSpy.count(), 0);
-    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 2);
+    QCOMPARE(rowsAboutToBeInsertedSpy.count(), 1);
     QCOMPARE(rowsRemovedSpy.count(), 0);
     QCOMPARE(rowsMovedSpy.count(), 0);
-    QCOMPARE(rowsInsertedSpy.count(), 2);
-    QCOMPARE(trackHasBeenAddedSpy.count(), 2);
-    QCOMPARE(persistentStateChangedSpy.count(), 2);
-    QCOMPARE(dataChangedSpy.count(), 4);
+    QCOMPARE(rowsInsertedSpy.count(), 1);
+    QCOMPARE(trackHasBeenAddedSpy.count(), 1);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
+    QCOMPARE(dataChangedSpy.count(), 3);
     QCOMPARE(newTrackByIdInListSpy.count(), 0);
     QCOMPARE(newTrackByNameInListSpy.count(), 0);
-    QCOMPARE(newTrackByFileNameInListSpy.count(), 2);
+    QCOMPARE(newTrackByFileNameInListSpy.count(), 0);
+    QCOMPARE(newTracksByFileNameInListSpy.count(), 1);
     QCOMPARE(newArtistInListSpy.count(), 0);
 
     QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("Title"));
@@ -7314,6 +7341,311 @@ void MediaPlayListTest::testEnqueueSampleFiles()
     QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::DurationRole).toString(), QStringLiteral("00:01"));
 }
 
+void MediaPlayListTest::testTrackNotificationsAfterMoveAndRemove()
+{
+    MediaPlayList myPlayList;
+
+    for (int i = 0; i < 4; ++i) {
+        const auto &oneTrack = mNewTracks[i];
+        myPlayList.enqueue({oneTrack.title(), oneTrack.artist(), oneTrack.albumName(), oneTrack.trackNumber(), oneTrack.discNumber()});
+    }
+
+    myPlayList.move(0, 3, 1);
+    myPlayList.removeRow(1);
+
+    QCOMPARE(myPlayList.rowCount(), 3);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track2"));
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track4"));
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
+
+    auto firstTrack = mNewTracks[0];
+    firstTrack.setDatabaseId(1);
+    auto fourthTrack = mNewTracks[3];
+    fourthTrack.setDatabaseId(4);
+
+    QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
+
+    myPlayList.trackChanged(firstTrack);
+    myPlayList.trackChanged(fourthTrack);
+
+    QCOMPARE(dataChangedSpy.count(), 2);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::IsValidRole).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), true);
+
+    myPlayList.trackRemoved(1);
+
+    QCOMPARE(dataChangedSpy.count(), 3);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), false);
+
+    myPlayList.trackInError(fourthTrack.resourceURI(), QMediaPlayer::ResourceError);
+
+    QCOMPARE(dataChangedSpy.count(), 4);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::IsValidRole).toBool(), false);
+
+    myPlayList.trackChanged(firstTrack);
+
+    QCOMPARE(dataChangedSpy.count(), 5);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
+}
+
+void MediaPlayListTest::testTrackNotificationsWithTitleEqualToAlbum()
+{
+    MediaPlayList myPlayList;
+
+    myPlayList.enqueue({QStringLiteral("same"), QStringLiteral("artist1"), QStringLiteral("same"), 1, 1});
+    myPlayList.enqueue({QStringLiteral("other"), QStringLiteral("artist1"), QStringLiteral("other"), 2, 2});
+    myPlayList.enqueue({QStringLiteral("first"), QStringLiteral("artist1"), QStringLiteral("second"), 3, 3});
+    myPlayList.enqueue({QStringLiteral("second"), QStringLiteral("artist1"), QStringLiteral("first"), 3, 3});
+
+    QCOMPARE(myPlayList.rowCount(), 4);
+
+    auto newTrack = [](qulonglong databaseId, const QString &title, const QString &albumName, int trackNumber, int discNumber) {
+        auto result = MusicAudioTrack();
+
+        result.setValid(true);
+        result.setDatabaseId(databaseId);
+        result.setTitle(title);
+        result.setArtist(QStringLiteral("artist1"));
+        result.setAlbumName(albumName);
+        result.setTrackNumber(trackNumber);
+        result.setDiscNumber(discNumber);
+        result.setResourceURI(QUrl::fromLocalFile(QStringLiteral("/$%1").arg(databaseId)));
+
+        return result;
+    };
+
+    QSignalSpy dataChangedSpy(&myPlayList, &MediaPlayList::dataChanged);
+
+    myPlayList.trackChanged(newTrack(4, QStringLiteral("second"), QStringLiteral("first"), 3, 3));
+
+    QCOMPARE(dataChangedSpy.count(), 1);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::IsValidRole).toBool(), true);
+
+    myPlayList.trackChanged(newTrack(1, QStringLiteral("same"), QStringLiteral("same"), 1, 1));
+
+    QCOMPARE(dataChangedSpy.count(), 2);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::IsValidRole).toBool(), false);
+
+    myPlayList.trackChanged(newTrack(2, QStringLiteral("other"), QStringLiteral("other"), 2, 2));
+
+    QCOMPARE(dataChangedSpy.count(), 3);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::IsValidRole).toBool(), false);
+}
+
+void MediaPlayListTest::testRemoveSelectionRanges()
+{
+    MediaPlayList myPlayList;
+
+    for (int i = 0; i < 8; ++i) {
+        const auto &oneTrack = mNewTracks[i];
+        myPlayList.enqueue({oneTrack.title(), oneTrack.artist(), oneTrack.albumName(), oneTrack.trackNumber(), oneTrack.discNumber()});
+    }
+
+    QSignalSpy rowsAboutToBeRemovedSpy(&myPlayList, &MediaPlayList::rowsAboutToBeRemoved);
+    QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
+    QSignalSpy persistentStateChangedSpy(&myPlayList, &MediaPlayList::persistentStateChanged);
+    QSignalSpy tracksCountChangedSpy(&myPlayList, &MediaPlayList::tracksCountChanged);
+
+    myPlayList.removeSelection({7, 0, 1, 3, 4, 5, 1});
+
+    QCOMPARE(rowsAboutToBeRemovedSpy.count(), 3);
+    QCOMPARE(rowsRemovedSpy.count(), 3);
+    QCOMPARE(persistentStateChangedSpy.count(), 1);
+    QCOMPARE(tracksCountChangedSpy.count(), 1);
+
+    QCOMPARE(rowsRemovedSpy.at(0).at(1).toInt(), 7);
+    QCOMPARE(rowsRemovedSpy.at(0).at(2).toInt(), 7);
+    QCOMPARE(rowsRemovedSpy.at(1).at(1).toInt(), 3);
+    QCOMPARE(rowsRemovedSpy.at(1).at(2).toInt(), 5);
+    QCOMPARE(rowsRemovedSpy.at(2).at(1).toInt(), 0);
+    QCOMPARE(rowsRemovedSpy.at(2).at(2).toInt(), 1);
+
+    QCOMPARE(myPlayList.rowCount(), 2);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), mNewTracks[2].title());
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::TitleRole).toString(), mNewTracks[6].title());
+
+    auto remainingTrack = mNewTracks[6];
+    remainingTrack.setDatabaseId(7);
+
+    myPlayList.trackChanged(remainingTrack);
+
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::IsValidRole).toBool(), false);
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::IsValidRole).toBool(), true);
+}
+
+void MediaPlayListTest::testRemoveSelectionRangesWithModelTester()
+{
+    MediaPlayList myPlayList;
+
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+    QAbstractItemModelTester myModelTester(&myPlayList, QAbstractItemModelTester::FailureReportingMode::QtTest);
+#endif
+
+    for (int i = 0; i < 8; ++i) {
+        const auto &oneTrack = mNewTracks[i];
+        myPlayList.enqueue({oneTrack.title(), oneTrack.artist(), oneTrack.albumName(), oneTrack.trackNumber(), oneTrack.discNumber()});
+    }
+
+    myPlayList.switchTo(4);
+
+    QCOMPARE(myPlayList.currentTrackRow(), 4);
+
+    QSignalSpy rowsRemovedSpy(&myPlayList, &MediaPlayList::rowsRemoved);
+
+    auto rowCountAfterRemoval = QList<int>();
+    connect(&myPlayList, &MediaPlayList::rowsRemoved, this, [&myPlayList, &rowCountAfterRemoval]() {
+        rowCountAfterRemoval.push_back(myPlayList.rowCount());
+    });
+
+    myPlayList.removeSelection({6, 1, 3, 4});
+
+    QCOMPARE(rowsRemovedSpy.count(), 3);
+    QCOMPARE(rowCountAfterRemoval, (QList<int>{7, 5, 4}));
+
+    QCOMPARE(myPlayList.rowCount(), 4);
+    QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::TitleRole).toString(), mNewTracks[0].title());
+    QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::TitleRole).toString(), mNewTracks[2].title());
+    QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::TitleRole).toString(), mNewTracks[5].title());
+    QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::TitleRole).toString(), mNewTracks[7].title());
+    QCOMPARE(myPlayList.currentTrackRow(), 2);
+}
+
+void MediaPlayListTest::testPlayListStore()
+{
+    QTemporaryDir storeDirectory;
+    const auto storeFileName = storeDirectory.path() + QStringLiteral("/elisaPlayList.dat");
+
+    DatabaseInterface myDatabaseContent;
+
+    myDatabaseContent.init(QStringLiteral("testDbPlayListStore"));
+    myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
+
+    auto firstTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track1"), QStringLiteral("artist2"),
+                                                                               QStringLiteral("album3"), 1, 1);
+    auto secondTrackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist2"),
+                                                                                QStringLiteral("album3"), 2, 1);
+
+    {
+        MediaPlayList myPlayListSave;
+        TracksListener myListenerSave(&myDatabaseContent);
+
+        connect(&myListenerSave, &TracksListener::trackHasChanged,
+                &myPlayListSave, &MediaPlayList::trackChanged,
+                Qt::QueuedConnection);
+        connect(&myPlayListSave, &MediaPlayList::newTracksByIdInList,
+                &myListenerSave, &TracksListener::tracksByIdInList,
+                Qt::QueuedConnection);
+
+        myPlayListSave.setPlayListStoreFileName(storeFileName);
+
+        QCOMPARE(myPlayListSave.rowCount(), 0);
+
+        myPlayListSave.enqueue(QList<qulonglong>{firstTrackId, secondTrackId});
+        myPlayListSave.enqueue({QStringLiteral("unknown"), QStringLiteral("artist9"), QStringLiteral("album9"), 9, 1});
+
+        QTRY_COMPARE(myPlayListSave.data(myPlayListSave.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track2"));
+
+        myPlayListSave.setRandomPlay(true);
+        myPlayListSave.switchTo(1);
+    }
+
+    QCOMPARE(QFile::exists(storeFileName), true);
+
+    MediaPlayList myPlayListRead;
+    TracksListener myListenerRead(&myDatabaseContent);
+
+    QSignalSpy rowsInsertedSpyRead(&myPlayListRead, &MediaPlayList::rowsInserted);
+    QSignalSpy newTracksByIdOrFileNameInListSpyRead(&myPlayListRead, &MediaPlayList::newTracksByIdOrFileNameInList);
+    QSignalSpy newTracksByNameInListSpyRead(&myPlayListRead, &MediaPlayList::newTracksByNameInList);
+    QSignalSpy newTracksByIdInListSpyRead(&myPlayListRead, &MediaPlayList::newTracksByIdInList);
+
+    connect(&myListenerRead, &TracksListener::trackHasChanged,
+            &myPlayListRead, &MediaPlayList::trackChanged,
+            Qt::QueuedConnection);
+    connect(&myPlayListRead, &MediaPlayList::newTracksByIdOrFileNameInList,
+            &myListenerRead, &TracksListener::tracksByIdOrFileNameInList,
+            Qt::QueuedConnection);
+
+    myPlayListRead.setPlayListStoreFileName(storeFileName);
+
+    QCOMPARE(rowsInsertedSpyRead.count(), 0);
+
+    QTRY_COMPARE(rowsInsertedSpyRead.count(), 1);
+
+    QCOMPARE(newTracksByIdOrFileNameInListSpyRead.count(), 1);
+    QCOMPARE(newTracksByNameInListSpyRead.count(), 1);
+    QCOMPARE(newTracksByIdInListSpyRead.count(), 0);
+    QCOMPARE(myPlayListRead.rowCount(), 3);
+    QCOMPARE(myPlayListRead.randomPlay(), true);
+    QCOMPARE(myPlayListRead.currentTrackRow(), 1);
+
+    QTRY_COMPARE(myPlayListRead.data(myPlayListRead.index(1, 0), MediaPlayList::IsValidRole).toBool(), true);
+
+    QCOMPARE(myPlayListRead.data(myPlayListRead.index(0, 0), MediaPlayList::IsValidRole).toBool(), true);
+    QCOMPARE(myPlayListRead.data(myPlayListRead.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track1"));
+    QCOMPARE(myPlayListRead.data(myPlayListRead.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("track2"));
+    QCOMPARE(myPlayListRead.data(myPlayListRead.index(2, 0), MediaPlayList::IsValidRole).toBool(), false);
+    QCOMPARE(myPlayListRead.data(myPlayListRead.index(2, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("unknown"));
+
+    myPlayListRead.setPersistentState({{QStringLiteral("playList"), QVariantList{QStringList{QStringLiteral("track3"), QStringLiteral("artist2"),
+                                                                                           QStringLiteral("album3"), QStringLiteral("3"), QStringLiteral("1")}}}});
+
+    QCOMPARE(myPlayListRead.rowCount(), 3);
+}
+
+void MediaPlayListTest::testPlayListStoreKeepsEarlyEntries()
+{
+    QTemporaryDir storeDirectory;
+    const auto storeFileName = storeDirectory.path() + QStringLiteral("/elisaPlayList.dat");
+
+    auto trackUrl = [&storeDirectory](const QString &name) {
+        const auto trackFileName = storeDirectory.path() + QStringLiteral("/") + name;
+        QFile trackFile(trackFileName);
+        trackFile.open(QIODevice::WriteOnly);
+        return QUrl::fromLocalFile(trackFileName);
+    };
+
+    const auto firstStoredTrack = trackUrl(QStringLiteral("stored1.ogg"));
+    const auto secondStoredTrack = trackUrl(QStringLiteral("stored2.ogg"));
+    const auto earlyTrack = trackUrl(QStringLiteral("early.ogg"));
+
+    {
+        MediaPlayList myPlayListSave;
+
+        myPlayListSave.setPlayListStoreFileName(storeFileName);
+
+        myPlayListSave.enqueue(MediaPlayListEntry(firstStoredTrack));
+        myPlayListSave.enqueue(MediaPlayListEntry(secondStoredTrack));
+
+        QCOMPARE(myPlayListSave.persistentState().contains(QStringLiteral("playList")), false);
+    }
+
+    QCOMPARE(QFile::exists(storeFileName), true);
+
+    MediaPlayList myPlayListRead;
+
+    myPlayListRead.enqueue(MediaPlayListEntry(earlyTrack));
+
+    QCOMPARE(myPlayListRead.currentTrackRow(), 0);
+
+    myPlayListRead.setPlayListStoreFileName(storeFileName);
+
+    QCOMPARE(myPlayListRead.rowCount(), 1);
+
+    QTRY_COMPARE(myPlayListRead.rowCount(), 3);
+
+    QCOMPARE(myPlayListRead.data(myPlayListRead.index(0, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("stored1.ogg"));
+    QCOMPARE(myPlayListRead.data(myPlayListRead.index(1, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("stored2.ogg"));
+    QCOMPARE(myPlayListRead.data(myPlayListRead.index(2, 0), MediaPlayList::TitleRole).toString(), QStringLiteral("early.ogg"));
+    QCOMPARE(myPlayListRead.currentTrackRow(), 2);
+}
+
 QTEST_GUILESS_MAIN(MediaPlayListTest)
 
 
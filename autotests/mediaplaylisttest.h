@@ -135,10 +135,21 @@ private Q_SLOTS:
 
     void testEnqueueSampleFiles();
 
+    void testTrackNotificationsAfterMoveAndRemove();
+
+    void testTrackNotificationsWithTitleEqualToAlbum();
+
+    void testRemoveSelectionRanges();
+
+    void testRemoveSelectionRangesWithModelTester();
+
+    void testPlayListStore();
+
+    void testPlayListStoreKeepsEarlyEntries();
+
 private:
 
     QList<MusicAudioTrack> mNewTracks;
-    QHash<QString, QUrl> mNewCovers;
 
 };
 
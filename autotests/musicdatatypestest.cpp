@@ -0,0 +1,111 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+#include "musicartist.h"
+
+#include <QObject>
+#include <QList>
+#include <QString>
+#include <QUrl>
+
+#include <QtTest>
+
+class MusicDataTypesTests: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    static MusicAudioTrack buildTrack(int index)
+    {
+        auto result = MusicAudioTrack{true, QStringLiteral("$%1").arg(index), QStringLiteral("0"),
+                QStringLiteral("track%1").arg(index), QStringLiteral("artist%1").arg(index % 7),
+                QStringLiteral("album%1").arg(index / 20), QStringLiteral("artist%1").arg(index / 100),
+                index % 20 + 1, 1, QTime::fromMSecsSinceStartOfDay(index * 1000),
+                {QUrl::fromLocalFile(QStringLiteral("/music/track%1.ogg").arg(index))},
+                {QUrl::fromLocalFile(QStringLiteral("/music/cover%1.jpg").arg(index / 20))}, index % 5, true};
+
+        result.setDatabaseId(index);
+
+        return result;
+    }
+
+    static MusicAlbum buildAlbum(int albumIndex, int tracksCount)
+    {
+        auto result = MusicAlbum();
+
+        result.setValid(true);
+        result.setDatabaseId(albumIndex);
+        result.setTitle(QStringLiteral("album%1").arg(albumIndex));
+        result.setArtist(QStringLiteral("artist%1").arg(albumIndex));
+
+        auto allTracks = QList<MusicAudioTrack>();
+        for (int i = 0; i < tracksCount; ++i) {
+            allTracks.push_back(buildTrack(albumIndex * tracksCount + i));
+        }
+
+        result.setTracks(allTracks);
+        result.setTracksCount(tracksCount);
+
+        return result;
+    }
+
+private Q_SLOTS:
+
+    void copiesAreIndependent()
+    {
+        auto firstTrack = buildTrack(1);
+        auto secondTrack = firstTrack;
+
+        secondTrack.setTitle(QStringLiteral("modified"));
+        secondTrack.setRating(5);
+
+        QCOMPARE(firstTrack.title(), QStringLiteral("track1"));
+        QCOMPARE(firstTrack.rating(), 1);
+        QCOMPARE(secondTrack.title(), QStringLiteral("modified"));
+        QCOMPARE(secondTrack.rating(), 5);
+
+        auto firstAlbum = buildAlbum(1, 10);
+        auto secondAlbum = firstAlbum;
+
+        secondAlbum.removeTrackFromIndex(0);
+        secondAlbum.updateTrack(secondTrack, 0);
+
+        QCOMPARE(firstAlbum.tracksCount(), 10);
+        QCOMPARE(firstAlbum.trackFromIndex(0).title(), QStringLiteral("track10"));
+        QCOMPARE(firstAlbum.trackFromIndex(1).title(), QStringLiteral("track11"));
+        QCOMPARE(secondAlbum.tracksCount(), 9);
+        QCOMPARE(secondAlbum.trackFromIndex(0).title(), QStringLiteral("modified"));
+
+        auto firstArtist = MusicArtist();
+        firstArtist.setName(QStringLiteral("artist1"));
+        auto secondArtist = firstArtist;
+        secondArtist.setName(QStringLiteral("artist2"));
+
+        QCOMPARE(firstArtist.name(), QStringLiteral("artist1"));
+        QCOMPARE(secondArtist.name(), QStringLiteral("artist2"));
+    }
+};
+
+QTEST_GUILESS_MAIN(MusicDataTypesTests)
+
+
+#include "musicdatatypestest.moc"
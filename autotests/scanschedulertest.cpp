@@ -0,0 +1,142 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "abstractfile/scanscheduler.h"
+
+#include <QObject>
+#include <QAtomicInt>
+#include <QElapsedTimer>
+#include <QThread>
+
+#include <QtTest>
+
+#include <thread>
+
+class ScanSchedulerTests: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    ScanSchedulerTests(QObject *parent = nullptr) : QObject(parent)
+    {
+    }
+
+private Q_SLOTS:
+
+    void serializeScansOnSameDevice()
+    {
+        auto &scheduler = ScanScheduler::instance();
+        QAtomicInt stopRequest = 0;
+        QAtomicInt otherScanStarted = 0;
+        QAtomicInt otherDeviceScanStarted = 0;
+
+        QCOMPARE(scheduler.acquireDevice(QByteArrayLiteral("sameDevice"), stopRequest), true);
+
+        std::thread otherScan([&scheduler, &stopRequest, &otherScanStarted]() {
+            if (scheduler.acquireDevice(QByteArrayLiteral("sameDevice"), stopRequest)) {
+                otherScanStarted = 1;
+                scheduler.releaseDevice(QByteArrayLiteral("sameDevice"));
+            }
+        });
+
+        std::thread otherDeviceScan([&scheduler, &stopRequest, &otherDeviceScanStarted]() {
+            if (scheduler.acquireDevice(QByteArrayLiteral("otherDevice"), stopRequest)) {
+                otherDeviceScanStarted = 1;
+                scheduler.releaseDevice(QByteArrayLiteral("otherDevice"));
+            }
+        });
+
+        otherDeviceScan.join();
+        QThread::msleep(300);
+
+        QCOMPARE(int(otherDeviceScanStarted), 1);
+        QCOMPARE(int(otherScanStarted), 0);
+
+        scheduler.releaseDevice(QByteArrayLiteral("sameDevice"));
+        otherScan.join();
+
+        QCOMPARE(int(otherScanStarted), 1);
+    }
+
+    void stopRequestCancelsWait()
+    {
+        auto &scheduler = ScanScheduler::instance();
+        QAtomicInt stopRequest = 0;
+
+        QCOMPARE(scheduler.acquireDevice(QByteArrayLiteral("stoppedDevice"), stopRequest), true);
+
+        stopRequest = 1;
+
+        QCOMPARE(scheduler.acquireDevice(QByteArrayLiteral("stoppedDevice"), stopRequest), false);
+
+        scheduler.releaseDevice(QByteArrayLiteral("stoppedDevice"));
+    }
+
+    void throttleFilesPerSecond()
+    {
+        auto &scheduler = ScanScheduler::instance();
+        QAtomicInt stopRequest = 0;
+
+        scheduler.setFilesPerSecond(20);
+
+        QElapsedTimer scanTimer;
+        scanTimer.start();
+
+        for (int i = 0; i < 10; ++i) {
+            scheduler.throttle(QByteArrayLiteral("throttledDevice"), 1000, stopRequest);
+        }
+
+        scheduler.setFilesPerSecond(0);
+
+        QVERIFY(scanTimer.elapsed() >= 400);
+    }
+
+    void throttleBytesPerSecond()
+    {
+        auto &scheduler = ScanScheduler::instance();
+        QAtomicInt stopRequest = 0;
+
+        scheduler.setBytesPerSecond(100 * 1024);
+
+        QElapsedTimer scanTimer;
+        scanTimer.start();
+
+        for (int i = 0; i < 5; ++i) {
+            scheduler.throttle(QByteArrayLiteral("bytesDevice"), 10 * 1024, stopRequest);
+        }
+
+        scheduler.setBytesPerSecond(0);
+
+        QVERIFY(scanTimer.elapsed() >= 400);
+
+        scanTimer.restart();
+
+        for (int i = 0; i < 100; ++i) {
+            scheduler.throttle(QByteArrayLiteral("bytesDevice"), 10 * 1024, stopRequest);
+        }
+
+        QVERIFY(scanTimer.elapsed() < 100);
+    }
+};
+
+QTEST_GUILESS_MAIN(ScanSchedulerTests)
+
+
+#include "scanschedulertest.moc"
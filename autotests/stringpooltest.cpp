@@ -0,0 +1,90 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "stringpool.h"
+#include "musicaudiotrack.h"
+
+#include <QObject>
+#include <QString>
+
+#include <QtTest>
+
+class StringPoolTests: public QObject
+{
+    Q_OBJECT
+
+private Q_SLOTS:
+
+    void internSharesData()
+    {
+        auto firstName = QStringLiteral("artist%1").arg(1);
+        auto secondName = QStringLiteral("artist%1").arg(1);
+
+        QVERIFY(firstName.constData() != secondName.constData());
+
+        const auto &firstInterned = StringPool::intern(firstName);
+        const auto &secondInterned = StringPool::intern(secondName);
+
+        QCOMPARE(firstInterned, firstName);
+        QCOMPARE(firstInterned.constData(), secondInterned.constData());
+        QVERIFY(StringPool::intern(QString()).isEmpty());
+    }
+
+    void tracksShareNames()
+    {
+        auto firstTrack = MusicAudioTrack{true, QStringLiteral("$1"), QStringLiteral("0"), QStringLiteral("track1"),
+                QStringLiteral("artist%1").arg(1), QStringLiteral("album%1").arg(1), QStringLiteral("artist%1").arg(1),
+                1, 1, QTime::fromMSecsSinceStartOfDay(1000), {}, {}, 1, false};
+
+        auto secondTrack = MusicAudioTrack();
+        secondTrack.setArtist(QStringLiteral("artist%1").arg(1));
+        secondTrack.setAlbumName(QStringLiteral("album%1").arg(1));
+        secondTrack.setAlbumArtist(QStringLiteral("artist%1").arg(1));
+
+        QCOMPARE(firstTrack.artist().constData(), secondTrack.artist().constData());
+        QCOMPARE(firstTrack.albumName().constData(), secondTrack.albumName().constData());
+        QCOMPARE(firstTrack.albumArtist().constData(), secondTrack.albumArtist().constData());
+        QCOMPARE(firstTrack.artist().constData(), firstTrack.albumArtist().constData());
+    }
+
+    void purgeUnusedStrings()
+    {
+        StringPool::purge();
+
+        const auto initialSize = StringPool::size();
+
+        {
+            auto usedName = StringPool::intern(QStringLiteral("usedName%1").arg(1));
+            StringPool::intern(QStringLiteral("unusedName%1").arg(1));
+
+            QCOMPARE(StringPool::size(), initialSize + 2);
+            QCOMPARE(StringPool::purge(), 1);
+            QCOMPARE(StringPool::size(), initialSize + 1);
+        }
+
+        QCOMPARE(StringPool::purge(), 1);
+        QCOMPARE(StringPool::size(), initialSize);
+    }
+
+};
+
+QTEST_GUILESS_MAIN(StringPoolTests)
+
+
+#include "stringpooltest.moc"
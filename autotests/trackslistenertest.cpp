@@ -119,13 +119,6 @@ private:
          {QUrl::fromLocalFile(QStringLiteral("file://image$22"))}, 9, true},
     };
 
-    QHash<QString, QUrl> mNewCovers = {
-        {QStringLiteral("album1"), QUrl::fromLocalFile(QStringLiteral("album1"))},
-        {QStringLiteral("album2"), QUrl::fromLocalFile(QStringLiteral("album2"))},
-        {QStringLiteral("album3"), QUrl::fromLocalFile(QStringLiteral("album3"))},
-        {QStringLiteral("album4"), QUrl::fromLocalFile(QStringLiteral("album4"))},
-    };
-
 private Q_SLOTS:
 
     void initTestCase()
@@ -164,7 +157,7 @@ private Q_SLOTS:
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
         QCOMPARE(albumAddedSpy.count(), 0);
 
-        myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -287,7 +280,7 @@ private Q_SLOTS:
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
         QCOMPARE(albumAddedSpy.count(), 0);
 
-        myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -355,7 +348,7 @@ private Q_SLOTS:
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
         QCOMPARE(albumAddedSpy.count(), 0);
 
-        myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -393,6 +386,79 @@ private Q_SLOTS:
         QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::DiscNumberRole).toInt(), 0);
     }
 
+    void testInsertTracksBatchAndRemoval()
+    {
+        MediaPlayList myPlayList;
+        DatabaseInterface myDatabaseContent;
+        TracksListener myListener(&myDatabaseContent);
+
+        QSignalSpy trackHasChangedSpy(&myListener, &TracksListener::trackHasChanged);
+        QSignalSpy trackHasBeenRemovedSpy(&myListener, &TracksListener::trackHasBeenRemoved);
+        QSignalSpy albumAddedSpy(&myListener, &TracksListener::albumAdded);
+        QSignalSpy rowsInsertedSpy(&myPlayList, &MediaPlayList::rowsInserted);
+
+        myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
+
+        connect(&myDatabaseContent, &DatabaseInterface::trackRemoved, &myListener, &TracksListener::trackRemoved);
+        connect(&myDatabaseContent, &DatabaseInterface::tracksAdded, &myListener, &TracksListener::tracksAdded);
+        connect(&myDatabaseContent, &DatabaseInterface::trackModified, &myListener, &TracksListener::trackModified);
+        connect(&myListener, &TracksListener::trackHasChanged, &myPlayList, &MediaPlayList::trackChanged);
+        connect(&myListener, &TracksListener::trackHasBeenRemoved, &myPlayList, &MediaPlayList::trackRemoved);
+        connect(&myListener, &TracksListener::albumAdded, &myPlayList, &MediaPlayList::albumAdded);
+        connect(&myPlayList, &MediaPlayList::newTracksByIdInList, &myListener, &TracksListener::tracksByIdInList);
+        connect(&myPlayList, &MediaPlayList::newTracksByNameInList, &myListener, &TracksListener::tracksByNameInList);
+        connect(&myPlayList, &MediaPlayList::newArtistInList, &myListener, &TracksListener::newArtistInList);
+
+        myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
+
+        QCOMPARE(trackHasChangedSpy.count(), 0);
+        QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
+        QCOMPARE(albumAddedSpy.count(), 0);
+
+        myPlayList.enqueue(QVector<MediaPlayListEntry>{{QStringLiteral("track1"), QStringLiteral("artist1"), QStringLiteral("album1"), 1, 1},
+                                                       {QStringLiteral("track3"), QStringLiteral("artist3"), QStringLiteral("album1"), 3, 3},
+                                                       {QStringLiteral("track10"), QStringLiteral("artist9"), QStringLiteral("album9"), 1, 1}});
+
+        QCOMPARE(rowsInsertedSpy.count(), 1);
+        QCOMPARE(trackHasChangedSpy.count(), 2);
+        QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
+        QCOMPARE(albumAddedSpy.count(), 0);
+
+        QCOMPARE(myPlayList.tracksCount(), 3);
+
+        QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::TitleRole).toString(), QStringLiteral("track1"));
+        QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::TitleRole).toString(), QStringLiteral("track3"));
+        QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), false);
+
+        auto trackId = myDatabaseContent.trackIdFromTitleAlbumTrackDiscNumber(QStringLiteral("track2"), QStringLiteral("artist1"),
+                                                                              QStringLiteral("album2"), 2, 1);
+
+        QCOMPARE(trackId != 0, true);
+
+        myPlayList.enqueue(QList<qulonglong>{trackId});
+
+        QCOMPARE(rowsInsertedSpy.count(), 2);
+        QCOMPARE(trackHasChangedSpy.count(), 3);
+
+        QCOMPARE(myPlayList.tracksCount(), 4);
+
+        QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::TitleRole).toString(), QStringLiteral("track2"));
+        QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::AlbumRole).toString(), QStringLiteral("album2"));
+
+        myDatabaseContent.removeTracksList({QUrl::fromLocalFile(QStringLiteral("$1"))});
+
+        QCOMPARE(trackHasChangedSpy.count(), 3);
+        QCOMPARE(trackHasBeenRemovedSpy.count(), 1);
+        QCOMPARE(albumAddedSpy.count(), 0);
+
+        QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), false);
+        QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+        QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::IsValidRole).toBool(), true);
+    }
+
     void testInsertTrackByNameBeforeDatabaseAndRemoval()
     {
         MediaPlayList myPlayList;
@@ -435,7 +501,7 @@ private Q_SLOTS:
         QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::TrackNumberRole).toInt(), -1);
         QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::DiscNumberRole).toInt(), 0);
 
-        myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(trackHasChangedSpy.count(), 1);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -490,7 +556,7 @@ private Q_SLOTS:
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
         QCOMPARE(albumAddedSpy.count(), 0);
 
-        myDatabaseContent.insertTracksList(mNewTracks, mNewCovers, QStringLiteral("autoTest"));
+        myDatabaseContent.insertTracksList(mNewTracks, QStringLiteral("autoTest"));
 
         QCOMPARE(trackHasChangedSpy.count(), 0);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -517,7 +583,7 @@ private Q_SLOTS:
                                                 QStringLiteral("artist1"), QStringLiteral("album1"), QStringLiteral("Various Artists"),
                                                 2, 3, QTime::fromMSecsSinceStartOfDay(1000), {QUrl::fromLocalFile(QStringLiteral("$1"))},
                                                 {QUrl::fromLocalFile(QStringLiteral("file://image$1"))}, 1, false}
-                                           }, mNewCovers, QStringLiteral("autoTest"));
+                                           }, QStringLiteral("autoTest"));
 
         QCOMPARE(trackHasChangedSpy.count(), 2);
         QCOMPARE(trackHasBeenRemovedSpy.count(), 0);
@@ -547,6 +613,39 @@ private Q_SLOTS:
         QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::TrackNumberRole).toInt(), -1);
         QCOMPARE(myPlayList.data(myPlayList.index(0, 0), MediaPlayList::ColumnsRoles::DiscNumberRole).toInt(), 0);
     }
+
+    void enqueueDirectory()
+    {
+        MediaPlayList myPlayList;
+        DatabaseInterface myDatabaseContent;
+        TracksListener myListener(&myDatabaseContent);
+
+        QSignalSpy fileNamesExpandedSpy(&myListener, &TracksListener::fileNamesExpanded);
+
+        myDatabaseContent.init(QStringLiteral("testDbDirectContent"));
+
+        connect(&myPlayList, &MediaPlayList::newFileNamesToExpandInList, &myListener, &TracksListener::expandFileNamesInList);
+        connect(&myListener, &TracksListener::fileNamesExpanded, &myPlayList, &MediaPlayList::enqueueFileNames);
+
+        const auto musicPath = QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music");
+
+        myPlayList.enqueue(QStringList{musicPath + QStringLiteral("/test.ogg")});
+
+        QCOMPARE(fileNamesExpandedSpy.count(), 0);
+        QCOMPARE(myPlayList.tracksCount(), 1);
+
+        myPlayList.enqueue(QStringList{musicPath});
+
+        QCOMPARE(fileNamesExpandedSpy.count(), 1);
+        QCOMPARE(myPlayList.tracksCount(), 4);
+
+        QCOMPARE(myPlayList.data(myPlayList.index(1, 0), MediaPlayList::ColumnsRoles::ResourceRole).toUrl(),
+                 QUrl::fromLocalFile(musicPath + QStringLiteral("/test.m4a")));
+        QCOMPARE(myPlayList.data(myPlayList.index(2, 0), MediaPlayList::ColumnsRoles::ResourceRole).toUrl(),
+                 QUrl::fromLocalFile(musicPath + QStringLiteral("/test.mp3")));
+        QCOMPARE(myPlayList.data(myPlayList.index(3, 0), MediaPlayList::ColumnsRoles::ResourceRole).toUrl(),
+                 QUrl::fromLocalFile(musicPath + QStringLiteral("/test.ogg")));
+    }
 };
 
 QTEST_GUILESS_MAIN(TracksListenerTests)
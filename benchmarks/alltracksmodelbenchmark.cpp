@@ -0,0 +1,121 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "musicaudiotrack.h"
+#include "alltracksmodel.h"
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QTime>
+
+#include <QtTest>
+
+class AllTracksModelBenchmarks: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    AllTracksModelBenchmarks(QObject *parent = nullptr) : QObject(parent)
+    {
+    }
+
+private Q_SLOTS:
+
+    void benchmarkTracksAdded_data()
+    {
+        QTest::addColumn<int>("existingTracksCount");
+
+        QTest::newRow("empty") << 0;
+        QTest::newRow("100k") << 100000;
+        QTest::newRow("250k") << 250000;
+        QTest::newRow("500k") << 500000;
+    }
+
+    void benchmarkTracksAdded()
+    {
+        QFETCH(int, existingTracksCount);
+
+        const auto batchSize = 500;
+
+        AllTracksModel tracksModel;
+
+        auto existingTracks = QList<MusicAudioTrack>();
+        existingTracks.reserve(existingTracksCount);
+        for (int i = 1; i <= existingTracksCount; ++i) {
+            auto oneTrack = MusicAudioTrack();
+            oneTrack.setValid(true);
+            oneTrack.setDatabaseId(i);
+            existingTracks.push_back(oneTrack);
+        }
+
+        tracksModel.tracksAdded(existingTracks);
+
+        auto newTracks = QList<MusicAudioTrack>();
+        auto newTracksIds = QList<qulonglong>();
+        for (int i = existingTracksCount + 1; i <= existingTracksCount + batchSize; ++i) {
+            auto oneTrack = MusicAudioTrack();
+            oneTrack.setValid(true);
+            oneTrack.setDatabaseId(i);
+            newTracks.push_back(oneTrack);
+            newTracksIds.push_back(i);
+        }
+
+        QBENCHMARK {
+            tracksModel.tracksAdded(newTracks);
+            tracksModel.trackModified(newTracks.last());
+            tracksModel.tracksRemoved(newTracksIds);
+        }
+
+        QCOMPARE(tracksModel.rowCount(), existingTracksCount);
+    }
+
+    void benchmarkDisplayRoles()
+    {
+        AllTracksModel tracksModel;
+
+        auto newTracks = QList<MusicAudioTrack>();
+        for (int i = 1; i <= 10000; ++i) {
+            auto oneTrack = MusicAudioTrack();
+            oneTrack.setValid(true);
+            oneTrack.setDatabaseId(i);
+            oneTrack.setDuration(QTime::fromMSecsSinceStartOfDay(i * 1000));
+            oneTrack.setAlbumCover(QUrl::fromLocalFile(QStringLiteral("/cover%1.jpg").arg(i / 10)));
+            oneTrack.setResourceURI(QUrl::fromLocalFile(QStringLiteral("/track%1.ogg").arg(i)));
+            newTracks.push_back(oneTrack);
+        }
+
+        tracksModel.tracksAdded(newTracks);
+
+        QBENCHMARK {
+            for (int row = 0; row < tracksModel.rowCount(); ++row) {
+                const auto &currentIndex = tracksModel.index(row, 0);
+                tracksModel.data(currentIndex, AllTracksModel::DurationRole);
+                tracksModel.data(currentIndex, AllTracksModel::ImageRole);
+                tracksModel.data(currentIndex, AllTracksModel::ResourceRole);
+            }
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(AllTracksModelBenchmarks)
+
+
+#include "alltracksmodelbenchmark.moc"
@@ -0,0 +1,92 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "audiotagreader.h"
+#include "elisautils.h"
+#include "musicaudiotrack.h"
+
+#include "config-upnp-qt.h"
+
+#include <KFileMetaData/ExtractorCollection>
+
+#include <QObject>
+#include <QUrl>
+#include <QString>
+#include <QStringList>
+#include <QMimeDatabase>
+
+#include <QtTest>
+
+class AudioTagReaderBenchmarks: public QObject
+{
+    Q_OBJECT
+
+public:
+
+    AudioTagReaderBenchmarks(QObject *parent = nullptr) : QObject(parent)
+    {
+    }
+
+private:
+
+    QStringList allSampleFiles() const
+    {
+        return {
+            QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/test.mp3"),
+            QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/test.m4a"),
+            QStringLiteral(LOCAL_FILE_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/music/test.ogg"),
+            QStringLiteral(MEDIAPLAYLIST_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/test.ogg"),
+            QStringLiteral(MEDIAPLAYLIST_TESTS_SAMPLE_FILES_PATH) + QStringLiteral("/test2.ogg"),
+        };
+    }
+
+    KFileMetaData::ExtractorCollection mExtractors;
+
+    QMimeDatabase mMimeDb;
+
+private Q_SLOTS:
+
+    void benchmarkExtractors()
+    {
+        const auto &allFiles = allSampleFiles();
+
+        QBENCHMARK {
+            for (const auto &oneFile : allFiles) {
+                ElisaUtils::scanOneFile(QUrl::fromLocalFile(oneFile), mMimeDb, mExtractors);
+            }
+        }
+    }
+
+    void benchmarkTagReader()
+    {
+        const auto &allFiles = allSampleFiles();
+        AudioTagReader tagReader;
+
+        QBENCHMARK {
+            for (const auto &oneFile : allFiles) {
+                ElisaUtils::scanOneFile(QUrl::fromLocalFile(oneFile), mMimeDb, mExtractors, tagReader);
+            }
+        }
+    }
+};
+
+QTEST_GUILESS_MAIN(AudioTagReaderBenchmarks)
+
+
+#include "audiotagreaderbenchmark.moc"
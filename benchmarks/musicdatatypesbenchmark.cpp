@@ -0,0 +1,152 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+
+#include <QObject>
+#include <QList>
+#include <QString>
+#include <QUrl>
+#include <QVariant>
+#include <QCoreApplication>
+
+#include <QtTest>
+
+class MusicDataSink : public QObject
+{
+    Q_OBJECT
+
+public:
+
+    int mReceivedCount = 0;
+
+Q_SIGNALS:
+
+    void albumsChanged(const QList<MusicAlbum> &albums);
+
+public Q_SLOTS:
+
+    void receiveAlbums(const QList<MusicAlbum> &albums)
+    {
+        mReceivedCount += albums.size();
+    }
+
+};
+
+class MusicDataTypesBenchmarks: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    static MusicAudioTrack buildTrack(int index)
+    {
+        auto result = MusicAudioTrack{true, QStringLiteral("$%1").arg(index), QStringLiteral("0"),
+                QStringLiteral("track%1").arg(index), QStringLiteral("artist%1").arg(index % 7),
+                QStringLiteral("album%1").arg(index / 20), QStringLiteral("artist%1").arg(index / 100),
+                index % 20 + 1, 1, QTime::fromMSecsSinceStartOfDay(index * 1000),
+                {QUrl::fromLocalFile(QStringLiteral("/music/track%1.ogg").arg(index))},
+                {QUrl::fromLocalFile(QStringLiteral("/music/cover%1.jpg").arg(index / 20))}, index % 5, true};
+
+        result.setDatabaseId(index);
+
+        return result;
+    }
+
+    static MusicAlbum buildAlbum(int albumIndex, int tracksCount)
+    {
+        auto result = MusicAlbum();
+
+        result.setValid(true);
+        result.setDatabaseId(albumIndex);
+        result.setTitle(QStringLiteral("album%1").arg(albumIndex));
+        result.setArtist(QStringLiteral("artist%1").arg(albumIndex));
+
+        auto allTracks = QList<MusicAudioTrack>();
+        for (int i = 0; i < tracksCount; ++i) {
+            allTracks.push_back(buildTrack(albumIndex * tracksCount + i));
+        }
+
+        result.setTracks(allTracks);
+        result.setTracksCount(tracksCount);
+
+        return result;
+    }
+
+private Q_SLOTS:
+
+    void initTestCase()
+    {
+        qRegisterMetaType<QList<MusicAlbum>>("QList<MusicAlbum>");
+    }
+
+    void benchmarkCopyTrack()
+    {
+        const auto track = buildTrack(1);
+
+        QBENCHMARK {
+            auto copiedTrack = track;
+            QVERIFY(copiedTrack.isValid());
+        }
+    }
+
+    void benchmarkCopyAlbum()
+    {
+        const auto album = buildAlbum(1, 500);
+
+        QBENCHMARK {
+            auto copiedAlbum = album;
+            QCOMPARE(copiedAlbum.tracksCount(), 500);
+        }
+    }
+
+    void benchmarkAlbumToVariant()
+    {
+        const auto album = buildAlbum(1, 500);
+
+        QBENCHMARK {
+            auto albumData = QVariant::fromValue(album);
+            QVERIFY(albumData.isValid());
+        }
+    }
+
+    void benchmarkQueuedAlbumsDelivery()
+    {
+        auto allAlbums = QList<MusicAlbum>();
+        for (int i = 0; i < 100; ++i) {
+            allAlbums.push_back(buildAlbum(i, 12));
+        }
+
+        MusicDataSink sink;
+        connect(&sink, &MusicDataSink::albumsChanged, &sink, &MusicDataSink::receiveAlbums, Qt::QueuedConnection);
+
+        QBENCHMARK {
+            Q_EMIT sink.albumsChanged(allAlbums);
+            QCoreApplication::processEvents();
+        }
+
+        QVERIFY(sink.mReceivedCount > 0);
+    }
+};
+
+QTEST_GUILESS_MAIN(MusicDataTypesBenchmarks)
+
+
+#include "musicdatatypesbenchmark.moc"
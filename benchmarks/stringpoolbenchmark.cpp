@@ -0,0 +1,164 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "stringpool.h"
+#include "musicaudiotrack.h"
+
+#include <QObject>
+#include <QString>
+#include <QSet>
+#include <QVector>
+#include <QFile>
+#include <QDebug>
+
+#include <QtTest>
+
+class StringPoolBenchmarks: public QObject
+{
+    Q_OBJECT
+
+private:
+
+    static const int LibraryTracksCount = 200000;
+
+    static QString artistName(int trackIndex)
+    {
+        return QStringLiteral("artist%1").arg(trackIndex % 2000);
+    }
+
+    static QString albumName(int trackIndex)
+    {
+        return QStringLiteral("album%1").arg(trackIndex / 12);
+    }
+
+    static QString albumArtistName(int trackIndex)
+    {
+        return QStringLiteral("artist%1").arg((trackIndex / 12) % 2000);
+    }
+
+    static qint64 stringsFootprint(const QVector<QString> &allStrings)
+    {
+        auto allData = QSet<const QChar*>();
+        auto result = qint64(0);
+
+        for (const auto &oneString : allStrings) {
+            if (allData.contains(oneString.constData())) {
+                continue;
+            }
+
+            allData.insert(oneString.constData());
+            result += qint64(sizeof(QArrayData)) + (oneString.size() + 1) * qint64(sizeof(QChar));
+        }
+
+        return result;
+    }
+
+    static QString residentSetSize()
+    {
+        QFile statusFile(QStringLiteral("/proc/self/status"));
+
+        if (!statusFile.open(QIODevice::ReadOnly)) {
+            return {};
+        }
+
+        for (const auto &oneLine : statusFile.readAll().split('\n')) {
+            if (oneLine.startsWith("VmRSS:")) {
+                return QString::fromLatin1(oneLine.mid(6).trimmed());
+            }
+        }
+
+        return {};
+    }
+
+private Q_SLOTS:
+
+    void libraryFootprint()
+    {
+        auto plainNames = QVector<QString>();
+        plainNames.reserve(3 * LibraryTracksCount);
+
+        for (int i = 0; i < LibraryTracksCount; ++i) {
+            plainNames.push_back(artistName(i));
+            plainNames.push_back(albumName(i));
+            plainNames.push_back(albumArtistName(i));
+        }
+
+        const auto plainFootprint = stringsFootprint(plainNames);
+        qDebug() << "StringPoolBenchmarks::libraryFootprint" << "plain names" << plainFootprint << "bytes" << "VmRSS" << residentSetSize();
+
+        plainNames.clear();
+        plainNames.squeeze();
+
+        auto allTracks = QVector<MusicAudioTrack>();
+        allTracks.reserve(LibraryTracksCount);
+
+        for (int i = 0; i < LibraryTracksCount; ++i) {
+            allTracks.push_back({true, QStringLiteral("$%1").arg(i), QStringLiteral("0"), {}, artistName(i),
+                                 albumName(i), albumArtistName(i), i % 12 + 1, 1, {}, {}, {}, 0, true});
+        }
+
+        auto internedNames = QVector<QString>();
+        internedNames.reserve(3 * LibraryTracksCount);
+
+        for (const auto &oneTrack : allTracks) {
+            internedNames.push_back(oneTrack.artist());
+            internedNames.push_back(oneTrack.albumName());
+            internedNames.push_back(oneTrack.albumArtist());
+        }
+
+        const auto internedFootprint = stringsFootprint(internedNames);
+        qDebug() << "StringPoolBenchmarks::libraryFootprint" << "interned names" << internedFootprint << "bytes" << "VmRSS" << residentSetSize();
+
+        QVERIFY(internedFootprint * 10 < plainFootprint);
+    }
+
+    void benchmarkPlainEquality()
+    {
+        const auto firstName = QStringLiteral("a rather long artist name %1").arg(1);
+        const auto secondName = QStringLiteral("a rather long artist name %1").arg(1);
+
+        auto result = false;
+
+        QBENCHMARK {
+            result = (firstName == secondName);
+        }
+
+        QVERIFY(result);
+    }
+
+    void benchmarkInternedEquality()
+    {
+        const auto firstName = StringPool::intern(QStringLiteral("a rather long artist name %1").arg(1));
+        const auto secondName = StringPool::intern(QStringLiteral("a rather long artist name %1").arg(1));
+
+        auto result = false;
+
+        QBENCHMARK {
+            result = (firstName == secondName);
+        }
+
+        QVERIFY(result);
+    }
+
+};
+
+QTEST_GUILESS_MAIN(StringPoolBenchmarks)
+
+
+#include "stringpoolbenchmark.moc"
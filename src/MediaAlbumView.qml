@@ -63,24 +63,9 @@ FocusScope {
     Connections {
         target: musicListener
 
-        onAlbumRemoved:
-        {
-            if (albumId === removedAlbumId) {
-                contentModel.albumRemoved(removedAlbum)
-            }
-        }
-    }
-
-    Connections {
-        target: musicListener
+        onAlbumsRemoved: contentModel.albumsRemoved(removedAlbums)
 
-        onAlbumModified:
-        {
-            if (albumId === modifiedAlbumId) {
-                albumData = modifiedAlbum
-                contentModel.albumModified(modifiedAlbum)
-            }
-        }
+        onAlbumsModified: contentModel.albumsModified(modifiedAlbums)
     }
 
     ColumnLayout {
@@ -108,7 +93,7 @@ FocusScope {
             enqueueAction: Action {
                 text: i18nc("Add whole album to play list", "Enqueue")
                 iconName: "media-track-add-amarok"
-                onTriggered: topListing.playListModel.enqueue(topListing.albumData)
+                onTriggered: topListing.playListModel.enqueue(contentModel.albumData)
             }
 
             clearAndEnqueueAction: Action {
@@ -116,7 +101,7 @@ FocusScope {
                 tooltip: i18nc("Clear play list and add whole album to play list", "Replace Play List and Play Now")
                 iconName: "media-playback-start"
                 onTriggered: {
-                    topListing.playListModel.clearAndEnqueue(topListing.albumData)
+                    topListing.playListModel.clearAndEnqueue(contentModel.albumData)
                     topListing.playerControl.ensurePlay()
                 }
             }
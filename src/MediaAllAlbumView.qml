@@ -90,9 +90,15 @@ FocusScope {
                     model: DelegateModel {
                         id: delegateContentModel
 
-                        model: AlbumFilterProxyModel {
+                        model: LibrarySortFilterProxyModel {
                             sourceModel: rootElement.contentDirectoryModel
 
+                            filterRoles: [AllAlbumsModel.TitleRole, AllAlbumsModel.ArtistRole, AllAlbumsModel.AllArtistsRole]
+
+                            ratingRole: AllAlbumsModel.HighestTrackRating
+
+                            sortRoles: [AllAlbumsModel.ArtistRole, AllAlbumsModel.TitleRole]
+
                             filterText: filterBar.filterText
 
                             filterRating: filterBar.filterRating
@@ -89,12 +89,14 @@ FocusScope {
                     model: DelegateModel {
                         id: delegateContentModel
 
-                        model: SortFilterProxyModel {
+                        model: LibrarySortFilterProxyModel {
                             sourceModel: artistsModel
 
-                            filterRole: AllArtistsModel.NameRole
+                            filterRoles: [AllArtistsModel.NameRole]
 
-                            filterRegExp: new RegExp(filterBar.filterText, 'i')
+                            sortRoles: [AllArtistsModel.NameRole]
+
+                            filterText: filterBar.filterText
                         }
 
                         delegate: MediaArtistDelegate {
@@ -135,7 +137,6 @@ FocusScope {
 
         MediaArtistAlbumView {
             playListModel: rootElement.playListModel
-            contentDirectoryModel: rootElement.contentDirectoryModel
             playerControl: rootElement.playerControl
             stackView: rootElement.stackView
             musicListener: rootElement.musicListener
@@ -79,9 +79,16 @@ FocusScope {
                     model: DelegateModel {
                         id: delegateContentModel
 
-                        model: AlbumFilterProxyModel {
+                        model: LibrarySortFilterProxyModel {
                             sourceModel: rootElement.tracksModel
 
+                            filterRoles: [AllTracksModel.TitleRole, AllTracksModel.ArtistRole, AllTracksModel.AlbumRole]
+
+                            ratingRole: AllTracksModel.RatingRole
+
+                            sortRoles: [AllTracksModel.AlbumArtistRole, AllTracksModel.AlbumRole,
+                                        AllTracksModel.DiscNumberRole, AllTracksModel.TrackNumberRole]
+
                             filterText: filterBar.filterText
 
                             filterRating: filterBar.filterRating
@@ -33,7 +33,6 @@ Item {
     property MediaPlayList playListModel
     property var musicListener
     property var playerControl
-    property var contentDirectoryModel
 
     property alias artistName: navBar.artist
 
@@ -50,6 +49,18 @@ Item {
         id: elisaTheme
     }
 
+    Connections {
+        target: rootElement.musicListener
+
+        onAlbumsFromArtistFetched: artistAlbumsModel.albumsFromArtistFetched(artistName, albums)
+
+        onAlbumsAdded: artistAlbumsModel.libraryAlbumsAdded(newAlbums)
+
+        onAlbumsRemoved: artistAlbumsModel.libraryAlbumsRemoved(removedAlbums)
+
+        onAlbumsModified: artistAlbumsModel.libraryAlbumsModified(modifiedAlbums)
+    }
+
     ColumnLayout {
         anchors.fill: parent
         spacing: 0
@@ -110,11 +121,27 @@ Item {
                     model: DelegateModel {
                         id: delegateContentModel
 
-                        model: SortFilterProxyModel {
-                            sourceModel: contentDirectoryModel
-                            filterRole: AllAlbumsModel.AllArtistsRole
+                        model: LibrarySortFilterProxyModel {
+                            sourceModel: ArtistAlbumsModel {
+                                id: artistAlbumsModel
+
+                                property bool albumsFetched: false
+
+                                artist: artistName
+
+                                onArtistChanged: {
+                                    albumsFetched = true
+                                    rootElement.musicListener.fetchAlbumsFromArtist(artist)
+                                }
+
+                                Component.onCompleted: {
+                                    if (!albumsFetched) {
+                                        rootElement.musicListener.fetchAlbumsFromArtist(artist)
+                                    }
+                                }
+                            }
 
-                            filterRegExp: new RegExp('.*' + artistName + '.*', 'i')
+                            sortRoles: [AllAlbumsModel.TitleRole]
                         }
 
                         delegate: MediaAlbumDelegate {
@@ -111,7 +111,7 @@ ApplicationWindow {
             persistentSettings.width = mainWindow.width;
             persistentSettings.height = mainWindow.height;
 
-            persistentSettings.playListState = playListModelItem.persistentState;
+            persistentSettings.playListState = undefined;
             persistentSettings.playListControlerState = playListModelItem.persistentState;
             persistentSettings.audioPlayerState = manageAudioPlayer.persistentState
 
@@ -274,42 +274,19 @@ ApplicationWindow {
     Connections {
         target: allListeners
 
-        onAlbumAdded: {
-            busyScanningMusic.running = false
-            allAlbumsModel.albumAdded(newAlbum)
-        }
-    }
-
-    Connections {
-        target: allListeners
-
-        onAlbumRemoved: {
-            allAlbumsModel.albumRemoved(removedAlbum)
-        }
-    }
-
-    Connections {
-        target: allListeners
-
-        onAlbumModified: allAlbumsModel.albumModified(modifiedAlbum)
-    }
-
-    Connections {
-        target: allListeners
-
-        onTracksAdded: allTracksModel.tracksAdded(allTracks)
+        onAlbumsAdded: busyScanningMusic.running = false
     }
 
     Connections {
         target: allListeners
 
-        onTrackRemoved: allTracksModel.trackRemoved(id)
+        onAlbumsChangesComputed: allAlbumsModel.applyChanges(changes)
     }
 
     Connections {
         target: allListeners
 
-        onTrackModified: allTracksModel.trackModified(modifiedTrack)
+        onTracksChangesComputed: allTracksModel.applyChanges(changes)
     }
 
     AllArtistsModel {
@@ -319,13 +296,13 @@ ApplicationWindow {
     Connections {
         target: allListeners
 
-        onArtistAdded: allArtistsModel.artistAdded(newArtist)
+        onArtistsAdded: allArtistsModel.artistsAdded(newArtists)
     }
 
     Connections {
         target: allListeners
 
-        onArtistRemoved: allArtistsModel.artistRemoved(removedArtist)
+        onArtistsRemoved: allArtistsModel.artistsRemoved(removedArtists)
     }
 
     Connections {
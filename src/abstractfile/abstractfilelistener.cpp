@@ -22,8 +22,11 @@
 #include "abstractfilelisting.h"
 #include "databaseinterface.h"
 #include "notificationitem.h"
+#include "musicaudiotrack.h"
+#include "indexingstatistics.h"
 
 #include <QThread>
+#include <QElapsedTimer>
 
 class AbstractFileListenerPrivate
 {
@@ -37,6 +40,8 @@ public:
 
     AbstractFileListing *mFileListing = nullptr;
 
+    const int mMaximumPendingBatches = 2;
+
 };
 
 AbstractFileListener::AbstractFileListener(QObject *parent)
@@ -59,10 +64,25 @@ void AbstractFileListener::setDatabaseInterface(DatabaseInterface *model)
 {
     if (model) {
         connect(this, &AbstractFileListener::newTrackFile, d->mFileListing, &AbstractFileListing::newTrackFile);
-        connect(d->mFileListing, &AbstractFileListing::tracksList, model, &DatabaseInterface::insertTracksList);
+        auto fileListing = d->mFileListing;
+        connect(d->mFileListing, &AbstractFileListing::tracksList, model,
+                [model, fileListing](const QList<MusicAudioTrack> &tracks, const QString &musicSource) {
+            QElapsedTimer commitTimer;
+            commitTimer.start();
+
+            model->insertTracksList(tracks, musicSource);
+
+            fileListing->tracksListCommitted(tracks.size(), commitTimer.elapsed());
+        });
+        d->mFileListing->setMaximumPendingBatches(d->mMaximumPendingBatches);
         connect(d->mFileListing, &AbstractFileListing::removedTracksList, model, &DatabaseInterface::removeTracksList);
+        connect(d->mFileListing, &AbstractFileListing::renamedTracksList, model, &DatabaseInterface::renameTracksList);
+        connect(d->mFileListing, &AbstractFileListing::extractionFailed, model, &DatabaseInterface::insertExtractionFailure);
+        connect(model, &DatabaseInterface::extractionFailuresList, d->mFileListing,
+                &AbstractFileListing::setExtractionFailures, Qt::DirectConnection);
         connect(d->mFileListing, &AbstractFileListing::modifyTracksList, model, &DatabaseInterface::modifyTracksList);
 
+        QMetaObject::invokeMethod(model, "askExtractionFailures", Qt::QueuedConnection);
         QMetaObject::invokeMethod(d->mFileListing, "init", Qt::QueuedConnection);
     }
 
@@ -104,6 +124,8 @@ void AbstractFileListener::setFileListing(AbstractFileListing *fileIndexer)
             this, &AbstractFileListener::closeNotification);
     connect(fileIndexer, &AbstractFileListing::importedTracksCountChanged,
             this, &AbstractFileListener::importedTracksCountChanged);
+    connect(fileIndexer, &AbstractFileListing::pendingBatchesCountChanged,
+            this, &AbstractFileListener::pendingBatchesCountChanged);
 }
 
 AbstractFileListing *AbstractFileListener::fileListing() const
@@ -120,6 +142,24 @@ int AbstractFileListener::importedTracksCount() const
     return d->mFileListing->importedTracksCount();
 }
 
+int AbstractFileListener::pendingBatchesCount() const
+{
+    if (!d->mFileListing) {
+        return 0;
+    }
+
+    return d->mFileListing->pendingBatchesCount();
+}
+
+QVariantMap AbstractFileListener::indexingStatistics() const
+{
+    if (!d->mFileListing) {
+        return {};
+    }
+
+    return d->mFileListing->indexingStatistics().toVariantMap();
+}
+
 void AbstractFileListener::performInitialScan()
 {
     d->mFileListing->refreshContent();
@@ -25,6 +25,7 @@
 #include <QObject>
 #include <QVector>
 #include <QString>
+#include <QVariantMap>
 
 #include <memory>
 
@@ -46,6 +47,10 @@ class AbstractFileListener : public QObject
                READ importedTracksCount
                NOTIFY importedTracksCountChanged)
 
+    Q_PROPERTY(int pendingBatchesCount
+               READ pendingBatchesCount
+               NOTIFY pendingBatchesCountChanged)
+
 public:
     explicit AbstractFileListener(QObject *parent = nullptr);
 
@@ -57,6 +62,10 @@ public:
 
     int importedTracksCount() const;
 
+    int pendingBatchesCount() const;
+
+    Q_INVOKABLE QVariantMap indexingStatistics() const;
+
 Q_SIGNALS:
 
     void databaseInterfaceChanged();
@@ -73,6 +82,8 @@ Q_SIGNALS:
 
     void importedTracksCountChanged();
 
+    void pendingBatchesCountChanged();
+
     void newNotification(NotificationItem notification);
 
     void closeNotification(QString notificationId);
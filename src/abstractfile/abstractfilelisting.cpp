@@ -22,6 +22,10 @@
 #include "musicaudiotrack.h"
 #include "notificationitem.h"
 #include "elisautils.h"
+#include "audiotagreader.h"
+#include "scanscheduler.h"
+#include "indexingstatistics.h"
+#include "extractorworker.h"
 
 #include <KFileMetaData/Properties>
 #include <KFileMetaData/ExtractorCollection>
@@ -38,12 +42,39 @@
 #include <QSet>
 #include <QPair>
 #include <QAtomicInt>
+#include <QSemaphore>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QStandardPaths>
+#include <QCryptographicHash>
+#include <QSaveFile>
+#include <QTimer>
+#include <QFile>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QDebug>
 
 #include <QtGlobal>
 
 #include <algorithm>
 #include <utility>
 
+#if defined Q_OS_UNIX
+#include <sys/stat.h>
+#endif
+
+class DirectoryScanPass
+{
+public:
+
+    QHash<QPair<quint64, quint64>, QPair<QUrl, bool>> mRemovedFiles;
+
+    QList<QPair<QUrl, bool>> mRemovedFilesWithoutIdentifier;
+
+    QList<QPair<QUrl, QUrl>> mAddedFiles;
+
+};
+
 class AbstractFileListingPrivate
 {
 public:
@@ -54,30 +85,93 @@ public:
 
     QFileSystemWatcher mFileSystemWatcher;
 
-    QHash<QString, QUrl> mAllAlbumCover;
+    QHash<QUrl, QUrl> mDirectoryCovers;
+
+    QSet<QUrl> mDirectoriesWithoutCoverFile;
+
+    QSet<QUrl> mDirectoriesWithoutCover;
+
+    static QPair<quint64, quint64> fileIdentifier(const QUrl &fileName);
 
     QHash<QUrl, QSet<QPair<QUrl, bool>>> mDiscoveredFiles;
 
+    QHash<QUrl, QPair<quint64, quint64>> mFileIdentifiers;
+
+    QHash<QUrl, QDateTime> mDirectoryModificationTimes;
+
+    QHash<QPair<quint64, quint64>, QPair<QUrl, bool>> mPendingRemovedFiles;
+
+    bool mPendingRemovalScheduled = false;
+
+    const int mRenameDetectionDelay = 1000;
+
     QString mSourceName;
 
     bool mHandleNewFiles = true;
 
+    bool mWatchFileSystem = true;
+
     KFileMetaData::ExtractorCollection mExtractors;
 
+    AudioTagReader mTagReader;
+
     QAtomicInt mStopRequest = 0;
 
     QMimeDatabase mMimeDb;
 
+    QByteArray mScanDevice;
+
+    IndexingStatistics mStatistics;
+
+    std::unique_ptr<ExtractorWorker> mExtractorWorker;
+
+    QMutex mExtractionFailuresMutex;
+
+    QHash<QUrl, QDateTime> mExtractionFailures;
+
     int mImportedTracksCount = 0;
 
+    QSemaphore mPendingBatchesSlots;
+
+    QAtomicInt mMaximumPendingBatches = 0;
+
+    QAtomicInt mPendingBatches = 0;
+
+    QAtomicInt mBatchSize = 500;
+
+    const int mMinimumBatchSize = 50;
+
+    const int mMaximumBatchSize = 5000;
+
+    const qint64 mTargetCommitDuration = 250;
+
 };
 
+QPair<quint64, quint64> AbstractFileListingPrivate::fileIdentifier(const QUrl &fileName)
+{
+#if defined Q_OS_UNIX
+    struct stat fileStatus;
+
+    if (::stat(QFile::encodeName(fileName.toLocalFile()).constData(), &fileStatus) == 0) {
+        return {quint64(fileStatus.st_dev), quint64(fileStatus.st_ino)};
+    }
+#else
+    Q_UNUSED(fileName);
+#endif
+
+    return {};
+}
+
 AbstractFileListing::AbstractFileListing(const QString &sourceName, QObject *parent) : QObject(parent), d(std::make_unique<AbstractFileListingPrivate>(sourceName))
 {
     connect(&d->mFileSystemWatcher, &QFileSystemWatcher::directoryChanged,
             this, &AbstractFileListing::directoryChanged);
     connect(&d->mFileSystemWatcher, &QFileSystemWatcher::fileChanged,
             this, &AbstractFileListing::fileChanged);
+    connect(this, &AbstractFileListing::indexingStarted,
+            this, &AbstractFileListing::resetIndexingStatistics);
+    connect(this, &AbstractFileListing::indexingFinished,
+            this, &AbstractFileListing::logIndexingStatistics);
 }
 
 AbstractFileListing::~AbstractFileListing()
@@ -90,10 +184,16 @@ void AbstractFileListing::init()
 
 void AbstractFileListing::newTrackFile(const MusicAudioTrack &partialTrack)
 {
-    const auto &newTrack = scanOneFile(partialTrack.resourceURI());
+    auto newTrack = scanOneFile(partialTrack.resourceURI());
 
-    if (newTrack.isValid() && newTrack != partialTrack) {
-        Q_EMIT modifyTracksList({newTrack}, d->mAllAlbumCover, d->mSourceName);
+    if (!newTrack.isValid()) {
+        return;
+    }
+
+    addCover(newTrack);
+
+    if (newTrack != partialTrack) {
+        Q_EMIT modifyTracksList({newTrack}, d->mSourceName);
     }
 }
 
@@ -107,94 +207,95 @@ void AbstractFileListing::applicationAboutToQuit()
     d->mStopRequest = 1;
 }
 
-void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const QUrl &path)
+void AbstractFileListing::scanDirectories(QList<MusicAudioTrack> &newFiles, const QList<QUrl> &paths, bool deferRemovals)
 {
     if (d->mStopRequest == 1) {
         return;
     }
 
-    QDir rootDirectory(path.toLocalFile());
-    rootDirectory.refresh();
+    auto scanPass = DirectoryScanPass();
 
-    if (rootDirectory.exists()) {
-        watchPath(path.toLocalFile());
+    for (const auto &onePath : paths) {
+        listDirectory(onePath, scanPass);
     }
 
-    auto &currentDirectoryListingFiles = d->mDiscoveredFiles[path];
+    auto allRenamedFiles = QHash<QUrl, QUrl>();
+    auto newTrackFiles = QList<QPair<QUrl, QUrl>>();
 
-    auto currentFilesList = QSet<QUrl>();
+    for (int i = 0; i < scanPass.mAddedFiles.size() && d->mStopRequest == 0; ++i) {
+        const auto newFilePath = scanPass.mAddedFiles[i].first;
+        const auto parentDirectory = scanPass.mAddedFiles[i].second;
+        const auto newFileIdentifier = AbstractFileListingPrivate::fileIdentifier(newFilePath);
 
-    rootDirectory.refresh();
-    const auto entryList = rootDirectory.entryInfoList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs);
-    for (const auto &oneEntry : entryList) {
-        auto newFilePath = QUrl::fromLocalFile(oneEntry.canonicalFilePath());
+        const auto itRemovedFile = scanPass.mRemovedFiles.find(newFileIdentifier);
+        if (itRemovedFile != scanPass.mRemovedFiles.end()) {
+            const auto oldFilePath = itRemovedFile->first;
+            scanPass.mRemovedFiles.erase(itRemovedFile);
 
-        if (oneEntry.isDir() || oneEntry.isFile()) {
-            currentFilesList.insert(newFilePath);
+            renameFile(oldFilePath, newFilePath, allRenamedFiles);
+
+            continue;
         }
-    }
 
-    auto removedTracks = QVector<QPair<QUrl, bool>>();
-    for (const auto &removedFilePath : currentDirectoryListingFiles) {
-        auto itFilePath = std::find(currentFilesList.begin(), currentFilesList.end(), removedFilePath.first);
+        const auto itPendingFile = d->mPendingRemovedFiles.find(newFileIdentifier);
+        if (itPendingFile != d->mPendingRemovedFiles.end()) {
+            const auto oldFilePath = itPendingFile->first;
+            d->mPendingRemovedFiles.erase(itPendingFile);
+
+            renameFile(oldFilePath, newFilePath, allRenamedFiles);
 
-        if (itFilePath != currentFilesList.end()) {
             continue;
         }
 
-        removedTracks.push_back(removedFilePath);
+        QFileInfo oneEntry(newFilePath.toLocalFile());
+
+        if (oneEntry.isDir()) {
+            addFileInDirectory(newFilePath, parentDirectory);
+            listDirectory(newFilePath, scanPass);
+        } else if (oneEntry.isFile()) {
+            newTrackFiles.push_back(scanPass.mAddedFiles[i]);
+        }
     }
 
     auto allRemovedTracks = QList<QUrl>();
-    for (const auto &oneRemovedTrack : removedTracks) {
-        if (oneRemovedTrack.second) {
-            allRemovedTracks.push_back(oneRemovedTrack.first);
+
+    for (const auto &oneRemovedFile : qAsConst(scanPass.mRemovedFilesWithoutIdentifier)) {
+        discardFile(oneRemovedFile, allRemovedTracks);
+    }
+
+    for (auto itRemovedFile = scanPass.mRemovedFiles.cbegin(); itRemovedFile != scanPass.mRemovedFiles.cend(); ++itRemovedFile) {
+        if (deferRemovals) {
+            d->mPendingRemovedFiles[itRemovedFile.key()] = itRemovedFile.value();
         } else {
-            removeFile(oneRemovedTrack.first, allRemovedTracks);
+            discardFile(itRemovedFile.value(), allRemovedTracks);
         }
     }
-    for (const auto &oneRemovedTrack : removedTracks) {
-        currentDirectoryListingFiles.remove(oneRemovedTrack);
-        currentDirectoryListingFiles.remove(oneRemovedTrack);
-    }
 
     if (!allRemovedTracks.isEmpty()) {
         Q_EMIT removedTracksList(allRemovedTracks);
     }
 
-    if (!d->mHandleNewFiles) {
-        return;
+    if (!allRenamedFiles.isEmpty()) {
+        Q_EMIT renamedTracksList(allRenamedFiles);
     }
 
-    for (const auto &newFilePath : currentFilesList) {
-        QFileInfo oneEntry(newFilePath.toLocalFile());
-
-        auto itFilePath = std::find(currentDirectoryListingFiles.begin(), currentDirectoryListingFiles.end(), QPair<QUrl, bool>{newFilePath, oneEntry.isFile()});
-
-        if (itFilePath != currentDirectoryListingFiles.end()) {
-            continue;
-        }
-
-        if (oneEntry.isDir()) {
-            addFileInDirectory(newFilePath, path);
-            scanDirectory(newFiles, newFilePath);
-
-            if (d->mStopRequest == 1) {
-                break;
-            }
+    if (!d->mPendingRemovedFiles.isEmpty() && !d->mPendingRemovalScheduled) {
+        d->mPendingRemovalScheduled = true;
+        QTimer::singleShot(d->mRenameDetectionDelay, this, &AbstractFileListing::removePendingFiles);
+    }
 
-            continue;
-        }
-        if (!oneEntry.isFile()) {
-            continue;
+    for (const auto &oneNewFile : qAsConst(newTrackFiles)) {
+        if (d->mStopRequest == 1) {
+            Q_EMIT importedTracksCountChanged();
+            break;
         }
 
-        auto newTrack = scanOneFile(newFilePath);
+        auto newTrack = scanOneFile(oneNewFile.first);
 
         if (newTrack.isValid() && d->mStopRequest == 0) {
             addCover(newTrack);
 
-            addFileInDirectory(newTrack.resourceURI(), path);
+            addFileInDirectory(newTrack.resourceURI(), oneNewFile.second);
             newFiles.push_back(newTrack);
 
             ++d->mImportedTracksCount;
@@ -202,18 +303,80 @@ void AbstractFileListing::scanDirectory(QList<MusicAudioTrack> &newFiles, const
                 Q_EMIT importedTracksCountChanged();
             }
 
-            if (newFiles.size() > 500 && d->mStopRequest == 0) {
+            if (newFiles.size() >= batchSize() && d->mStopRequest == 0) {
                 Q_EMIT importedTracksCountChanged();
                 emitNewFiles(newFiles);
                 newFiles.clear();
             }
         }
+    }
+}
 
-        if (d->mStopRequest == 1) {
-            Q_EMIT importedTracksCountChanged();
-            break;
+void AbstractFileListing::listDirectory(const QUrl &path, DirectoryScanPass &scanPass)
+{
+    QElapsedTimer walkTimer;
+    walkTimer.start();
+
+    QDir rootDirectory(path.toLocalFile());
+    rootDirectory.refresh();
+
+    if (!rootDirectory.exists()) {
+        return;
+    }
+
+    watchPath(path.toLocalFile());
+
+    d->mDirectoryModificationTimes[path] = QFileInfo(path.toLocalFile()).lastModified();
+
+    auto &currentDirectoryListingFiles = d->mDiscoveredFiles[path];
+
+    auto currentFilesList = QSet<QUrl>();
+
+    const auto entryList = rootDirectory.entryInfoList(QDir::NoDotAndDotDot | QDir::Files | QDir::Dirs);
+    for (const auto &oneEntry : entryList) {
+        if (oneEntry.isDir() || oneEntry.isFile()) {
+            currentFilesList.insert(QUrl::fromLocalFile(oneEntry.canonicalFilePath()));
+        }
+    }
+
+    for (auto itFile = currentDirectoryListingFiles.begin(); itFile != currentDirectoryListingFiles.end(); ) {
+        if (currentFilesList.contains(itFile->first)) {
+            ++itFile;
+            continue;
+        }
+
+        const auto &removedFileIdentifier = d->mFileIdentifiers.value(itFile->first);
+        if (removedFileIdentifier != QPair<quint64, quint64>{}) {
+            scanPass.mRemovedFiles[removedFileIdentifier] = *itFile;
+        } else {
+            scanPass.mRemovedFilesWithoutIdentifier.push_back(*itFile);
+        }
+
+        itFile = currentDirectoryListingFiles.erase(itFile);
+    }
+
+    if (d->mHandleNewFiles) {
+        for (const auto &newFilePath : qAsConst(currentFilesList)) {
+            const auto isFile = QFileInfo(newFilePath.toLocalFile()).isFile();
+
+            if (!currentDirectoryListingFiles.contains({newFilePath, isFile})) {
+                scanPass.mAddedFiles.push_back({newFilePath, path});
+            }
         }
     }
+
+    d->mStatistics.addDuration(IndexingStatistics::Walk, walkTimer.nsecsElapsed() / 1000);
+}
+
+void AbstractFileListing::discardFile(const QPair<QUrl, bool> &removedFile, QList<QUrl> &allRemovedFiles)
+{
+    d->mFileIdentifiers.remove(removedFile.first);
+
+    if (removedFile.second) {
+        allRemovedFiles.push_back(removedFile.first);
+    } else {
+        removeFile(removedFile.first, allRemovedFiles);
+    }
 }
 
 const QString &AbstractFileListing::sourceName() const
@@ -226,6 +389,82 @@ int AbstractFileListing::importedTracksCount() const
     return d->mImportedTracksCount;
 }
 
+int AbstractFileListing::pendingBatchesCount() const
+{
+    return d->mPendingBatches;
+}
+
+int AbstractFileListing::batchSize() const
+{
+    return d->mBatchSize;
+}
+
+void AbstractFileListing::setMaximumPendingBatches(int maximumPendingBatches)
+{
+    const auto previousMaximum = int(d->mMaximumPendingBatches);
+
+    if (maximumPendingBatches > previousMaximum) {
+        d->mPendingBatchesSlots.release(maximumPendingBatches - previousMaximum);
+    } else if (maximumPendingBatches < previousMaximum) {
+        d->mPendingBatchesSlots.acquire(previousMaximum - std::max(maximumPendingBatches, 0));
+    }
+
+    d->mMaximumPendingBatches = std::max(maximumPendingBatches, 0);
+}
+
+void AbstractFileListing::tracksListCommitted(int tracksCount, qint64 commitDuration)
+{
+    if (d->mMaximumPendingBatches > 0 && d->mPendingBatches > 0) {
+        d->mPendingBatches.deref();
+        d->mPendingBatchesSlots.release();
+        Q_EMIT pendingBatchesCountChanged();
+    }
+
+    d->mStatistics.addDuration(IndexingStatistics::Commit, commitDuration * 1000);
+
+    if (tracksCount < d->mMinimumBatchSize) {
+        return;
+    }
+
+    const auto wantedBatchSize = tracksCount * d->mTargetCommitDuration / std::max<qint64>(commitDuration, 1);
+    const auto previousBatchSize = int(d->mBatchSize);
+    const auto newBatchSize = qBound<qint64>(d->mMinimumBatchSize, (3 * previousBatchSize + wantedBatchSize) / 4, d->mMaximumBatchSize);
+
+    if (newBatchSize != previousBatchSize) {
+        d->mBatchSize = static_cast<int>(newBatchSize);
+        Q_EMIT batchSizeChanged();
+    }
+}
+
+void AbstractFileListing::setExtractionFailures(const QHash<QUrl, QDateTime> &failedFiles)
+{
+    QMutexLocker locker(&d->mExtractionFailuresMutex);
+
+    for (auto itFile = failedFiles.begin(); itFile != failedFiles.end(); ++itFile) {
+        d->mExtractionFailures[itFile.key()] = itFile.value();
+    }
+}
+
+IndexingStatistics AbstractFileListing::indexingStatistics() const
+{
+    return d->mStatistics;
+}
+
+IndexingStatistics &AbstractFileListing::statistics()
+{
+    return d->mStatistics;
+}
+
+void AbstractFileListing::resetIndexingStatistics()
+{
+    d->mStatistics.reset();
+}
+
+void AbstractFileListing::logIndexingStatistics()
+{
+    qDebug() << "AbstractFileListing::logIndexingStatistics" << d->mSourceName << d->mStatistics.summary();
+}
+
 void AbstractFileListing::directoryChanged(const QString &path)
 {
     const auto directoryEntry = d->mDiscoveredFiles.find(QUrl::fromLocalFile(path));
@@ -235,7 +474,7 @@ void AbstractFileListing::directoryChanged(const QString &path)
 
     Q_EMIT indexingStarted();
 
-    scanDirectoryTree(path);
+    scanDirectoryTree(path, true);
 
     Q_EMIT indexingFinished();
 }
@@ -247,7 +486,9 @@ void AbstractFileListing::fileChanged(const QString &modifiedFileName)
     auto modifiedTrack = scanOneFile(modifiedFile);
 
     if (modifiedTrack.isValid()) {
-        Q_EMIT modifyTracksList({modifiedTrack}, d->mAllAlbumCover, d->mSourceName);
+        addCover(modifiedTrack);
+
+        Q_EMIT modifyTracksList({modifiedTrack}, d->mSourceName);
     }
 }
 
@@ -269,20 +510,94 @@ MusicAudioTrack AbstractFileListing::scanOneFile(const QUrl &scanFile)
 {
     MusicAudioTrack newTrack;
 
-    newTrack = ElisaUtils::scanOneFile(scanFile, d->mMimeDb, d->mExtractors);
+    QFileInfo scanFileInfo(scanFile.toLocalFile());
+
+    {
+        QMutexLocker locker(&d->mExtractionFailuresMutex);
+
+        const auto itFailure = d->mExtractionFailures.constFind(scanFile);
+        if (itFailure != d->mExtractionFailures.constEnd() && *itFailure == scanFileInfo.lastModified()) {
+            return newTrack;
+        }
+    }
+
+    const auto previousBytesRead = d->mTagReader.bytesRead();
+
+    QString fileMimeType;
+    qint64 bytesRead = 0;
+
+    if (!ElisaUtils::readOneFile(scanFile, d->mMimeDb, d->mTagReader, newTrack, fileMimeType, &d->mStatistics)) {
+        auto extractionResult = ExtractorWorker::Result::Unavailable;
+        quint64 helperBytesRead = 0;
+
+        QElapsedTimer extractTimer;
+        extractTimer.start();
+
+        if (ExtractorWorker::isEnabled()) {
+            if (!d->mExtractorWorker) {
+                d->mExtractorWorker = std::make_unique<ExtractorWorker>();
+            }
+
+            extractionResult = d->mExtractorWorker->extract(scanFile, newTrack, helperBytesRead, d->mStopRequest);
+        }
+
+        switch (extractionResult)
+        {
+        case ExtractorWorker::Result::Unavailable:
+            newTrack = ElisaUtils::extractOneFile(scanFile, fileMimeType, d->mExtractors);
+            bytesRead = scanFileInfo.size();
+            break;
+        case ExtractorWorker::Result::Failed:
+        {
+            newTrack = {};
+
+            const auto &fileModifiedTime = scanFileInfo.lastModified();
+
+            {
+                QMutexLocker locker(&d->mExtractionFailuresMutex);
+                d->mExtractionFailures[scanFile] = fileModifiedTime;
+            }
+
+            Q_EMIT extractionFailed(scanFile, fileModifiedTime);
+            break;
+        }
+        case ExtractorWorker::Result::TransportError:
+            newTrack = {};
+            qDebug() << "AbstractFileListing::scanOneFile" << scanFile << "will be extracted again by the next scan";
+            break;
+        case ExtractorWorker::Result::Extracted:
+            bytesRead = static_cast<qint64>(helperBytesRead);
+            break;
+        case ExtractorWorker::Result::Aborted:
+            break;
+        }
+
+        d->mStatistics.addDuration(IndexingStatistics::Extract, extractTimer.nsecsElapsed() / 1000);
+    }
 
     if (newTrack.isValid()) {
-        QFileInfo scanFileInfo(scanFile.toLocalFile());
         if (scanFileInfo.exists()) {
             watchPath(scanFile.toLocalFile());
         }
     }
 
+    bytesRead += d->mTagReader.bytesRead() - previousBytesRead;
+
+    d->mStatistics.addFiles(1, bytesRead);
+
+    if (!d->mScanDevice.isEmpty()) {
+        ScanScheduler::instance().throttle(d->mScanDevice, bytesRead, d->mStopRequest);
+    }
+
     return newTrack;
 }
 
 void AbstractFileListing::watchPath(const QString &pathName)
 {
+    if (!d->mWatchFileSystem) {
+        return;
+    }
+
     d->mFileSystemWatcher.addPath(pathName);
 }
 
@@ -304,19 +619,21 @@ void AbstractFileListing::addFileInDirectory(const QUrl &newFile, const QUrl &di
             auto &parentCurrentDirectoryListingFiles = d->mDiscoveredFiles[parentDirectory];
 
             parentCurrentDirectoryListingFiles.insert({directoryName, false});
+            d->mFileIdentifiers[directoryName] = AbstractFileListingPrivate::fileIdentifier(directoryName);
         }
     }
     auto &currentDirectoryListingFiles = d->mDiscoveredFiles[directoryName];
 
     QFileInfo isAFile(newFile.toLocalFile());
     currentDirectoryListingFiles.insert({newFile, isAFile.isFile()});
+    d->mFileIdentifiers[newFile] = AbstractFileListingPrivate::fileIdentifier(newFile);
 }
 
-void AbstractFileListing::scanDirectoryTree(const QString &path)
+void AbstractFileListing::scanDirectoryTree(const QString &path, bool deferRemovals)
 {
     auto newFiles = QList<MusicAudioTrack>();
 
-    scanDirectory(newFiles, QUrl::fromLocalFile(path));
+    scanDirectories(newFiles, {QUrl::fromLocalFile(path)}, deferRemovals);
 
     if (!newFiles.isEmpty() && d->mStopRequest == 0) {
         Q_EMIT importedTracksCountChanged();
@@ -329,24 +646,169 @@ void AbstractFileListing::setHandleNewFiles(bool handleThem)
     d->mHandleNewFiles = handleThem;
 }
 
-void AbstractFileListing::emitNewFiles(const QList<MusicAudioTrack> &tracks)
+void AbstractFileListing::setWatchFileSystem(bool watchIt)
 {
-    Q_EMIT tracksList(tracks, d->mAllAlbumCover, d->mSourceName);
+    d->mWatchFileSystem = watchIt;
 }
 
-void AbstractFileListing::addCover(const MusicAudioTrack &newTrack)
+void AbstractFileListing::rescanModifiedDirectories()
 {
-    auto itCover = d->mAllAlbumCover.find(newTrack.albumName());
-    if (itCover != d->mAllAlbumCover.end()) {
+    auto allDirectories = d->mDirectoryModificationTimes.keys();
+    std::sort(allDirectories.begin(), allDirectories.end(), [](const QUrl &first, const QUrl &second) {
+        return first.toLocalFile() < second.toLocalFile();
+    });
+
+    auto modifiedDirectories = QList<QUrl>();
+
+    for (const auto &oneDirectory : allDirectories) {
+        QFileInfo directoryInfo(oneDirectory.toLocalFile());
+        if (!directoryInfo.exists() || directoryInfo.lastModified() == d->mDirectoryModificationTimes.value(oneDirectory)) {
+            continue;
+        }
+
+        modifiedDirectories.push_back(oneDirectory);
+    }
+
+    if (modifiedDirectories.isEmpty() || d->mStopRequest == 1) {
         return;
     }
 
-    QFileInfo trackFilePath(newTrack.resourceURI().toLocalFile());
-    QFileInfo coverFilePath(trackFilePath.dir().filePath(QStringLiteral("cover.jpg")));
+    Q_EMIT indexingStarted();
+
+    auto newFiles = QList<MusicAudioTrack>();
+
+    scanDirectories(newFiles, modifiedDirectories, false);
+
+    if (!newFiles.isEmpty() && d->mStopRequest == 0) {
+        Q_EMIT importedTracksCountChanged();
+        emitNewFiles(newFiles);
+    }
+
+    Q_EMIT indexingFinished();
+}
+
+void AbstractFileListing::emitNewFiles(const QList<MusicAudioTrack> &tracks)
+{
+    QElapsedTimer enqueueTimer;
+    enqueueTimer.start();
+
+    if (d->mMaximumPendingBatches > 0) {
+        while (!d->mPendingBatchesSlots.tryAcquire(1, 100)) {
+            if (d->mStopRequest == 1) {
+                return;
+            }
+        }
+
+        d->mPendingBatches.ref();
+        Q_EMIT pendingBatchesCountChanged();
+    }
+
+    Q_EMIT tracksList(tracks, d->mSourceName);
+
+    d->mStatistics.addDuration(IndexingStatistics::Enqueue, enqueueTimer.nsecsElapsed() / 1000);
+}
+
+void AbstractFileListing::addCover(MusicAudioTrack &newTrack)
+{
+    QElapsedTimer coverTimer;
+    coverTimer.start();
+
+    const auto &albumDirectory = newTrack.resourceURI().adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash);
+
+    const auto itCover = d->mDirectoryCovers.constFind(albumDirectory);
+    if (itCover != d->mDirectoryCovers.constEnd()) {
+        newTrack.setAlbumCover(*itCover);
+    } else {
+        auto coverFile = QUrl();
+
+        if (!d->mDirectoriesWithoutCoverFile.contains(albumDirectory)) {
+            coverFile = findCoverFile(albumDirectory);
+
+            if (coverFile.isEmpty()) {
+                d->mDirectoriesWithoutCoverFile.insert(albumDirectory);
+            }
+        }
+
+        if (coverFile.isEmpty() && !d->mDirectoriesWithoutCover.contains(albumDirectory)) {
+            coverFile = extractEmbeddedCover(newTrack.resourceURI());
+
+            if (coverFile.isEmpty()) {
+                d->mDirectoriesWithoutCover.insert(albumDirectory);
+            }
+        }
+
+        if (!coverFile.isEmpty()) {
+            d->mDirectoryCovers[albumDirectory] = coverFile;
+            newTrack.setAlbumCover(coverFile);
+        }
+    }
+
+    d->mStatistics.addDuration(IndexingStatistics::Cover, coverTimer.nsecsElapsed() / 1000);
+}
+
+QUrl AbstractFileListing::findCoverFile(const QUrl &albumDirectory) const
+{
+    static const QStringList coverBaseNames = {QStringLiteral("cover"), QStringLiteral("folder"), QStringLiteral("front")};
+    static const QStringList coverSuffixes = {QStringLiteral("jpg"), QStringLiteral("jpeg"), QStringLiteral("png"), QStringLiteral("webp")};
+
+    QStringList nameFilters;
+    for (const auto &oneBaseName : coverBaseNames) {
+        nameFilters.push_back(oneBaseName + QStringLiteral(".*"));
+    }
+
+    QDir directory(albumDirectory.toLocalFile());
+    const auto &candidates = directory.entryInfoList(nameFilters, QDir::Files | QDir::Readable);
+
+    for (const auto &oneBaseName : coverBaseNames) {
+        for (const auto &oneSuffix : coverSuffixes) {
+            for (const auto &oneCandidate : candidates) {
+                if (oneCandidate.completeBaseName().compare(oneBaseName, Qt::CaseInsensitive) == 0 &&
+                        oneCandidate.suffix().compare(oneSuffix, Qt::CaseInsensitive) == 0) {
+                    return QUrl::fromLocalFile(oneCandidate.absoluteFilePath());
+                }
+            }
+        }
+    }
+
+    return {};
+}
+
+QUrl AbstractFileListing::extractEmbeddedCover(const QUrl &trackFile)
+{
+    QByteArray coverData;
+
+    if (!d->mTagReader.readCover(trackFile.toLocalFile(), coverData)) {
+        return {};
+    }
+
+    const auto &coverMimeType = d->mMimeDb.mimeTypeForData(coverData);
+    if (!coverMimeType.name().startsWith(QStringLiteral("image/"))) {
+        return {};
+    }
+
+    const auto &coverCacheDirectory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + QStringLiteral("/covers");
+    const auto &coverFileName = coverCacheDirectory + QStringLiteral("/") +
+            QString::fromLatin1(QCryptographicHash::hash(coverData, QCryptographicHash::Sha1).toHex()) +
+            QStringLiteral(".") + coverMimeType.preferredSuffix();
 
-    if (coverFilePath.exists()) {
-        d->mAllAlbumCover[newTrack.resourceURI().toString()] = QUrl::fromLocalFile(coverFilePath.absoluteFilePath());
+    if (!QFileInfo::exists(coverFileName)) {
+        QDir().mkpath(coverCacheDirectory);
+
+        QSaveFile coverFile(coverFileName);
+        if (!coverFile.open(QIODevice::WriteOnly)) {
+            qDebug() << "AbstractFileListing::extractEmbeddedCover" << "cannot write" << coverFileName;
+            return {};
+        }
+
+        coverFile.write(coverData);
+
+        if (!coverFile.commit()) {
+            qDebug() << "AbstractFileListing::extractEmbeddedCover" << "cannot write" << coverFileName;
+            return {};
+        }
     }
+
+    return QUrl::fromLocalFile(coverFileName);
 }
 
 void AbstractFileListing::removeDirectory(const QUrl &removedDirectory, QList<QUrl> &allRemovedFiles)
@@ -359,6 +821,8 @@ void AbstractFileListing::removeDirectory(const QUrl &removedDirectory, QList<QU
 
     const auto &currentRemovedDirectory = *itRemovedDirectory;
     for (const auto &itFile : currentRemovedDirectory) {
+        d->mFileIdentifiers.remove(itFile.first);
+
         if (itFile.first.isValid() && !itFile.first.isEmpty()) {
             removeFile(itFile.first, allRemovedFiles);
             if (itFile.second) {
@@ -368,6 +832,10 @@ void AbstractFileListing::removeDirectory(const QUrl &removedDirectory, QList<QU
     }
 
     d->mDiscoveredFiles.erase(itRemovedDirectory);
+    d->mDirectoryModificationTimes.remove(removedDirectory);
+    d->mDirectoryCovers.remove(removedDirectory);
+    d->mDirectoriesWithoutCoverFile.remove(removedDirectory);
+    d->mDirectoriesWithoutCover.remove(removedDirectory);
 }
 
 void AbstractFileListing::removeFile(const QUrl &oneRemovedTrack, QList<QUrl> &allRemovedFiles)
@@ -378,6 +846,106 @@ void AbstractFileListing::removeFile(const QUrl &oneRemovedTrack, QList<QUrl> &a
     }
 }
 
+void AbstractFileListing::renameFile(const QUrl &oldFile, const QUrl &newFile, QHash<QUrl, QUrl> &allRenamedFiles)
+{
+    const auto &oldFileName = oldFile.toLocalFile();
+    const auto &newFileName = newFile.toLocalFile();
+    const auto &newParentDirectory = newFile.adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash);
+
+    const auto oldFileIdentifier = d->mFileIdentifiers.take(oldFile);
+    const auto itPendingFile = d->mPendingRemovedFiles.find(oldFileIdentifier);
+    if (itPendingFile != d->mPendingRemovedFiles.end() && itPendingFile->first == oldFile) {
+        d->mPendingRemovedFiles.erase(itPendingFile);
+    }
+
+    const auto itOldParentDirectory = d->mDiscoveredFiles.find(oldFile.adjusted(QUrl::RemoveFilename | QUrl::StripTrailingSlash));
+    if (itOldParentDirectory != d->mDiscoveredFiles.end()) {
+        itOldParentDirectory->remove({oldFile, true});
+        itOldParentDirectory->remove({oldFile, false});
+    }
+
+    if (d->mFileSystemWatcher.removePath(oldFileName)) {
+        watchPath(newFileName);
+    }
+
+    addFileInDirectory(newFile, newParentDirectory);
+
+    const auto itRenamedDirectory = d->mDiscoveredFiles.find(oldFile);
+    if (itRenamedDirectory == d->mDiscoveredFiles.end()) {
+        allRenamedFiles[oldFile] = newFile;
+        return;
+    }
+
+    const auto renamedDirectoryContent = *itRenamedDirectory;
+    d->mDiscoveredFiles.erase(itRenamedDirectory);
+    d->mDiscoveredFiles[newFile];
+
+    if (d->mDirectoryModificationTimes.contains(oldFile)) {
+        d->mDirectoryModificationTimes[newFile] = d->mDirectoryModificationTimes.take(oldFile);
+    }
+
+    for (const auto &oneFile : renamedDirectoryContent) {
+        const auto &oneNewFile = QUrl::fromLocalFile(newFileName + oneFile.first.toLocalFile().mid(oldFileName.size()));
+        renameFile(oneFile.first, oneNewFile, allRenamedFiles);
+    }
+
+    const auto itDirectoryCover = d->mDirectoryCovers.find(oldFile);
+    if (itDirectoryCover != d->mDirectoryCovers.end()) {
+        auto directoryCover = itDirectoryCover.value();
+        d->mDirectoryCovers.erase(itDirectoryCover);
+
+        const auto &coverFileName = directoryCover.toLocalFile();
+        if (coverFileName.startsWith(oldFileName + QLatin1Char('/'))) {
+            const auto &newCover = QUrl::fromLocalFile(newFileName + coverFileName.mid(oldFileName.size()));
+            allRenamedFiles[directoryCover] = newCover;
+            directoryCover = newCover;
+        }
+
+        d->mDirectoryCovers[newFile] = directoryCover;
+    }
+
+    if (d->mDirectoriesWithoutCoverFile.remove(oldFile)) {
+        d->mDirectoriesWithoutCoverFile.insert(newFile);
+    }
+
+    if (d->mDirectoriesWithoutCover.remove(oldFile)) {
+        d->mDirectoriesWithoutCover.insert(newFile);
+    }
+}
+
+void AbstractFileListing::removePendingFiles()
+{
+    d->mPendingRemovalScheduled = false;
+
+    auto allRemovedTracks = QList<QUrl>();
+
+    const auto pendingRemovedFiles = d->mPendingRemovedFiles;
+    d->mPendingRemovedFiles.clear();
+
+    for (const auto &oneRemovedFile : pendingRemovedFiles) {
+        discardFile(oneRemovedFile, allRemovedTracks);
+    }
+
+    if (!allRemovedTracks.isEmpty()) {
+        Q_EMIT removedTracksList(allRemovedTracks);
+    }
+}
+
+void AbstractFileListing::setScanDevice(const QByteArray &device)
+{
+    d->mScanDevice = device;
+}
+
+bool AbstractFileListing::acquireScanDevice()
+{
+    return ScanScheduler::instance().acquireDevice(d->mScanDevice, d->mStopRequest);
+}
+
+void AbstractFileListing::releaseScanDevice()
+{
+    ScanScheduler::instance().releaseDevice(d->mScanDevice);
+}
+
 void AbstractFileListing::setSourceName(const QString &name)
 {
     d->mSourceName = name;
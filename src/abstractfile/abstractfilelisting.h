@@ -25,12 +25,18 @@
 #include <QObject>
 #include <QString>
 #include <QUrl>
+#include <QByteArray>
 #include <QHash>
 #include <QVector>
+#include <QDateTime>
+#include <QPair>
+#include <QList>
 
 #include <memory>
 
 class AbstractFileListingPrivate;
+class DirectoryScanPass;
+class IndexingStatistics;
 class MusicAudioTrack;
 class NotificationItem;
 
@@ -43,6 +49,14 @@ class AbstractFileListing : public QObject
                READ importedTracksCount
                NOTIFY importedTracksCountChanged)
 
+    Q_PROPERTY(int pendingBatchesCount
+               READ pendingBatchesCount
+               NOTIFY pendingBatchesCountChanged)
+
+    Q_PROPERTY(int batchSize
+               READ batchSize
+               NOTIFY batchSizeChanged)
+
 public:
 
     explicit AbstractFileListing(const QString &sourceName, QObject *parent = nullptr);
@@ -55,13 +69,27 @@ public:
 
     int importedTracksCount() const;
 
+    int pendingBatchesCount() const;
+
+    int batchSize() const;
+
+    void setMaximumPendingBatches(int maximumPendingBatches);
+
+    void tracksListCommitted(int tracksCount, qint64 commitDuration);
+
+    IndexingStatistics indexingStatistics() const;
+
 Q_SIGNALS:
 
-    void tracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers, const QString &musicSource);
+    void tracksList(const QList<MusicAudioTrack> &tracks, const QString &musicSource);
 
     void removedTracksList(const QList<QUrl> &removedTracks);
 
-    void modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QHash<QString, QUrl> &covers, const QString &musicSource);
+    void renamedTracksList(const QHash<QUrl, QUrl> &renamedTracks);
+
+    void modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QString &musicSource);
+
+    void extractionFailed(const QUrl &fileName, const QDateTime &fileModifiedTime);
 
     void indexingStarted();
 
@@ -69,6 +97,10 @@ Q_SIGNALS:
 
     void importedTracksCountChanged();
 
+    void pendingBatchesCountChanged();
+
+    void batchSizeChanged();
+
     void newNotification(NotificationItem notification);
 
     void closeNotification(QString notificationId);
@@ -83,19 +115,29 @@ public Q_SLOTS:
 
     void resetImportedTracksCounter();
 
+    void setExtractionFailures(const QHash<QUrl, QDateTime> &failedFiles);
+
 protected Q_SLOTS:
 
     void directoryChanged(const QString &path);
 
     void fileChanged(const QString &modifiedFileName);
 
+    void resetIndexingStatistics();
+
+    void logIndexingStatistics();
+
 protected:
 
     virtual void executeInit();
 
     virtual void triggerRefreshOfContent();
 
-    void scanDirectory(QList<MusicAudioTrack> &newFiles, const QUrl &path);
+    void scanDirectories(QList<MusicAudioTrack> &newFiles, const QList<QUrl> &paths, bool deferRemovals);
+
+    void listDirectory(const QUrl &path, DirectoryScanPass &scanPass);
+
+    void discardFile(const QPair<QUrl, bool> &removedFile, QList<QUrl> &allRemovedFiles);
 
     virtual MusicAudioTrack scanOneFile(const QUrl &scanFile);
 
@@ -103,22 +145,42 @@ protected:
 
     void addFileInDirectory(const QUrl &newFile, const QUrl &directoryName);
 
-    void scanDirectoryTree(const QString &path);
+    void scanDirectoryTree(const QString &path, bool deferRemovals = false);
 
     void setHandleNewFiles(bool handleThem);
 
+    void setWatchFileSystem(bool watchIt);
+
+    void rescanModifiedDirectories();
+
     void emitNewFiles(const QList<MusicAudioTrack> &tracks);
 
-    void addCover(const MusicAudioTrack &newTrack);
+    void addCover(MusicAudioTrack &newTrack);
+
+    QUrl findCoverFile(const QUrl &albumDirectory) const;
+
+    QUrl extractEmbeddedCover(const QUrl &trackFile);
 
     void removeDirectory(const QUrl &removedDirectory, QList<QUrl> &allRemovedFiles);
 
     void removeFile(const QUrl &oneRemovedTrack, QList<QUrl> &allRemovedFiles);
 
+    void renameFile(const QUrl &oldFile, const QUrl &newFile, QHash<QUrl, QUrl> &allRenamedFiles);
+
+    void removePendingFiles();
+
     void setSourceName(const QString &name);
 
+    void setScanDevice(const QByteArray &device);
+
+    bool acquireScanDevice();
+
+    void releaseScanDevice();
+
     void increaseImportedTracksCount();
 
+    IndexingStatistics &statistics();
+
 private:
 
     std::unique_ptr<AbstractFileListingPrivate> d;
@@ -0,0 +1,245 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "extractorworker.h"
+
+#include "musicaudiotrack.h"
+#include "extractor/extractorprotocol.h"
+
+#include <QProcess>
+#include <QCoreApplication>
+#include <QStandardPaths>
+#include <QElapsedTimer>
+#include <QDebug>
+
+#include <algorithm>
+
+static QAtomicInt extractorEnabled = 1;
+
+static QAtomicInt extractorTimeout = 30000;
+
+class ExtractorWorkerPrivate
+{
+public:
+
+    enum class Attempt {
+        Answered,
+        TimedOut,
+        Crashed,
+        Broken,
+        Aborted,
+    };
+
+    bool startProcess();
+
+    void stopProcess();
+
+    Attempt extractOnce(const QUrl &scanFile, MusicAudioTrack &track, quint64 &bytesRead, const QAtomicInt &stopRequest);
+
+    std::unique_ptr<QProcess> mProcess;
+
+    QByteArray mBuffer;
+
+    const int mPollInterval = 100;
+
+    const int mStopTimeout = 1000;
+
+    const int mMaximumAttempts = 2;
+
+};
+
+bool ExtractorWorkerPrivate::startProcess()
+{
+    if (mProcess && mProcess->state() == QProcess::Running) {
+        return true;
+    }
+
+    stopProcess();
+
+    const auto &program = ExtractorWorker::helperPath();
+    if (program.isEmpty()) {
+        return false;
+    }
+
+    mProcess = std::make_unique<QProcess>();
+    mProcess->setProcessChannelMode(QProcess::ForwardedErrorChannel);
+    mProcess->start(program, {}, QIODevice::ReadWrite);
+
+    if (!mProcess->waitForStarted(extractorTimeout)) {
+        qDebug() << "ExtractorWorker::startProcess" << program << mProcess->errorString();
+
+        stopProcess();
+
+        return false;
+    }
+
+    return true;
+}
+
+void ExtractorWorkerPrivate::stopProcess()
+{
+    mBuffer.clear();
+
+    if (!mProcess) {
+        return;
+    }
+
+    if (mProcess->state() != QProcess::NotRunning) {
+        mProcess->closeWriteChannel();
+
+        if (!mProcess->waitForFinished(mStopTimeout)) {
+            mProcess->kill();
+            mProcess->waitForFinished(mStopTimeout);
+        }
+    }
+
+    mProcess.reset();
+}
+
+ExtractorWorkerPrivate::Attempt ExtractorWorkerPrivate::extractOnce(const QUrl &scanFile, MusicAudioTrack &track, quint64 &bytesRead, const QAtomicInt &stopRequest)
+{
+    const auto &request = ExtractorProtocol::frame(ExtractorProtocol::encodeRequest(scanFile));
+    if (mProcess->write(request) != request.size()) {
+        stopProcess();
+
+        return Attempt::Broken;
+    }
+
+    QElapsedTimer extractionTimer;
+    extractionTimer.start();
+
+    const int currentTimeout = extractorTimeout;
+
+    QByteArray payload;
+
+    while (!ExtractorProtocol::takeFrame(mBuffer, payload)) {
+        if (stopRequest != 0) {
+            mProcess->kill();
+            stopProcess();
+
+            return Attempt::Aborted;
+        }
+
+        if (mProcess->state() != QProcess::Running) {
+            qDebug() << "ExtractorWorker::extract" << scanFile << "crashed";
+
+            stopProcess();
+
+            return Attempt::Crashed;
+        }
+
+        if (extractionTimer.elapsed() >= currentTimeout) {
+            qDebug() << "ExtractorWorker::extract" << scanFile << "timed out";
+
+            mProcess->kill();
+            stopProcess();
+
+            return Attempt::TimedOut;
+        }
+
+        if (mProcess->bytesToWrite() > 0) {
+            mProcess->waitForBytesWritten(mPollInterval);
+        } else {
+            mProcess->waitForReadyRead(mPollInterval);
+        }
+
+        mBuffer.append(mProcess->readAllStandardOutput());
+    }
+
+    if (!ExtractorProtocol::decodeResponse(payload, track, bytesRead)) {
+        mProcess->kill();
+        stopProcess();
+
+        return Attempt::Broken;
+    }
+
+    return Attempt::Answered;
+}
+
+ExtractorWorker::ExtractorWorker() : d(std::make_unique<ExtractorWorkerPrivate>())
+{
+}
+
+ExtractorWorker::~ExtractorWorker()
+{
+    d->stopProcess();
+}
+
+ExtractorWorker::Result ExtractorWorker::extract(const QUrl &scanFile, MusicAudioTrack &track, quint64 &bytesRead, const QAtomicInt &stopRequest)
+{
+    auto lastAttempt = ExtractorWorkerPrivate::Attempt::Broken;
+
+    for (int attempt = 0; attempt < d->mMaximumAttempts; ++attempt) {
+        if (!d->startProcess()) {
+            return Result::Unavailable;
+        }
+
+        lastAttempt = d->extractOnce(scanFile, track, bytesRead, stopRequest);
+
+        switch (lastAttempt)
+        {
+        case ExtractorWorkerPrivate::Attempt::Answered:
+            return Result::Extracted;
+        case ExtractorWorkerPrivate::Attempt::TimedOut:
+            return Result::Failed;
+        case ExtractorWorkerPrivate::Attempt::Aborted:
+            return Result::Aborted;
+        case ExtractorWorkerPrivate::Attempt::Crashed:
+        case ExtractorWorkerPrivate::Attempt::Broken:
+            break;
+        }
+    }
+
+    return (lastAttempt == ExtractorWorkerPrivate::Attempt::Crashed ? Result::Failed : Result::TransportError);
+}
+
+bool ExtractorWorker::isEnabled()
+{
+    return extractorEnabled != 0;
+}
+
+void ExtractorWorker::setEnabled(bool enabled)
+{
+    extractorEnabled = (enabled ? 1 : 0);
+}
+
+int ExtractorWorker::timeout()
+{
+    return extractorTimeout;
+}
+
+void ExtractorWorker::setTimeout(int timeout)
+{
+    extractorTimeout = std::max(timeout, 1000);
+}
+
+QString ExtractorWorker::helperPath()
+{
+    static const auto helper = []() {
+        auto path = QStandardPaths::findExecutable(QStringLiteral("elisaextractor"), {QCoreApplication::applicationDirPath()});
+
+        if (path.isEmpty()) {
+            path = QStandardPaths::findExecutable(QStringLiteral("elisaextractor"));
+        }
+
+        return path;
+    }();
+
+    return helper;
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef EXTRACTORWORKER_H
+#define EXTRACTORWORKER_H
+
+#include <QUrl>
+#include <QString>
+#include <QAtomicInt>
+
+#include <memory>
+
+class ExtractorWorkerPrivate;
+class MusicAudioTrack;
+
+/**
+ * Runs the KFileMetaData extraction of files in an elisaextractor helper
+ * process, for the files the in process tag reader cannot handle.
+ *
+ * The helper is started on first use and kept alive for the following files.
+ * A helper that does not answer within timeout() milliseconds is killed and
+ * extract returns Failed. A helper that crashes is started again and gets a
+ * second chance with the same file before extract returns Failed. When the
+ * pipes to a fresh helper fail or carry an undecodable answer, extract
+ * returns TransportError: the file is not at fault and can be tried again
+ * later. Unavailable means the helper cannot be found or started and the
+ * caller has to extract the file itself.
+ *
+ * A worker must be used from a single thread.
+ */
+class ExtractorWorker
+{
+
+public:
+
+    enum class Result {
+        Extracted,
+        Failed,
+        Aborted,
+        TransportError,
+        Unavailable,
+    };
+
+    ExtractorWorker();
+
+    ~ExtractorWorker();
+
+    Result extract(const QUrl &scanFile, MusicAudioTrack &track, quint64 &bytesRead, const QAtomicInt &stopRequest);
+
+    static bool isEnabled();
+
+    static void setEnabled(bool enabled);
+
+    static int timeout();
+
+    static void setTimeout(int timeout);
+
+    static QString helperPath();
+
+private:
+
+    std::unique_ptr<ExtractorWorkerPrivate> d;
+
+};
+
+#endif // EXTRACTORWORKER_H
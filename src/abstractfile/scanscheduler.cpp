@@ -0,0 +1,179 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "scanscheduler.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QWaitCondition>
+#include <QElapsedTimer>
+#include <QThread>
+#include <QHash>
+#include <QSet>
+
+#include <algorithm>
+
+class ScanSchedulerPrivate
+{
+public:
+
+    class DeviceBudget
+    {
+    public:
+
+        QElapsedTimer mWindow;
+
+        qint64 mBytes = 0;
+
+        qint64 mFiles = 0;
+
+    };
+
+    QMutex mMutex;
+
+    QWaitCondition mDeviceReleased;
+
+    QSet<QByteArray> mBusyDevices;
+
+    QHash<QByteArray, DeviceBudget> mBudgets;
+
+    QAtomicInteger<qint64> mBytesPerSecond = 0;
+
+    QAtomicInt mFilesPerSecond = 0;
+
+    const unsigned long mPollInterval = 100;
+
+    const qint64 mBudgetWindow = 2000;
+
+};
+
+ScanScheduler &ScanScheduler::instance()
+{
+    static ScanScheduler scheduler;
+
+    return scheduler;
+}
+
+ScanScheduler::ScanScheduler() : d(std::make_unique<ScanSchedulerPrivate>())
+{
+}
+
+ScanScheduler::~ScanScheduler()
+= default;
+
+qint64 ScanScheduler::bytesPerSecond() const
+{
+    return d->mBytesPerSecond;
+}
+
+void ScanScheduler::setBytesPerSecond(qint64 bytesPerSecond)
+{
+    d->mBytesPerSecond = std::max(qint64(0), bytesPerSecond);
+}
+
+int ScanScheduler::filesPerSecond() const
+{
+    return d->mFilesPerSecond;
+}
+
+void ScanScheduler::setFilesPerSecond(int filesPerSecond)
+{
+    d->mFilesPerSecond = std::max(0, filesPerSecond);
+}
+
+bool ScanScheduler::acquireDevice(const QByteArray &device, const QAtomicInt &stopRequest)
+{
+    if (device.isEmpty()) {
+        return true;
+    }
+
+    QMutexLocker locker(&d->mMutex);
+
+    while (d->mBusyDevices.contains(device)) {
+        if (stopRequest != 0) {
+            return false;
+        }
+
+        d->mDeviceReleased.wait(&d->mMutex, d->mPollInterval);
+    }
+
+    d->mBusyDevices.insert(device);
+
+    return true;
+}
+
+void ScanScheduler::releaseDevice(const QByteArray &device)
+{
+    if (device.isEmpty()) {
+        return;
+    }
+
+    QMutexLocker locker(&d->mMutex);
+
+    d->mBusyDevices.remove(device);
+    d->mDeviceReleased.wakeAll();
+}
+
+void ScanScheduler::throttle(const QByteArray &device, qint64 bytesRead, const QAtomicInt &stopRequest)
+{
+    const qint64 bytesPerSecond = d->mBytesPerSecond;
+    const qint64 filesPerSecond = d->mFilesPerSecond;
+
+    if (device.isEmpty() || (bytesPerSecond == 0 && filesPerSecond == 0)) {
+        return;
+    }
+
+    auto delay = qint64(0);
+
+    {
+        QMutexLocker locker(&d->mMutex);
+
+        auto &budget = d->mBudgets[device];
+
+        if (!budget.mWindow.isValid()) {
+            budget.mWindow.start();
+        }
+
+        budget.mBytes += bytesRead;
+        ++budget.mFiles;
+
+        auto expectedDuration = qint64(0);
+        if (bytesPerSecond != 0) {
+            expectedDuration = std::max(expectedDuration, budget.mBytes * 1000 / bytesPerSecond);
+        }
+        if (filesPerSecond != 0) {
+            expectedDuration = std::max(expectedDuration, budget.mFiles * 1000 / filesPerSecond);
+        }
+
+        const auto elapsed = budget.mWindow.elapsed();
+        delay = expectedDuration - elapsed;
+
+        if (delay <= 0 && elapsed >= d->mBudgetWindow) {
+            budget.mWindow.restart();
+            budget.mBytes = 0;
+            budget.mFiles = 0;
+        }
+    }
+
+    while (delay > 0 && stopRequest == 0) {
+        const auto oneSleep = std::min(delay, qint64(d->mPollInterval));
+        QThread::msleep(static_cast<unsigned long>(oneSleep));
+        delay -= oneSleep;
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef SCANSCHEDULER_H
+#define SCANSCHEDULER_H
+
+#include <QByteArray>
+#include <QAtomicInt>
+
+#include <memory>
+
+class ScanSchedulerPrivate;
+
+/**
+ * Process wide coordination of the file listings.
+ *
+ * Scans of roots stored on the same block device are serialized through
+ * acquireDevice/releaseDevice while scans on different devices run in
+ * parallel. throttle is called after each scanned file and sleeps the
+ * calling listing thread as needed to keep the reads of one device under
+ * the configured bytes and files per second (0 means unlimited).
+ *
+ * All blocking calls give up as soon as stopRequest becomes non zero.
+ */
+class ScanScheduler
+{
+
+public:
+
+    static ScanScheduler& instance();
+
+    ~ScanScheduler();
+
+    qint64 bytesPerSecond() const;
+
+    void setBytesPerSecond(qint64 bytesPerSecond);
+
+    int filesPerSecond() const;
+
+    void setFilesPerSecond(int filesPerSecond);
+
+    bool acquireDevice(const QByteArray &device, const QAtomicInt &stopRequest);
+
+    void releaseDevice(const QByteArray &device);
+
+    void throttle(const QByteArray &device, qint64 bytesRead, const QAtomicInt &stopRequest);
+
+private:
+
+    ScanScheduler();
+
+    std::unique_ptr<ScanSchedulerPrivate> d;
+
+};
+
+#endif // SCANSCHEDULER_H
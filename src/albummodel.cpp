@@ -26,6 +26,10 @@
 #include <QPointer>
 #include <QVector>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 class AlbumModelPrivate
 {
 public:
@@ -34,12 +38,26 @@ public:
     {
     }
 
+    static std::pair<int, int> sortKey(const MusicAudioTrack &track)
+    {
+        return {track.discNumber(), track.trackNumber()};
+    }
+
+    void reindexTracks(int firstRow, int lastRow)
+    {
+        for (int row = firstRow; row <= lastRow && row < mCurrentAlbum.tracksCount(); ++row) {
+            mTrackRowById[mCurrentAlbum.trackIdFromIndex(row)] = row;
+        }
+    }
+
     QString mTitle;
 
     QString mAuthor;
 
     MusicAlbum mCurrentAlbum;
 
+    QHash<qulonglong, int> mTrackRowById;
+
 };
 
 AlbumModel::AlbumModel(QObject *parent) : QAbstractItemModel(parent), d(std::make_unique<AlbumModelPrivate>())
@@ -262,11 +280,14 @@ void AlbumModel::setAlbumData(const MusicAlbum &album)
     if (d->mCurrentAlbum.tracksCount() > 0) {
         beginRemoveRows({}, 0, d->mCurrentAlbum.tracksCount() - 1);
         d->mCurrentAlbum = {};
+        d->mTrackRowById.clear();
         endRemoveRows();
     }
 
     beginInsertRows({}, 0, album.tracksCount() - 1);
     d->mCurrentAlbum = album;
+    d->mTrackRowById.reserve(album.tracksCount());
+    d->reindexTracks(0, album.tracksCount() - 1);
     endInsertRows();
 
     Q_EMIT albumDataChanged();
@@ -296,122 +317,219 @@ void AlbumModel::albumModified(const MusicAlbum &modifiedAlbum)
         return;
     }
 
-    auto removedTracks = QList<MusicAudioTrack>();
+    auto newTracks = QVector<MusicAudioTrack>();
+    newTracks.reserve(modifiedAlbum.tracksCount());
+    for (int i = 0; i < modifiedAlbum.tracksCount(); ++i) {
+        newTracks.push_back(modifiedAlbum.trackFromIndex(i));
+    }
 
-    for (auto i = 0; i < d->mCurrentAlbum.tracksCount(); ++i) {
-        bool trackExist = false;
+    // the database already sorts album tracks by disc and track number, this only keeps ties stable
+    std::stable_sort(newTracks.begin(), newTracks.end(), [](const MusicAudioTrack &left, const MusicAudioTrack &right) {
+        return AlbumModelPrivate::sortKey(left) < AlbumModelPrivate::sortKey(right);
+    });
 
-        for (auto j = 0; j < modifiedAlbum.tracksCount() && !trackExist; ++j) {
-            trackExist = (d->mCurrentAlbum.trackIdFromIndex(i) == modifiedAlbum.trackIdFromIndex(j));
-            if (trackExist) {
-                const auto &oldTrack = d->mCurrentAlbum.trackFromIndex(i);
-                const auto &newTrack = modifiedAlbum.trackFromIndex(j);
+    auto newIndexById = QHash<qulonglong, int>();
+    newIndexById.reserve(newTracks.size());
+    for (int i = 0; i < newTracks.size(); ++i) {
+        newIndexById[newTracks[i].databaseId()] = i;
+    }
 
-                if (oldTrack != newTrack) {
-                    trackModified(newTrack);
-                }
-            }
+    auto removedRows = QVector<int>();
+    for (int row = 0; row < d->mCurrentAlbum.tracksCount(); ++row) {
+        if (!newIndexById.contains(d->mCurrentAlbum.trackIdFromIndex(row))) {
+            removedRows.push_back(row);
         }
+    }
 
-        if (!trackExist) {
-            const auto &oldTrack = d->mCurrentAlbum.trackFromIndex(i);
-            removedTracks.push_back(oldTrack);
+    for (int lastIndex = removedRows.size() - 1; lastIndex >= 0; ) {
+        auto firstIndex = lastIndex;
+        while (firstIndex > 0 && removedRows[firstIndex - 1] == removedRows[firstIndex] - 1) {
+            --firstIndex;
         }
+
+        beginRemoveRows({}, removedRows[firstIndex], removedRows[lastIndex]);
+        for (int row = removedRows[lastIndex]; row >= removedRows[firstIndex]; --row) {
+            d->mTrackRowById.remove(d->mCurrentAlbum.trackIdFromIndex(row));
+            d->mCurrentAlbum.removeTrackFromIndex(row);
+        }
+        endRemoveRows();
+
+        lastIndex = firstIndex - 1;
     }
 
-    for (const auto &removedTrack : removedTracks) {
-        trackRemoved(removedTrack);
+    if (!removedRows.isEmpty()) {
+        d->reindexTracks(removedRows.first(), d->mCurrentAlbum.tracksCount() - 1);
     }
 
-    for (auto j = 0; j < modifiedAlbum.tracksCount(); ++j) {
-        bool trackExist = false;
+    // rows already in the right relative order are the longest increasing subsequence of their target
+    // positions, only the other rows need to be moved
+    const auto keptCount = d->mCurrentAlbum.tracksCount();
+    auto targetIndexes = std::vector<int>(keptCount);
+    for (int row = 0; row < keptCount; ++row) {
+        targetIndexes[row] = newIndexById.value(d->mCurrentAlbum.trackIdFromIndex(row));
+    }
 
-        for (auto i = 0; i < d->mCurrentAlbum.tracksCount() && !trackExist; ++i) {
-            trackExist = (d->mCurrentAlbum.trackIdFromIndex(i) == modifiedAlbum.trackIdFromIndex(j));
+    auto subsequenceTails = std::vector<int>();
+    auto previousRows = std::vector<int>(keptCount, -1);
+    for (int row = 0; row < keptCount; ++row) {
+        auto tail = std::lower_bound(subsequenceTails.begin(), subsequenceTails.end(), targetIndexes[row],
+                                     [&targetIndexes](int tailRow, int target) {
+            return targetIndexes[tailRow] < target;
+        });
+
+        if (tail != subsequenceTails.begin()) {
+            previousRows[row] = *(tail - 1);
         }
 
-        if (!trackExist) {
-            const auto &newTrack = modifiedAlbum.trackFromIndex(j);
-            trackAdded(newTrack);
+        if (tail == subsequenceTails.end()) {
+            subsequenceTails.push_back(row);
+        } else {
+            *tail = row;
         }
     }
-}
 
-void AlbumModel::albumRemoved(const MusicAlbum &modifiedAlbum)
-{
-    if (modifiedAlbum.databaseId() != d->mCurrentAlbum.databaseId()) {
-        return;
+    auto isInPlace = std::vector<bool>(newTracks.size(), false);
+    for (auto row = subsequenceTails.empty() ? -1 : subsequenceTails.back(); row != -1; row = previousRows[row]) {
+        isInPlace[targetIndexes[row]] = true;
     }
 
-    for (int trackIndex = d->mCurrentAlbum.tracksCount() - 1; trackIndex >= 0 ; --trackIndex) {
-        trackRemoved(d->mCurrentAlbum.trackFromIndex(trackIndex));
-    }
-}
+    auto previousKeptId = qulonglong(0);
+    auto hasPreviousKept = false;
+    for (int i = 0; i < newTracks.size(); ++i) {
+        const auto trackId = newTracks[i].databaseId();
 
-void AlbumModel::trackAdded(const MusicAudioTrack &newTrack)
-{
-    if (newTrack.albumName() != d->mCurrentAlbum.title()) {
-        return;
-    }
+        if (!d->mTrackRowById.contains(trackId)) {
+            continue;
+        }
 
-    auto trackIndex = d->mCurrentAlbum.trackIndexFromId(newTrack.databaseId());
+        if (!isInPlace[i]) {
+            const auto sourceRow = d->mTrackRowById.value(trackId);
+            const auto destinationRow = hasPreviousKept ? d->mTrackRowById.value(previousKeptId) + 1 : 0;
 
-    if (trackIndex != -1) {
-        return;
+            if (sourceRow != destinationRow && sourceRow + 1 != destinationRow) {
+                beginMoveRows({}, sourceRow, sourceRow, {}, destinationRow);
+                const auto movedTrack = d->mCurrentAlbum.trackFromIndex(sourceRow);
+                d->mCurrentAlbum.removeTrackFromIndex(sourceRow);
+                d->mCurrentAlbum.insertTrack(movedTrack, destinationRow > sourceRow ? destinationRow - 1 : destinationRow);
+                endMoveRows();
+
+                d->reindexTracks(std::min(sourceRow, destinationRow), std::max(sourceRow, destinationRow));
+            }
+        }
+
+        previousKeptId = trackId;
+        hasPreviousKept = true;
     }
 
-    bool trackInserted = false;
-    for (int trackIndex = 0; trackIndex < d->mCurrentAlbum.tracksCount(); ++trackIndex) {
-        const auto &oneTrack = d->mCurrentAlbum.trackFromIndex(trackIndex);
+    // kept rows still hold the old track data, their keys must come from the new one
+    auto currentKeys = std::vector<std::pair<int, int>>();
+    currentKeys.reserve(d->mCurrentAlbum.tracksCount());
+    for (int row = 0; row < d->mCurrentAlbum.tracksCount(); ++row) {
+        currentKeys.push_back(AlbumModelPrivate::sortKey(newTracks[newIndexById.value(d->mCurrentAlbum.trackIdFromIndex(row))]));
+    }
 
-        if (oneTrack.discNumber() == newTrack.discNumber() && oneTrack.trackNumber() > newTrack.trackNumber()) {
-            beginInsertRows({}, trackIndex, trackIndex);
-            d->mCurrentAlbum.insertTrack(newTrack, trackIndex);
-            endInsertRows();
-            trackInserted = true;
-            break;
+    auto addedIndexes = QVector<int>();
+    for (int i = 0; i < newTracks.size(); ++i) {
+        if (!d->mTrackRowById.contains(newTracks[i].databaseId())) {
+            addedIndexes.push_back(i);
         }
     }
 
-    if (!trackInserted) {
-        beginInsertRows({}, d->mCurrentAlbum.tracksCount(), d->mCurrentAlbum.tracksCount());
-        d->mCurrentAlbum.insertTrack(newTrack, d->mCurrentAlbum.tracksCount());
+    auto insertionRow = [&currentKeys](const MusicAudioTrack &track) {
+        return static_cast<int>(std::upper_bound(currentKeys.begin(), currentKeys.end(), AlbumModelPrivate::sortKey(track)) - currentKeys.begin());
+    };
+
+    auto insertedCount = 0;
+    auto firstInsertedRow = -1;
+    for (int firstIndex = 0; firstIndex < addedIndexes.size(); ) {
+        const auto gap = insertionRow(newTracks[addedIndexes[firstIndex]]);
+        auto lastIndex = firstIndex;
+        while (lastIndex + 1 < addedIndexes.size() && insertionRow(newTracks[addedIndexes[lastIndex + 1]]) == gap) {
+            ++lastIndex;
+        }
+
+        const auto firstRow = gap + insertedCount;
+        beginInsertRows({}, firstRow, firstRow + lastIndex - firstIndex);
+        for (int i = firstIndex; i <= lastIndex; ++i) {
+            d->mCurrentAlbum.insertTrack(newTracks[addedIndexes[i]], firstRow + i - firstIndex);
+        }
         endInsertRows();
+
+        if (firstInsertedRow == -1) {
+            firstInsertedRow = firstRow;
+        }
+
+        insertedCount += lastIndex - firstIndex + 1;
+        firstIndex = lastIndex + 1;
     }
-}
 
-void AlbumModel::trackModified(const MusicAudioTrack &modifiedTrack)
-{
-    if (modifiedTrack.albumName() != d->mCurrentAlbum.title()) {
-        return;
+    if (firstInsertedRow != -1) {
+        d->reindexTracks(firstInsertedRow, d->mCurrentAlbum.tracksCount() - 1);
     }
 
-    auto trackIndex = d->mCurrentAlbum.trackIndexFromId(modifiedTrack.databaseId());
+    for (int firstRow = 0; firstRow < d->mCurrentAlbum.tracksCount(); ) {
+        const auto &newTrack = newTracks[newIndexById.value(d->mCurrentAlbum.trackIdFromIndex(firstRow))];
+        if (d->mCurrentAlbum.trackFromIndex(firstRow) == newTrack) {
+            ++firstRow;
+            continue;
+        }
 
-    if (trackIndex == -1) {
-        return;
-    }
+        auto lastRow = firstRow;
+        d->mCurrentAlbum.updateTrack(newTrack, firstRow);
+        while (lastRow + 1 < d->mCurrentAlbum.tracksCount()) {
+            const auto &nextTrack = newTracks[newIndexById.value(d->mCurrentAlbum.trackIdFromIndex(lastRow + 1))];
+            if (d->mCurrentAlbum.trackFromIndex(lastRow + 1) == nextTrack) {
+                break;
+            }
+
+            ++lastRow;
+            d->mCurrentAlbum.updateTrack(nextTrack, lastRow);
+        }
 
-    d->mCurrentAlbum.updateTrack(modifiedTrack, trackIndex);
-    Q_EMIT dataChanged(index(trackIndex, 0), index(trackIndex, 0));
+        Q_EMIT dataChanged(index(firstRow, 0), index(lastRow, 0));
+
+        firstRow = lastRow + 1;
+    }
 }
 
-void AlbumModel::trackRemoved(const MusicAudioTrack &removedTrack)
+void AlbumModel::albumRemoved(const MusicAlbum &modifiedAlbum)
 {
-    if (removedTrack.albumName() != d->mCurrentAlbum.title()) {
+    if (modifiedAlbum.databaseId() != d->mCurrentAlbum.databaseId()) {
         return;
     }
 
-    auto trackIndex = d->mCurrentAlbum.trackIndexFromId(removedTrack.databaseId());
-
-    if (trackIndex == -1) {
+    if (d->mCurrentAlbum.tracksCount() == 0) {
         return;
     }
 
-    beginRemoveRows({}, trackIndex, trackIndex);
-    d->mCurrentAlbum.removeTrackFromIndex(trackIndex);
+    beginRemoveRows({}, 0, d->mCurrentAlbum.tracksCount() - 1);
+    for (int trackIndex = d->mCurrentAlbum.tracksCount() - 1; trackIndex >= 0 ; --trackIndex) {
+        d->mCurrentAlbum.removeTrackFromIndex(trackIndex);
+    }
+    d->mTrackRowById.clear();
     endRemoveRows();
 }
 
+void AlbumModel::albumsModified(const QList<MusicAlbum> &modifiedAlbums)
+{
+    for (const auto &oneAlbum : modifiedAlbums) {
+        if (oneAlbum.databaseId() == d->mCurrentAlbum.databaseId()) {
+            albumModified(oneAlbum);
+            Q_EMIT albumDataChanged();
+            return;
+        }
+    }
+}
+
+void AlbumModel::albumsRemoved(const QList<MusicAlbum> &removedAlbums)
+{
+    for (const auto &oneAlbum : removedAlbums) {
+        if (oneAlbum.databaseId() == d->mCurrentAlbum.databaseId()) {
+            albumRemoved(oneAlbum);
+            return;
+        }
+    }
+}
+
 
 #include "moc_albummodel.cpp"
@@ -129,13 +129,11 @@ public Q_SLOTS:
 
     void albumRemoved(const MusicAlbum &modifiedAlbum);
 
-private:
-
-    void trackAdded(const MusicAudioTrack &newTrack);
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
 
-    void trackModified(const MusicAudioTrack &modifiedTrack);
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
 
-    void trackRemoved(const MusicAudioTrack &removedTrack);
+private:
 
     QVariant internalDataTrack(const MusicAudioTrack &track, int role, int rowIndex) const;
 
@@ -20,6 +20,7 @@
 #include "allalbumsmodel.h"
 #include "musicstatistics.h"
 #include "databaseinterface.h"
+#include "librarydiffworker.h"
 
 #include <QUrl>
 #include <QTimer>
@@ -36,8 +37,22 @@ public:
     {
     }
 
+    AlbumsModelDiff computeDiff(const QList<qulonglong> &removedIds, const QList<MusicAlbum> &addedAlbums,
+                                const QList<MusicAlbum> &modifiedAlbums) const
+    {
+        auto result = mShadow.computeDiff(removedIds, addedAlbums, modifiedAlbums);
+
+        LibraryDiffWorker::buildDisplayData(result);
+
+        return result;
+    }
+
     QVector<MusicAlbum> mAllAlbums;
 
+    QVector<ModelDisplayData<MusicAlbum>> mDisplayData;
+
+    ModelShadow<MusicAlbum> mShadow;
+
     int mAlbumCount = 0;
 
 };
@@ -140,22 +155,17 @@ QVariant AllAlbumsModel::internalDataAlbum(int albumIndex, int role) const
         result = d->mAllAlbums[albumIndex].title();
         break;
     case ColumnsRoles::AllTracksTitleRole:
-        result = d->mAllAlbums[albumIndex].allTracksTitle();
+        result = d->mDisplayData[albumIndex].mAllTracksTitle;
         break;
     case ColumnsRoles::ArtistRole:
         result = d->mAllAlbums[albumIndex].artist();
         break;
     case ColumnsRoles::AllArtistsRole:
-        result = d->mAllAlbums[albumIndex].allArtists().join(QStringLiteral(", "));
+        result = d->mDisplayData[albumIndex].mAllArtists;
         break;
     case ColumnsRoles::ImageRole:
-    {
-        auto albumArt = d->mAllAlbums[albumIndex].albumArtURI();
-        if (albumArt.isValid()) {
-            result = albumArt;
-        }
+        result = d->mDisplayData[albumIndex].mImage;
         break;
-    }
     case ColumnsRoles::CountRole:
         result = d->mAllAlbums[albumIndex].tracksCount();
         break;
@@ -212,48 +222,98 @@ int AllAlbumsModel::columnCount(const QModelIndex &parent) const
     return 1;
 }
 
-void AllAlbumsModel::albumAdded(const MusicAlbum &newAlbum)
+void AllAlbumsModel::albumsAdded(const QList<MusicAlbum> &newAlbums)
 {
-    if (newAlbum.isValid()) {
-        beginInsertRows({}, d->mAllAlbums.size(), d->mAllAlbums.size());
-        d->mAllAlbums.push_back(newAlbum);
-        ++d->mAlbumCount;
-        endInsertRows();
+    applyChanges(d->computeDiff({}, newAlbums, {}));
+}
 
-        Q_EMIT albumCountChanged();
+void AllAlbumsModel::albumsRemoved(const QList<MusicAlbum> &removedAlbums)
+{
+    auto removedIds = QList<qulonglong>();
+    removedIds.reserve(removedAlbums.size());
+
+    for (const auto &oneAlbum : removedAlbums) {
+        removedIds.push_back(oneAlbum.databaseId());
     }
+
+    applyChanges(d->computeDiff(removedIds, {}, {}));
+}
+
+void AllAlbumsModel::albumsModified(const QList<MusicAlbum> &modifiedAlbums)
+{
+    applyChanges(d->computeDiff({}, {}, modifiedAlbums));
 }
 
-void AllAlbumsModel::albumRemoved(const MusicAlbum &removedAlbum)
+void AllAlbumsModel::applyChanges(const AlbumsModelDiff &changes)
 {
-    auto removedAlbumIterator = std::find(d->mAllAlbums.begin(), d->mAllAlbums.end(), removedAlbum);
+    d->mShadow.applyDiff(changes);
+
+    for (const auto &oneRange : changes.mRemovedRanges) {
+        beginRemoveRows({}, oneRange.first, oneRange.second);
+        d->mAllAlbums.remove(oneRange.first, oneRange.second - oneRange.first + 1);
+        d->mDisplayData.remove(oneRange.first, oneRange.second - oneRange.first + 1);
+        d->mAlbumCount = d->mAllAlbums.size();
+        endRemoveRows();
+    }
+
+    if (!changes.mInsertedItems.isEmpty()) {
+        beginInsertRows({}, d->mAllAlbums.size(), d->mAllAlbums.size() + changes.mInsertedItems.size() - 1);
 
-    if (removedAlbumIterator == d->mAllAlbums.end()) {
-        return;
+        d->mAllAlbums.reserve(d->mAllAlbums.size() + changes.mInsertedItems.size());
+        d->mDisplayData.reserve(d->mAllAlbums.size() + changes.mInsertedItems.size());
+        for (int i = 0; i < changes.mInsertedItems.size(); ++i) {
+            d->mAllAlbums.push_back(changes.mInsertedItems[i]);
+            d->mDisplayData.push_back(changes.mInsertedDisplayData[i]);
+        }
+        d->mAlbumCount = d->mAllAlbums.size();
+
+        endInsertRows();
     }
 
-    int albumIndex = removedAlbumIterator - d->mAllAlbums.begin();
+    const auto &modifiedRows = changes.mModifiedRows;
+    auto firstRow = 0;
+    while (firstRow < modifiedRows.size()) {
+        auto lastRow = firstRow;
+        while (lastRow + 1 < modifiedRows.size() && modifiedRows[lastRow + 1].first == modifiedRows[lastRow].first + 1) {
+            ++lastRow;
+        }
 
-    beginRemoveRows({}, albumIndex, albumIndex);
-    d->mAllAlbums.erase(removedAlbumIterator);
-    --d->mAlbumCount;
-    endRemoveRows();
+        for (int i = firstRow; i <= lastRow; ++i) {
+            d->mAllAlbums[modifiedRows[i].first] = modifiedRows[i].second;
+            d->mDisplayData[modifiedRows[i].first] = changes.mModifiedDisplayData[i];
+        }
 
-    Q_EMIT albumCountChanged();
+        Q_EMIT dataChanged(index(modifiedRows[firstRow].first, 0), index(modifiedRows[lastRow].first, 0));
+
+        firstRow = lastRow + 1;
+    }
+
+    if (!changes.mRemovedRanges.isEmpty() || !changes.mInsertedItems.isEmpty()) {
+        Q_EMIT albumCountChanged();
+    }
 }
 
-void AllAlbumsModel::albumModified(const MusicAlbum &modifiedAlbum)
+bool AllAlbumsModel::containsAlbum(qulonglong databaseId) const
 {
-    auto modifiedAlbumIterator = std::find(d->mAllAlbums.begin(), d->mAllAlbums.end(), modifiedAlbum);
+    return d->mShadow.contains(databaseId);
+}
 
-    if (modifiedAlbumIterator == d->mAllAlbums.end()) {
-        return;
-    }
+void AllAlbumsModel::resetAlbums(const QList<MusicAlbum> &allAlbums)
+{
+    beginResetModel();
+
+    d->mShadow.clear();
+
+    const auto &changes = d->computeDiff({}, allAlbums, {});
+    d->mShadow.applyDiff(changes);
+    d->mAllAlbums = changes.mInsertedItems;
+    d->mDisplayData = changes.mInsertedDisplayData;
 
-    int albumIndex = modifiedAlbumIterator - d->mAllAlbums.begin();
-    d->mAllAlbums[albumIndex] = modifiedAlbum;
+    d->mAlbumCount = d->mAllAlbums.size();
 
-    Q_EMIT dataChanged(index(albumIndex, 0), index(albumIndex, 0));
+    endResetModel();
+
+    Q_EMIT albumCountChanged();
 }
 
 #include "moc_allalbumsmodel.cpp"
@@ -27,6 +27,7 @@
 
 #include "musicalbum.h"
 #include "musicaudiotrack.h"
+#include "modeldiff.h"
 
 #include <memory>
 
@@ -82,16 +83,24 @@ public:
 
 public Q_SLOTS:
 
-    void albumAdded(const MusicAlbum &newAlbum);
+    void albumsAdded(const QList<MusicAlbum> &newAlbums);
 
-    void albumRemoved(const MusicAlbum &removedAlbum);
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
 
-    void albumModified(const MusicAlbum &modifiedAlbum);
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
+
+    void applyChanges(const AlbumsModelDiff &changes);
 
 Q_SIGNALS:
 
     void albumCountChanged();
 
+protected:
+
+    bool containsAlbum(qulonglong databaseId) const;
+
+    void resetAlbums(const QList<MusicAlbum> &allAlbums);
+
 private:
 
     QVariant internalDataAlbum(int albumIndex, int role) const;
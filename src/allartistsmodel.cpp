@@ -26,6 +26,8 @@
 #include <QPointer>
 #include <QVector>
 
+#include <algorithm>
+
 class AllArtistsModelPrivate
 {
 public:
@@ -36,6 +38,8 @@ public:
 
     QVector<MusicArtist> mAllArtists;
 
+    QHash<qulonglong, int> mArtistRowById;
+
     int mArtistsCount = 0;
 
     bool mUseLocalIcons = false;
@@ -165,35 +169,108 @@ int AllArtistsModel::columnCount(const QModelIndex &parent) const
     return 1;
 }
 
-void AllArtistsModel::artistAdded(const MusicArtist &newArtist)
+void AllArtistsModel::artistModified(const MusicArtist &modifiedArtist)
+{
+    artistsModified({modifiedArtist});
+}
+
+void AllArtistsModel::artistsAdded(const QList<MusicArtist> &newArtists)
 {
-    if (newArtist.isValid()) {
-        beginInsertRows({}, d->mAllArtists.size(), d->mAllArtists.size());
-        d->mAllArtists.push_back(newArtist);
-        ++d->mArtistsCount;
-        endInsertRows();
+    auto addedArtists = QVector<MusicArtist>();
+    addedArtists.reserve(newArtists.size());
+
+    for (const auto &oneArtist : newArtists) {
+        if (!oneArtist.isValid() || d->mArtistRowById.contains(oneArtist.databaseId())) {
+            continue;
+        }
+
+        d->mArtistRowById[oneArtist.databaseId()] = d->mAllArtists.size() + addedArtists.size();
+        addedArtists.push_back(oneArtist);
     }
+
+    if (addedArtists.isEmpty()) {
+        return;
+    }
+
+    beginInsertRows({}, d->mAllArtists.size(), d->mAllArtists.size() + addedArtists.size() - 1);
+    d->mAllArtists.append(addedArtists);
+    d->mArtistsCount = d->mAllArtists.size();
+    endInsertRows();
 }
 
-void AllArtistsModel::artistRemoved(const MusicArtist &removedArtist)
+void AllArtistsModel::artistsRemoved(const QList<MusicArtist> &removedArtists)
 {
-    auto removedArtistIterator = std::find(d->mAllArtists.begin(), d->mAllArtists.end(), removedArtist);
+    auto removedRows = QVector<int>();
+    removedRows.reserve(removedArtists.size());
 
-    if (removedArtistIterator == d->mAllArtists.end()) {
+    for (const auto &oneArtist : removedArtists) {
+        auto itArtist = d->mArtistRowById.find(oneArtist.databaseId());
+        if (itArtist == d->mArtistRowById.end()) {
+            continue;
+        }
+
+        removedRows.push_back(itArtist.value());
+        d->mArtistRowById.erase(itArtist);
+    }
+
+    if (removedRows.isEmpty()) {
         return;
     }
 
-    int artistIndex = removedArtistIterator - d->mAllArtists.begin();
+    std::sort(removedRows.begin(), removedRows.end());
+
+    auto lastRow = removedRows.size() - 1;
+    while (lastRow >= 0) {
+        auto firstRow = lastRow;
+        while (firstRow > 0 && removedRows[firstRow - 1] == removedRows[firstRow] - 1) {
+            --firstRow;
+        }
 
-    beginRemoveRows({}, artistIndex, artistIndex);
-    d->mAllArtists.erase(removedArtistIterator);
-    --d->mArtistsCount;
-    endRemoveRows();
+        beginRemoveRows({}, removedRows[firstRow], removedRows[lastRow]);
+        d->mAllArtists.remove(removedRows[firstRow], lastRow - firstRow + 1);
+        d->mArtistsCount = d->mAllArtists.size();
+        endRemoveRows();
+
+        lastRow = firstRow - 1;
+    }
+
+    for (int i = removedRows.first(); i < d->mAllArtists.size(); ++i) {
+        d->mArtistRowById[d->mAllArtists[i].databaseId()] = i;
+    }
 }
 
-void AllArtistsModel::artistModified(const MusicArtist &modifiedArtist)
+void AllArtistsModel::artistsModified(const QList<MusicArtist> &modifiedArtists)
 {
-    Q_UNUSED(modifiedArtist);
+    auto modifiedRows = QVector<int>();
+    modifiedRows.reserve(modifiedArtists.size());
+
+    for (const auto &oneArtist : modifiedArtists) {
+        auto itArtist = d->mArtistRowById.constFind(oneArtist.databaseId());
+        if (itArtist == d->mArtistRowById.constEnd()) {
+            continue;
+        }
+
+        d->mAllArtists[itArtist.value()] = oneArtist;
+        modifiedRows.push_back(itArtist.value());
+    }
+
+    if (modifiedRows.isEmpty()) {
+        return;
+    }
+
+    std::sort(modifiedRows.begin(), modifiedRows.end());
+
+    auto firstRow = 0;
+    while (firstRow < modifiedRows.size()) {
+        auto lastRow = firstRow;
+        while (lastRow + 1 < modifiedRows.size() && modifiedRows[lastRow + 1] <= modifiedRows[lastRow] + 1) {
+            ++lastRow;
+        }
+
+        Q_EMIT dataChanged(index(modifiedRows[firstRow], 0), index(modifiedRows[lastRow], 0));
+
+        firstRow = lastRow + 1;
+    }
 }
 
 #include "moc_allartistsmodel.cpp"
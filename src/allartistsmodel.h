@@ -67,11 +67,13 @@ public:
 
 public Q_SLOTS:
 
-    void artistAdded(const MusicArtist &newArtist);
+    void artistModified(const MusicArtist &modifiedArtist);
 
-    void artistRemoved(const MusicArtist &removedArtist);
+    void artistsAdded(const QList<MusicArtist> &newArtists);
 
-    void artistModified(const MusicArtist &modifiedArtist);
+    void artistsRemoved(const QList<MusicArtist> &removedArtists);
+
+    void artistsModified(const QList<MusicArtist> &modifiedArtists);
 
 private:
 
@@ -18,18 +18,33 @@
  */
 
 #include "alltracksmodel.h"
+#include "librarydiffworker.h"
 
 #include <algorithm>
 
+#include <QVector>
+#include <QHash>
 #include <QDebug>
 
 class AllTracksModelPrivate
 {
 public:
 
-    QHash<qulonglong, MusicAudioTrack> mAllTracks;
+    TracksModelDiff computeDiff(const QList<qulonglong> &removedIds, const QList<MusicAudioTrack> &addedTracks,
+                                const QList<MusicAudioTrack> &modifiedTracks) const
+    {
+        auto result = mShadow.computeDiff(removedIds, addedTracks, modifiedTracks);
+
+        LibraryDiffWorker::buildDisplayData(result);
+
+        return result;
+    }
+
+    QVector<MusicAudioTrack> mAllTracks;
 
-    QList<qulonglong> mIds;
+    QVector<ModelDisplayData<MusicAudioTrack>> mDisplayData;
+
+    ModelShadow<MusicAudioTrack> mShadow;
 
 };
 
@@ -113,77 +128,64 @@ QVariant AllTracksModel::data(const QModelIndex &index, int role) const
         return result;
     }
 
+    const auto &currentTrack = d->mAllTracks[index.row()];
+
     ColumnsRoles convertedRole = static_cast<ColumnsRoles>(role);
 
     switch(convertedRole)
     {
     case ColumnsRoles::TitleRole:
-        if (d->mAllTracks[d->mIds[index.row()]].title().isEmpty()) {
-            result = {};
-        }
-        result = d->mAllTracks[d->mIds[index.row()]].title();
+        result = currentTrack.title();
         break;
     case ColumnsRoles::MilliSecondsDurationRole:
-        result = d->mAllTracks[d->mIds[index.row()]].duration().msecsSinceStartOfDay();
+        result = currentTrack.duration().msecsSinceStartOfDay();
         break;
     case ColumnsRoles::DurationRole:
-    {
-        QTime trackDuration = d->mAllTracks[d->mIds[index.row()]].duration();
-        if (trackDuration.hour() == 0) {
-            result = trackDuration.toString(QStringLiteral("mm:ss"));
-        } else {
-            result = trackDuration.toString();
-        }
+        result = d->mDisplayData[index.row()].mDuration;
         break;
-    }
     case ColumnsRoles::CreatorRole:
-        result = d->mAllTracks[d->mIds[index.row()]].artist();
+        result = currentTrack.artist();
         break;
     case ColumnsRoles::ArtistRole:
-        result = d->mAllTracks[d->mIds[index.row()]].artist();
+        result = currentTrack.artist();
         break;
     case ColumnsRoles::AlbumRole:
-        result = d->mAllTracks[d->mIds[index.row()]].albumName();
+        result = currentTrack.albumName();
         break;
     case ColumnsRoles::AlbumArtistRole:
-        result = d->mAllTracks[d->mIds[index.row()]].albumArtist();
+        result = currentTrack.albumArtist();
         break;
     case ColumnsRoles::TrackNumberRole:
-        result = d->mAllTracks[d->mIds[index.row()]].trackNumber();
+        result = currentTrack.trackNumber();
         break;
     case ColumnsRoles::DiscNumberRole:
     {
-        const auto discNumber = d->mAllTracks[d->mIds[index.row()]].discNumber();
+        const auto discNumber = currentTrack.discNumber();
         if (discNumber > 0) {
             result = discNumber;
         }
         break;
     }
     case ColumnsRoles::IsSingleDiscAlbumRole:
-        result = d->mAllTracks[d->mIds[index.row()]].isSingleDiscAlbum();
+        result = currentTrack.isSingleDiscAlbum();
         break;
     case ColumnsRoles::RatingRole:
-        result = d->mAllTracks[d->mIds[index.row()]].rating();
+        result = currentTrack.rating();
         break;
     case ColumnsRoles::ImageRole:
-    {
-        const auto &imageUrl = d->mAllTracks[d->mIds[index.row()]].albumCover();
-        if (imageUrl.isValid()) {
-            result = imageUrl;
-        }
+        result = d->mDisplayData[index.row()].mImage;
         break;
-    }
     case ColumnsRoles::ResourceRole:
-        result = d->mAllTracks[d->mIds[index.row()]].resourceURI();
+        result = d->mDisplayData[index.row()].mResource;
         break;
     case ColumnsRoles::IdRole:
-        result = d->mAllTracks[d->mIds[index.row()]].title();
+        result = currentTrack.title();
         break;
     case ColumnsRoles::DatabaseIdRole:
-        result = d->mAllTracks[d->mIds[index.row()]].databaseId();
+        result = currentTrack.databaseId();
         break;
     case ColumnsRoles::TrackDataRole:
-        result = QVariant::fromValue(d->mAllTracks[d->mIds[index.row()]]);
+        result = QVariant::fromValue(currentTrack);
         break;
     }
 
@@ -229,55 +231,65 @@ int AllTracksModel::columnCount(const QModelIndex &parent) const
 
 void AllTracksModel::tracksAdded(const QList<MusicAudioTrack> &allTracks)
 {
-    auto newAllTracks = d->mAllTracks;
-    auto newTracksIds = QList<qulonglong>();
-
-    int countNewTracks = 0;
-
-    for (const auto &oneTrack : allTracks) {
-        if (newAllTracks.find(oneTrack.databaseId()) == newAllTracks.end()) {
-            newAllTracks[oneTrack.databaseId()] = oneTrack;
-            newTracksIds.push_back(oneTrack.databaseId());
-            ++countNewTracks;
-        }
-    }
+    applyChanges(d->computeDiff({}, allTracks, {}));
+}
 
-    if (countNewTracks > 0) {
-        beginInsertRows({}, d->mAllTracks.size(), d->mAllTracks.size() + countNewTracks - 1);
+void AllTracksModel::tracksRemoved(const QList<qulonglong> &removedTracksIds)
+{
+    applyChanges(d->computeDiff(removedTracksIds, {}, {}));
+}
 
-        d->mAllTracks = newAllTracks;
-        d->mIds.append(newTracksIds);
+void AllTracksModel::trackRemoved(qulonglong removedTrackId)
+{
+    tracksRemoved({removedTrackId});
+}
 
-        endInsertRows();
-    }
+void AllTracksModel::trackModified(const MusicAudioTrack &modifiedTrack)
+{
+    applyChanges(d->computeDiff({}, {}, {modifiedTrack}));
 }
 
-void AllTracksModel::trackRemoved(qulonglong removedTrackId)
+void AllTracksModel::applyChanges(const TracksModelDiff &changes)
 {
-    auto itTrack = std::find(d->mIds.begin(), d->mIds.end(), removedTrackId);
-    if (itTrack == d->mIds.end()) {
-        return;
+    d->mShadow.applyDiff(changes);
+
+    for (const auto &oneRange : changes.mRemovedRanges) {
+        beginRemoveRows({}, oneRange.first, oneRange.second);
+        d->mAllTracks.remove(oneRange.first, oneRange.second - oneRange.first + 1);
+        d->mDisplayData.remove(oneRange.first, oneRange.second - oneRange.first + 1);
+        endRemoveRows();
     }
 
-    auto position = itTrack - d->mIds.begin();
+    if (!changes.mInsertedItems.isEmpty()) {
+        beginInsertRows({}, d->mAllTracks.size(), d->mAllTracks.size() + changes.mInsertedItems.size() - 1);
 
-    beginRemoveRows({}, position, position);
-    d->mIds.erase(itTrack);
-    d->mAllTracks.remove(removedTrackId);
-    endRemoveRows();
-}
+        d->mAllTracks.reserve(d->mAllTracks.size() + changes.mInsertedItems.size());
+        d->mDisplayData.reserve(d->mAllTracks.size() + changes.mInsertedItems.size());
+        for (int i = 0; i < changes.mInsertedItems.size(); ++i) {
+            d->mAllTracks.push_back(changes.mInsertedItems[i]);
+            d->mDisplayData.push_back(changes.mInsertedDisplayData[i]);
+        }
 
-void AllTracksModel::trackModified(const MusicAudioTrack &modifiedTrack)
-{
-    auto itTrack = std::find(d->mIds.begin(), d->mIds.end(), modifiedTrack.databaseId());
-    if (itTrack == d->mIds.end()) {
-        return;
+        endInsertRows();
     }
 
-    auto position = itTrack - d->mIds.begin();
+    const auto &modifiedRows = changes.mModifiedRows;
+    auto firstRow = 0;
+    while (firstRow < modifiedRows.size()) {
+        auto lastRow = firstRow;
+        while (lastRow + 1 < modifiedRows.size() && modifiedRows[lastRow + 1].first == modifiedRows[lastRow].first + 1) {
+            ++lastRow;
+        }
+
+        for (int i = firstRow; i <= lastRow; ++i) {
+            d->mAllTracks[modifiedRows[i].first] = modifiedRows[i].second;
+            d->mDisplayData[modifiedRows[i].first] = changes.mModifiedDisplayData[i];
+        }
 
-    d->mAllTracks[modifiedTrack.databaseId()] = modifiedTrack;
-    Q_EMIT dataChanged(index(position, 0), index(position, 0));
+        Q_EMIT dataChanged(index(modifiedRows[firstRow].first, 0), index(modifiedRows[lastRow].first, 0));
+
+        firstRow = lastRow + 1;
+    }
 }
 
 
@@ -23,6 +23,7 @@
 #include <QAbstractItemModel>
 
 #include "musicaudiotrack.h"
+#include "modeldiff.h"
 
 #include <memory>
 
@@ -77,10 +78,14 @@ public Q_SLOTS:
 
     void tracksAdded(const QList<MusicAudioTrack> &allTracks);
 
+    void tracksRemoved(const QList<qulonglong> &removedTracksIds);
+
     void trackRemoved(qulonglong removedTrackId);
 
     void trackModified(const MusicAudioTrack &modifiedTrack);
 
+    void applyChanges(const TracksModelDiff &changes);
+
 private:
 
     std::unique_ptr<AllTracksModelPrivate> d;
@@ -168,19 +168,19 @@ ApplicationWindow {
     Connections {
         target: allListeners
 
-        onAlbumAdded: allAlbumsModel.albumAdded(newAlbum)
+        onAlbumsAdded: allAlbumsModel.albumsAdded(newAlbums)
     }
 
     Connections {
         target: allListeners
 
-        onAlbumRemoved: allAlbumsModel.albumRemoved(removedAlbum)
+        onAlbumsRemoved: allAlbumsModel.albumsRemoved(removedAlbums)
     }
 
     Connections {
         target: allListeners
 
-        onAlbumModified: allAlbumsModel.albumModified(modifiedAlbum)
+        onAlbumsModified: allAlbumsModel.albumsModified(modifiedAlbums)
     }
 
     AllArtistsModel {
@@ -190,13 +190,13 @@ ApplicationWindow {
     Connections {
         target: allListeners
 
-        onArtistAdded: allArtistsModel.artistAdded(newArtist)
+        onArtistsAdded: allArtistsModel.artistsAdded(newArtists)
     }
 
     Connections {
         target: allListeners
 
-        onArtistRemoved: allArtistsModel.artistRemoved(removedArtist)
+        onArtistsRemoved: allArtistsModel.artistsRemoved(removedArtists)
     }
 
     Connections {
@@ -0,0 +1,125 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "artistalbumsmodel.h"
+
+class ArtistAlbumsModelPrivate
+{
+public:
+
+    QString mArtist;
+
+};
+
+ArtistAlbumsModel::ArtistAlbumsModel(QObject *parent) : AllAlbumsModel(parent), d(std::make_unique<ArtistAlbumsModelPrivate>())
+{
+}
+
+ArtistAlbumsModel::~ArtistAlbumsModel()
+= default;
+
+QString ArtistAlbumsModel::artist() const
+{
+    return d->mArtist;
+}
+
+void ArtistAlbumsModel::setArtist(const QString &artist)
+{
+    if (d->mArtist == artist) {
+        return;
+    }
+
+    d->mArtist = artist;
+    Q_EMIT artistChanged();
+
+    resetAlbums({});
+}
+
+void ArtistAlbumsModel::albumsFromArtistFetched(const QString &artistName, const QList<MusicAlbum> &albums)
+{
+    if (artistName != d->mArtist) {
+        return;
+    }
+
+    resetAlbums(albums);
+}
+
+void ArtistAlbumsModel::libraryAlbumsAdded(const QList<MusicAlbum> &newAlbums)
+{
+    auto artistAlbums = QList<MusicAlbum>();
+
+    for (const auto &oneAlbum : newAlbums) {
+        if (isFromArtist(oneAlbum)) {
+            artistAlbums.push_back(oneAlbum);
+        }
+    }
+
+    if (!artistAlbums.isEmpty()) {
+        albumsAdded(artistAlbums);
+    }
+}
+
+void ArtistAlbumsModel::libraryAlbumsRemoved(const QList<MusicAlbum> &removedAlbums)
+{
+    albumsRemoved(removedAlbums);
+}
+
+void ArtistAlbumsModel::libraryAlbumsModified(const QList<MusicAlbum> &modifiedAlbums)
+{
+    auto addedAlbums = QList<MusicAlbum>();
+    auto removedAlbums = QList<MusicAlbum>();
+    auto changedAlbums = QList<MusicAlbum>();
+
+    for (const auto &oneAlbum : modifiedAlbums) {
+        const auto isKnown = containsAlbum(oneAlbum.databaseId());
+        const auto isMatching = isFromArtist(oneAlbum);
+
+        if (isKnown && isMatching) {
+            changedAlbums.push_back(oneAlbum);
+        } else if (isKnown) {
+            removedAlbums.push_back(oneAlbum);
+        } else if (isMatching) {
+            addedAlbums.push_back(oneAlbum);
+        }
+    }
+
+    if (!removedAlbums.isEmpty()) {
+        albumsRemoved(removedAlbums);
+    }
+
+    if (!changedAlbums.isEmpty()) {
+        albumsModified(changedAlbums);
+    }
+
+    if (!addedAlbums.isEmpty()) {
+        albumsAdded(addedAlbums);
+    }
+}
+
+bool ArtistAlbumsModel::isFromArtist(const MusicAlbum &album) const
+{
+    if (d->mArtist.isEmpty()) {
+        return false;
+    }
+
+    return album.artist() == d->mArtist || album.allArtists().contains(d->mArtist);
+}
+
+
+#include "moc_artistalbumsmodel.cpp"
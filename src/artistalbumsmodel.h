@@ -0,0 +1,75 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef ARTISTALBUMSMODEL_H
+#define ARTISTALBUMSMODEL_H
+
+#include "allalbumsmodel.h"
+
+#include <QList>
+#include <QString>
+
+#include "musicalbum.h"
+
+#include <memory>
+
+class ArtistAlbumsModelPrivate;
+
+class ArtistAlbumsModel : public AllAlbumsModel
+{
+    Q_OBJECT
+
+    Q_PROPERTY(QString artist
+               READ artist
+               WRITE setArtist
+               NOTIFY artistChanged)
+
+public:
+
+    explicit ArtistAlbumsModel(QObject *parent = nullptr);
+
+    ~ArtistAlbumsModel() override;
+
+    QString artist() const;
+
+Q_SIGNALS:
+
+    void artistChanged();
+
+public Q_SLOTS:
+
+    void setArtist(const QString &artist);
+
+    void albumsFromArtistFetched(const QString &artistName, const QList<MusicAlbum> &albums);
+
+    void libraryAlbumsAdded(const QList<MusicAlbum> &newAlbums);
+
+    void libraryAlbumsRemoved(const QList<MusicAlbum> &removedAlbums);
+
+    void libraryAlbumsModified(const QList<MusicAlbum> &modifiedAlbums);
+
+private:
+
+    bool isFromArtist(const MusicAlbum &album) const;
+
+    std::unique_ptr<ArtistAlbumsModelPrivate> d;
+
+};
+
+#endif // ARTISTALBUMSMODEL_H
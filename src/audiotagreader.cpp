@@ -0,0 +1,1061 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "audiotagreader.h"
+
+#include "musicaudiotrack.h"
+
+#include <QFile>
+#include <QByteArray>
+#include <QTime>
+#include <QtEndian>
+
+#include <cstring>
+
+namespace {
+
+enum class TagField {
+    NoField,
+    Title,
+    Artist,
+    Album,
+    AlbumArtist,
+    TrackNumber,
+    DiscNumber,
+    Length,
+    Picture,
+};
+
+struct TagFieldName {
+    const char *mName;
+    TagField mField;
+};
+
+const TagFieldName id3v22Fields[] = {
+    {"TT2", TagField::Title},
+    {"TP1", TagField::Artist},
+    {"TAL", TagField::Album},
+    {"TP2", TagField::AlbumArtist},
+    {"TRK", TagField::TrackNumber},
+    {"TPA", TagField::DiscNumber},
+    {"TLE", TagField::Length},
+    {"PIC", TagField::Picture},
+};
+
+const TagFieldName id3v2Fields[] = {
+    {"TIT2", TagField::Title},
+    {"TPE1", TagField::Artist},
+    {"TALB", TagField::Album},
+    {"TPE2", TagField::AlbumArtist},
+    {"TRCK", TagField::TrackNumber},
+    {"TPOS", TagField::DiscNumber},
+    {"TLEN", TagField::Length},
+    {"APIC", TagField::Picture},
+};
+
+const TagFieldName vorbisCommentFields[] = {
+    {"TITLE", TagField::Title},
+    {"ARTIST", TagField::Artist},
+    {"ALBUM", TagField::Album},
+    {"ALBUMARTIST", TagField::AlbumArtist},
+    {"ALBUM ARTIST", TagField::AlbumArtist},
+    {"TRACKNUMBER", TagField::TrackNumber},
+    {"DISCNUMBER", TagField::DiscNumber},
+    {"METADATA_BLOCK_PICTURE", TagField::Picture},
+};
+
+const TagFieldName mp4Fields[] = {
+    {"\xA9nam", TagField::Title},
+    {"\xA9""ART", TagField::Artist},
+    {"\xA9""alb", TagField::Album},
+    {"aART", TagField::AlbumArtist},
+    {"trkn", TagField::TrackNumber},
+    {"disk", TagField::DiscNumber},
+    {"covr", TagField::Picture},
+};
+
+const int mpegBitrates[5][16] = {
+    {0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448, 0},
+    {0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 0},
+    {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0},
+    {0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256, 0},
+    {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0},
+};
+
+const int mpegSampleRates[3] = {44100, 48000, 32000};
+
+template <std::size_t N>
+TagField findField(const TagFieldName (&allFields)[N], const char *name, int nameLength, bool caseSensitive)
+{
+    for (const auto &oneField : allFields) {
+        if (static_cast<int>(std::strlen(oneField.mName)) != nameLength) {
+            continue;
+        }
+
+        const auto isSameName = caseSensitive ? std::memcmp(oneField.mName, name, nameLength) == 0 :
+                                                qstrnicmp(oneField.mName, name, nameLength) == 0;
+
+        if (isSameName) {
+            return oneField.mField;
+        }
+    }
+
+    return TagField::NoField;
+}
+
+static int leadingNumber(const QString &value, int maximumNumber = 9999)
+{
+    auto result = 0;
+
+    for (const auto &oneCharacter : value) {
+        if (oneCharacter.isSpace() && result == 0) {
+            continue;
+        }
+
+        if (!oneCharacter.isDigit()) {
+            break;
+        }
+
+        result = result * 10 + oneCharacter.digitValue();
+
+        if (result > maximumNumber) {
+            break;
+        }
+    }
+
+    return result;
+}
+
+qint64 synchSafeInteger(const uchar *data)
+{
+    return (qint64(data[0] & 0x7f) << 21) | (qint64(data[1] & 0x7f) << 14) |
+            (qint64(data[2] & 0x7f) << 7) | qint64(data[3] & 0x7f);
+}
+
+}
+
+class AudioTagReaderPrivate
+{
+public:
+
+    AudioTagReaderPrivate()
+    {
+        mBuffer.reserve(mInitialBufferSize);
+        mPacket.reserve(mInitialBufferSize);
+    }
+
+    void reset()
+    {
+        mTitle.clear();
+        mArtist.clear();
+        mAlbum.clear();
+        mAlbumArtist.clear();
+        mTrackNumber = 0;
+        mDiscNumber = 0;
+        mDuration = 0;
+        mSampleRate = 0;
+        mPreSkip = 0;
+        mCoverData.clear();
+        mIsFrontCover = false;
+    }
+
+    const uchar* data() const
+    {
+        return reinterpret_cast<const uchar*>(mBuffer.constData());
+    }
+
+    void releaseBuffers()
+    {
+        if (mBuffer.capacity() > mInitialBufferSize) {
+            mBuffer = QByteArray();
+            mBuffer.reserve(mInitialBufferSize);
+        }
+
+        if (mPacket.capacity() > mInitialBufferSize) {
+            mPacket = QByteArray();
+            mPacket.reserve(mInitialBufferSize);
+        }
+    }
+
+    qint64 maximumBlockSize() const
+    {
+        return (mWantCover ? mMaximumPictureSize : mMaximumBlockSize);
+    }
+
+    bool read(qint64 offset, qint64 length, qint64 maximumLength)
+    {
+        if (offset < 0 || length < 0 || length > maximumLength || offset + length > mFileSize) {
+            return false;
+        }
+
+        if (mBuffer.size() < length) {
+            mBuffer.resize(static_cast<int>(length));
+        }
+
+        if (!mFile.seek(offset)) {
+            return false;
+        }
+
+        const auto readBytes = mFile.read(mBuffer.data(), length);
+
+        if (readBytes > 0) {
+            mBytesRead += readBytes;
+        }
+
+        return readBytes == length;
+    }
+
+    bool read(qint64 offset, qint64 length)
+    {
+        return read(offset, length, mMaximumBlockSize);
+    }
+
+    void setField(TagField field, const QString &value)
+    {
+        switch (field)
+        {
+        case TagField::Title:
+            if (mTitle.isEmpty()) {
+                mTitle = value;
+            }
+            break;
+        case TagField::Artist:
+            if (mArtist.isEmpty()) {
+                mArtist = value;
+            }
+            break;
+        case TagField::Album:
+            if (mAlbum.isEmpty()) {
+                mAlbum = value;
+            }
+            break;
+        case TagField::AlbumArtist:
+            if (mAlbumArtist.isEmpty()) {
+                mAlbumArtist = value;
+            }
+            break;
+        case TagField::TrackNumber:
+            if (mTrackNumber == 0) {
+                mTrackNumber = leadingNumber(value);
+            }
+            break;
+        case TagField::DiscNumber:
+            if (mDiscNumber == 0) {
+                mDiscNumber = leadingNumber(value);
+            }
+            break;
+        case TagField::Length:
+            if (mDuration == 0) {
+                mDuration = leadingNumber(value, 24 * 3600 * 1000);
+            }
+            break;
+        case TagField::Picture:
+        case TagField::NoField:
+            break;
+        }
+    }
+
+    QString decodeId3Text(const uchar *text, qint64 length) const
+    {
+        if (length < 1) {
+            return {};
+        }
+
+        const auto encoding = text[0];
+        ++text;
+        --length;
+
+        if (encoding == 0 || encoding == 3) {
+            auto textLength = qint64(0);
+            while (textLength < length && text[textLength] != 0) {
+                ++textLength;
+            }
+
+            if (encoding == 0) {
+                return QString::fromLatin1(reinterpret_cast<const char*>(text), static_cast<int>(textLength));
+            }
+
+            return QString::fromUtf8(reinterpret_cast<const char*>(text), static_cast<int>(textLength));
+        }
+
+        if (encoding != 1 && encoding != 2) {
+            return {};
+        }
+
+        auto isBigEndian = true;
+        if (encoding == 1 && length >= 2) {
+            if (text[0] == 0xff && text[1] == 0xfe) {
+                isBigEndian = false;
+                text += 2;
+                length -= 2;
+            } else if (text[0] == 0xfe && text[1] == 0xff) {
+                text += 2;
+                length -= 2;
+            }
+        }
+
+        auto charactersCount = 0;
+        while (2 * charactersCount + 1 < length) {
+            const auto oneCharacter = isBigEndian ? qFromBigEndian<quint16>(text + 2 * charactersCount) :
+                                                    qFromLittleEndian<quint16>(text + 2 * charactersCount);
+            if (oneCharacter == 0) {
+                break;
+            }
+            ++charactersCount;
+        }
+
+        QString result(charactersCount, Qt::Uninitialized);
+        auto resultData = result.data();
+        for (int i = 0; i < charactersCount; ++i) {
+            resultData[i] = QChar(isBigEndian ? qFromBigEndian<quint16>(text + 2 * i) :
+                                                qFromLittleEndian<quint16>(text + 2 * i));
+        }
+
+        return result;
+    }
+
+    void setCover(const uchar *imageData, qint64 length, bool isFrontCover)
+    {
+        if (length <= 0 || (!mCoverData.isEmpty() && (mIsFrontCover || !isFrontCover))) {
+            return;
+        }
+
+        mCoverData = QByteArray(reinterpret_cast<const char*>(imageData), static_cast<int>(length));
+        mIsFrontCover = isFrontCover;
+    }
+
+    void parseFlacPicture(const uchar *picture, qint64 length)
+    {
+        if (length < 32) {
+            return;
+        }
+
+        const auto pictureType = qFromBigEndian<quint32>(picture);
+        auto position = 8 + qint64(qFromBigEndian<quint32>(picture + 4));
+        if (position + 4 > length) {
+            return;
+        }
+
+        position += 4 + qint64(qFromBigEndian<quint32>(picture + position)) + 16;
+        if (position + 4 > length) {
+            return;
+        }
+
+        const auto pictureLength = qint64(qFromBigEndian<quint32>(picture + position));
+        position += 4;
+        if (position + pictureLength > length) {
+            return;
+        }
+
+        setCover(picture + position, pictureLength, pictureType == 3);
+    }
+
+    void parseId3Picture(const uchar *frame, qint64 length, bool isVersion22)
+    {
+        if (length < 4) {
+            return;
+        }
+
+        const auto encoding = frame[0];
+        auto position = qint64(1);
+
+        if (isVersion22) {
+            position += 3;
+        } else {
+            while (position < length && frame[position] != 0) {
+                ++position;
+            }
+            ++position;
+        }
+
+        if (position >= length) {
+            return;
+        }
+
+        const auto pictureType = frame[position];
+        ++position;
+
+        if (encoding == 1 || encoding == 2) {
+            while (position + 1 < length && (frame[position] != 0 || frame[position + 1] != 0)) {
+                position += 2;
+            }
+            position += 2;
+        } else {
+            while (position < length && frame[position] != 0) {
+                ++position;
+            }
+            ++position;
+        }
+
+        if (position >= length) {
+            return;
+        }
+
+        setCover(frame + position, length - position, pictureType == 3);
+    }
+
+    bool parseVorbisComment(const uchar *comment, qint64 length)
+    {
+        if (length < 8) {
+            return false;
+        }
+
+        auto position = 4 + qint64(qFromLittleEndian<quint32>(comment));
+        if (position + 4 > length) {
+            return false;
+        }
+
+        const auto commentsCount = qFromLittleEndian<quint32>(comment + position);
+        position += 4;
+
+        for (quint32 i = 0; i < commentsCount && position + 4 <= length; ++i) {
+            const auto commentLength = qint64(qFromLittleEndian<quint32>(comment + position));
+            position += 4;
+
+            if (position + commentLength > length) {
+                return false;
+            }
+
+            const auto oneComment = reinterpret_cast<const char*>(comment + position);
+            const auto separator = static_cast<const char*>(std::memchr(oneComment, '=', commentLength));
+
+            if (separator) {
+                const auto keyLength = static_cast<int>(separator - oneComment);
+                const auto field = findField(vorbisCommentFields, oneComment, keyLength, false);
+
+                const auto valueLength = static_cast<int>(commentLength - keyLength - 1);
+
+                if (field == TagField::Picture) {
+                    if (mWantCover) {
+                        const auto picture = QByteArray::fromBase64(QByteArray::fromRawData(separator + 1, valueLength));
+                        parseFlacPicture(reinterpret_cast<const uchar*>(picture.constData()), picture.size());
+                    }
+                } else if (field != TagField::NoField) {
+                    setField(field, QString::fromUtf8(separator + 1, valueLength));
+                }
+            }
+
+            position += commentLength;
+        }
+
+        return true;
+    }
+
+    bool readId3v2()
+    {
+        if (!read(0, 10)) {
+            return false;
+        }
+
+        const auto majorVersion = data()[3];
+        const auto flags = data()[5];
+        const auto tagEnd = 10 + synchSafeInteger(data() + 6);
+
+        if (majorVersion < 2 || majorVersion > 4 || (flags & 0x80)) {
+            return false;
+        }
+
+        auto offset = qint64(10);
+
+        if ((flags & 0x40) && majorVersion > 2) {
+            if (!read(offset, 4)) {
+                return false;
+            }
+
+            offset += (majorVersion == 4 ? synchSafeInteger(data()) : 4 + qint64(qFromBigEndian<quint32>(data())));
+        }
+
+        const auto frameHeaderSize = (majorVersion == 2 ? 6 : 10);
+        const auto frameIdSize = (majorVersion == 2 ? 3 : 4);
+
+        while (offset + frameHeaderSize <= tagEnd) {
+            if (!read(offset, frameHeaderSize)) {
+                return false;
+            }
+
+            const auto frameHeader = data();
+
+            if (frameHeader[0] == 0) {
+                break;
+            }
+
+            auto frameSize = qint64(0);
+            auto isPlainFrame = true;
+
+            if (majorVersion == 2) {
+                frameSize = (qint64(frameHeader[3]) << 16) | (qint64(frameHeader[4]) << 8) | qint64(frameHeader[5]);
+            } else if (majorVersion == 3) {
+                frameSize = qFromBigEndian<quint32>(frameHeader + 4);
+                isPlainFrame = (frameHeader[9] & 0xe0) == 0;
+            } else {
+                frameSize = synchSafeInteger(frameHeader + 4);
+                isPlainFrame = (frameHeader[9] & 0x4f) == 0;
+            }
+
+            const auto field = (majorVersion == 2 ?
+                                    findField(id3v22Fields, reinterpret_cast<const char*>(frameHeader), frameIdSize, true) :
+                                    findField(id3v2Fields, reinterpret_cast<const char*>(frameHeader), frameIdSize, true));
+
+            offset += frameHeaderSize;
+
+            if (frameSize <= 0 || offset + frameSize > tagEnd) {
+                break;
+            }
+
+            if (field == TagField::Picture) {
+                if (mWantCover && isPlainFrame && frameSize <= mMaximumPictureSize) {
+                    if (!read(offset, frameSize, mMaximumPictureSize)) {
+                        return false;
+                    }
+
+                    parseId3Picture(data(), frameSize, majorVersion == 2);
+                }
+            } else if (field != TagField::NoField && isPlainFrame && frameSize <= mMaximumTextSize) {
+                if (!read(offset, frameSize)) {
+                    return false;
+                }
+
+                setField(field, decodeId3Text(data(), frameSize));
+            }
+
+            offset += frameSize;
+        }
+
+        if (mWantCover) {
+            return true;
+        }
+
+        const auto audioStart = (majorVersion == 4 && (flags & 0x10)) ? tagEnd + 10 : tagEnd;
+
+        if (read(audioStart, 4) && std::memcmp(data(), "fLaC", 4) == 0) {
+            return false;
+        }
+
+        return readMpegDuration(audioStart);
+    }
+
+    bool readMpegDuration(qint64 audioStart)
+    {
+        if (mDuration > 0) {
+            return true;
+        }
+
+        const auto searchLength = qMin(mMpegSearchSize, mFileSize - audioStart);
+        if (searchLength < 4 || !read(audioStart, searchLength)) {
+            return false;
+        }
+
+        const auto buffer = data();
+
+        for (qint64 position = 0; position + 4 <= searchLength; ++position) {
+            if (buffer[position] != 0xff || (buffer[position + 1] & 0xe0) != 0xe0) {
+                continue;
+            }
+
+            const auto header = qFromBigEndian<quint32>(buffer + position);
+            const auto versionBits = (header >> 19) & 3;
+            const auto layerBits = (header >> 17) & 3;
+            const auto bitrateIndex = (header >> 12) & 15;
+            const auto sampleRateIndex = (header >> 10) & 3;
+            const auto isMono = ((header >> 6) & 3) == 3;
+
+            if (versionBits == 1 || layerBits == 0 || bitrateIndex == 0 || bitrateIndex == 15 || sampleRateIndex == 3) {
+                continue;
+            }
+
+            const auto isVersion1 = versionBits == 3;
+            const auto layer = 4 - static_cast<int>(layerBits);
+            const auto bitrateTable = (isVersion1 ? layer - 1 : (layer == 1 ? 3 : 4));
+            const auto bitrate = mpegBitrates[bitrateTable][bitrateIndex];
+            const auto sampleRate = mpegSampleRates[sampleRateIndex] >> (versionBits == 3 ? 0 : (versionBits == 2 ? 1 : 2));
+            const auto samplesPerFrame = (layer == 1 ? 384 : ((layer == 3 && !isVersion1) ? 576 : 1152));
+
+            auto framesCount = qint64(0);
+
+            const auto sideInformationSize = (isVersion1 ? (isMono ? 17 : 32) : (isMono ? 9 : 17));
+            const auto xingPosition = position + 4 + sideInformationSize;
+            const auto vbriPosition = position + 4 + 32;
+
+            if (xingPosition + 12 <= searchLength &&
+                    (std::memcmp(buffer + xingPosition, "Xing", 4) == 0 || std::memcmp(buffer + xingPosition, "Info", 4) == 0)) {
+                if (qFromBigEndian<quint32>(buffer + xingPosition + 4) & 1) {
+                    framesCount = qFromBigEndian<quint32>(buffer + xingPosition + 8);
+                }
+            } else if (vbriPosition + 18 <= searchLength && std::memcmp(buffer + vbriPosition, "VBRI", 4) == 0) {
+                framesCount = qFromBigEndian<quint32>(buffer + vbriPosition + 14);
+            }
+
+            if (framesCount > 0) {
+                mDuration = framesCount * samplesPerFrame * 1000 / sampleRate;
+                return true;
+            }
+
+            auto audioEnd = mFileSize;
+            const auto firstFrame = audioStart + position;
+
+            if (read(mFileSize - 128, 3) && std::memcmp(data(), "TAG", 3) == 0) {
+                audioEnd -= 128;
+            }
+
+            mDuration = (audioEnd - firstFrame) * 8 / bitrate;
+
+            return true;
+        }
+
+        return false;
+    }
+
+    bool readFlac()
+    {
+        auto offset = qint64(4);
+        auto isLastBlock = false;
+
+        while (!isLastBlock) {
+            if (!read(offset, 4)) {
+                return false;
+            }
+
+            isLastBlock = (data()[0] & 0x80) != 0;
+            const auto blockType = data()[0] & 0x7f;
+            const auto blockLength = (qint64(data()[1]) << 16) | (qint64(data()[2]) << 8) | qint64(data()[3]);
+
+            offset += 4;
+
+            if (blockType == 0 && blockLength >= 18) {
+                if (!read(offset, 18)) {
+                    return false;
+                }
+
+                const auto streamInfo = data();
+                const auto sampleRate = (qint64(streamInfo[10]) << 12) | (qint64(streamInfo[11]) << 4) | (qint64(streamInfo[12]) >> 4);
+                const auto samplesCount = (qint64(streamInfo[13] & 0x0f) << 32) | qint64(qFromBigEndian<quint32>(streamInfo + 14));
+
+                if (sampleRate > 0) {
+                    mDuration = samplesCount * 1000 / sampleRate;
+                }
+            } else if (blockType == 4) {
+                if (!read(offset, blockLength, maximumBlockSize()) || !parseVorbisComment(data(), blockLength)) {
+                    return false;
+                }
+            } else if (blockType == 6 && mWantCover) {
+                if (!read(offset, blockLength, mMaximumPictureSize)) {
+                    return false;
+                }
+
+                parseFlacPicture(data(), blockLength);
+            }
+
+            offset += blockLength;
+        }
+
+        return true;
+    }
+
+    bool handleOggPacket(int packetIndex)
+    {
+        const auto packet = reinterpret_cast<const uchar*>(mPacket.constData());
+        const auto packetLength = mPacket.size();
+
+        if (packetIndex == 0) {
+            if (packetLength >= 16 && std::memcmp(packet, "\x01vorbis", 7) == 0) {
+                mSampleRate = qFromLittleEndian<quint32>(packet + 12);
+                return true;
+            }
+
+            if (packetLength >= 19 && std::memcmp(packet, "OpusHead", 8) == 0) {
+                mPreSkip = qFromLittleEndian<quint16>(packet + 10);
+                mSampleRate = 48000;
+                return true;
+            }
+
+            return false;
+        }
+
+        if (packetLength >= 7 && std::memcmp(packet, "\x03vorbis", 7) == 0) {
+            return parseVorbisComment(packet + 7, packetLength - 7);
+        }
+
+        if (packetLength >= 8 && std::memcmp(packet, "OpusTags", 8) == 0) {
+            return parseVorbisComment(packet + 8, packetLength - 8);
+        }
+
+        return false;
+    }
+
+    bool readOgg()
+    {
+        auto offset = qint64(0);
+        auto packetIndex = 0;
+        auto streamSerial = quint32(0);
+        uchar segments[255];
+
+        mPacket.resize(0);
+
+        while (packetIndex < 2) {
+            if (!read(offset, 27) || std::memcmp(data(), "OggS", 4) != 0) {
+                return false;
+            }
+
+            const auto pageSerial = qFromLittleEndian<quint32>(data() + 14);
+            const auto segmentsCount = int(data()[26]);
+
+            if (offset == 0) {
+                streamSerial = pageSerial;
+            }
+
+            if (!read(offset + 27, segmentsCount)) {
+                return false;
+            }
+
+            std::memcpy(segments, data(), segmentsCount);
+
+            const auto bodyOffset = offset + 27 + segmentsCount;
+            auto bodyLength = qint64(0);
+            for (int i = 0; i < segmentsCount; ++i) {
+                bodyLength += segments[i];
+            }
+
+            offset = bodyOffset + bodyLength;
+
+            if (pageSerial != streamSerial) {
+                continue;
+            }
+
+            if (!read(bodyOffset, bodyLength)) {
+                return false;
+            }
+
+            auto bodyPosition = 0;
+            for (int i = 0; i < segmentsCount && packetIndex < 2; ++i) {
+                if (mPacket.size() + segments[i] > maximumBlockSize()) {
+                    return false;
+                }
+
+                mPacket.append(mBuffer.constData() + bodyPosition, segments[i]);
+                bodyPosition += segments[i];
+
+                if (segments[i] < 255) {
+                    if (!handleOggPacket(packetIndex)) {
+                        return false;
+                    }
+
+                    ++packetIndex;
+                    mPacket.resize(0);
+                }
+            }
+        }
+
+        if (mWantCover) {
+            return true;
+        }
+
+        const auto tailLength = qMin(mOggTailSize, mFileSize);
+        if (mSampleRate == 0 || !read(mFileSize - tailLength, tailLength)) {
+            return false;
+        }
+
+        const auto tail = data();
+        for (auto position = tailLength - 27; position >= 0; --position) {
+            if (std::memcmp(tail + position, "OggS", 4) != 0 || qFromLittleEndian<quint32>(tail + position + 14) != streamSerial) {
+                continue;
+            }
+
+            const auto granulePosition = qFromLittleEndian<qint64>(tail + position + 6);
+            if (granulePosition <= 0) {
+                continue;
+            }
+
+            mDuration = qMax(qint64(0), granulePosition - mPreSkip) * 1000 / mSampleRate;
+            break;
+        }
+
+        return true;
+    }
+
+    bool readFile(const QString &fileName)
+    {
+        reset();
+
+        mFile.setFileName(fileName);
+        if (!mFile.open(QIODevice::ReadOnly)) {
+            return false;
+        }
+
+        mFileSize = mFile.size();
+
+        auto result = false;
+
+        if (read(0, 12)) {
+            const auto header = data();
+
+            if (std::memcmp(header, "ID3", 3) == 0) {
+                result = readId3v2();
+            } else if (std::memcmp(header, "fLaC", 4) == 0) {
+                result = readFlac();
+            } else if (std::memcmp(header, "OggS", 4) == 0) {
+                result = readOgg();
+            } else if (std::memcmp(header + 4, "ftyp", 4) == 0) {
+                result = readMp4Atoms(0, mFileSize, 0);
+            }
+        }
+
+        mFile.close();
+
+        releaseBuffers();
+
+        return result;
+    }
+
+    bool readMp4Items(qint64 offset, qint64 end)
+    {
+        while (offset + 8 <= end) {
+            if (!read(offset, 8)) {
+                return false;
+            }
+
+            const auto itemSize = qint64(qFromBigEndian<quint32>(data()));
+            const auto field = findField(mp4Fields, reinterpret_cast<const char*>(data() + 4), 4, true);
+
+            if (itemSize < 8 || offset + itemSize > end) {
+                return false;
+            }
+
+            const auto contentLength = itemSize - 8;
+            const auto maximumLength = (field == TagField::Picture ? mMaximumPictureSize : mMaximumTextSize);
+
+            if (field == TagField::Picture && !mWantCover) {
+                offset += itemSize;
+                continue;
+            }
+
+            if (field != TagField::NoField && contentLength >= 16 && contentLength <= maximumLength) {
+                if (!read(offset + 8, contentLength, maximumLength)) {
+                    return false;
+                }
+
+                const auto itemData = data();
+                const auto dataSize = qint64(qFromBigEndian<quint32>(itemData));
+
+                if (std::memcmp(itemData + 4, "data", 4) == 0 && dataSize >= 16 && dataSize <= contentLength) {
+                    const auto payload = itemData + 16;
+                    const auto payloadLength = dataSize - 16;
+
+                    if (field == TagField::Picture) {
+                        setCover(payload, payloadLength, true);
+                    } else if (field == TagField::TrackNumber || field == TagField::DiscNumber) {
+                        if (payloadLength >= 4) {
+                            const auto number = int(qFromBigEndian<quint16>(payload + 2));
+                            if (field == TagField::TrackNumber && mTrackNumber == 0) {
+                                mTrackNumber = number;
+                            } else if (field == TagField::DiscNumber && mDiscNumber == 0) {
+                                mDiscNumber = number;
+                            }
+                        }
+                    } else {
+                        setField(field, QString::fromUtf8(reinterpret_cast<const char*>(payload), static_cast<int>(payloadLength)));
+                    }
+                }
+            }
+
+            offset += itemSize;
+        }
+
+        return true;
+    }
+
+    bool readMp4Atoms(qint64 offset, qint64 end, int depth)
+    {
+        if (depth > mMaximumAtomDepth) {
+            return false;
+        }
+
+        while (offset + 8 <= end) {
+            if (!read(offset, 8)) {
+                return false;
+            }
+
+            auto atomSize = qint64(qFromBigEndian<quint32>(data()));
+            char atomType[4];
+            std::memcpy(atomType, data() + 4, 4);
+            auto headerSize = qint64(8);
+
+            if (atomSize == 1) {
+                if (!read(offset + 8, 8)) {
+                    return false;
+                }
+
+                atomSize = qFromBigEndian<qint64>(data());
+                headerSize = 16;
+            } else if (atomSize == 0) {
+                atomSize = end - offset;
+            }
+
+            if (atomSize < headerSize || offset + atomSize > end) {
+                return false;
+            }
+
+            const auto contentOffset = offset + headerSize;
+            const auto contentEnd = offset + atomSize;
+
+            if (std::memcmp(atomType, "moov", 4) == 0 || std::memcmp(atomType, "udta", 4) == 0) {
+                if (!readMp4Atoms(contentOffset, contentEnd, depth + 1)) {
+                    return false;
+                }
+            } else if (std::memcmp(atomType, "meta", 4) == 0) {
+                if (!read(contentOffset, 8)) {
+                    return false;
+                }
+
+                const auto isFullBox = std::memcmp(data() + 4, "hdlr", 4) != 0;
+
+                if (!readMp4Atoms(contentOffset + (isFullBox ? 4 : 0), contentEnd, depth + 1)) {
+                    return false;
+                }
+            } else if (std::memcmp(atomType, "ilst", 4) == 0) {
+                if (!readMp4Items(contentOffset, contentEnd)) {
+                    return false;
+                }
+            } else if (std::memcmp(atomType, "mvhd", 4) == 0) {
+                if (!read(contentOffset, qMin(qint64(32), contentEnd - contentOffset))) {
+                    return false;
+                }
+
+                const auto movieHeader = data();
+                auto timeScale = qint64(0);
+                auto duration = qint64(0);
+
+                if (movieHeader[0] == 1 && contentEnd - contentOffset >= 32) {
+                    timeScale = qFromBigEndian<quint32>(movieHeader + 20);
+                    duration = qFromBigEndian<qint64>(movieHeader + 24);
+                } else if (contentEnd - contentOffset >= 20) {
+                    timeScale = qFromBigEndian<quint32>(movieHeader + 12);
+                    duration = qFromBigEndian<quint32>(movieHeader + 16);
+                }
+
+                if (timeScale > 0) {
+                    mDuration = duration * 1000 / timeScale;
+                }
+            }
+
+            offset = contentEnd;
+        }
+
+        return true;
+    }
+
+    QFile mFile;
+
+    QByteArray mBuffer;
+
+    QByteArray mPacket;
+
+    qint64 mFileSize = 0;
+
+    qint64 mBytesRead = 0;
+
+    QString mTitle;
+
+    QString mArtist;
+
+    QString mAlbum;
+
+    QString mAlbumArtist;
+
+    int mTrackNumber = 0;
+
+    int mDiscNumber = 0;
+
+    qint64 mDuration = 0;
+
+    qint64 mSampleRate = 0;
+
+    qint64 mPreSkip = 0;
+
+    bool mWantCover = false;
+
+    QByteArray mCoverData;
+
+    bool mIsFrontCover = false;
+
+    const int mInitialBufferSize = 64 * 1024;
+
+    const qint64 mMaximumPictureSize = 16 * 1024 * 1024;
+
+    const qint64 mMaximumBlockSize = 1024 * 1024;
+
+    const qint64 mMaximumTextSize = 64 * 1024;
+
+    const qint64 mMpegSearchSize = 16 * 1024;
+
+    const qint64 mOggTailSize = 64 * 1024;
+
+    const int mMaximumAtomDepth = 8;
+
+};
+
+AudioTagReader::AudioTagReader() : d(std::make_unique<AudioTagReaderPrivate>())
+{
+}
+
+AudioTagReader::~AudioTagReader()
+= default;
+
+bool AudioTagReader::readTrack(const QString &fileName, MusicAudioTrack &track)
+{
+    d->mWantCover = false;
+
+    const auto result = d->readFile(fileName);
+
+    if (!result || d->mTitle.isEmpty() || d->mAlbum.isEmpty() || d->mDuration <= 0 ||
+            (d->mArtist.isEmpty() && d->mAlbumArtist.isEmpty())) {
+        return false;
+    }
+
+    track.setTitle(d->mTitle);
+    track.setArtist(d->mArtist);
+    track.setAlbumName(d->mAlbum);
+    track.setAlbumArtist(d->mAlbumArtist);
+    if (d->mTrackNumber > 0) {
+        track.setTrackNumber(d->mTrackNumber);
+    }
+    track.setDiscNumber(d->mDiscNumber > 0 ? d->mDiscNumber : 1);
+    track.setDuration(QTime::fromMSecsSinceStartOfDay(static_cast<int>(d->mDuration)));
+
+    return true;
+}
+
+qint64 AudioTagReader::bytesRead() const
+{
+    return d->mBytesRead;
+}
+
+bool AudioTagReader::readCover(const QString &fileName, QByteArray &coverData)
+{
+    d->mWantCover = true;
+
+    const auto result = d->readFile(fileName) && !d->mCoverData.isEmpty();
+
+    if (result) {
+        coverData = d->mCoverData;
+    }
+
+    d->mCoverData.clear();
+
+    return result;
+}
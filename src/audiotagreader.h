@@ -0,0 +1,65 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef AUDIOTAGREADER_H
+#define AUDIOTAGREADER_H
+
+#include <QString>
+#include <QByteArray>
+
+#include <memory>
+
+class AudioTagReaderPrivate;
+class MusicAudioTrack;
+
+/**
+ * Reads the tags of FLAC, Ogg Vorbis, Opus, MP3 (ID3v2) and MP4 files by
+ * parsing only the file header and, when needed, a small trailer.
+ *
+ * readTrack returns false when the container is not handled or when one of
+ * the mandatory fields (title, artist, album, duration) is missing; callers
+ * then fall back to the KFileMetaData extractors.
+ *
+ * readCover extracts the embedded picture (APIC, METADATA_BLOCK_PICTURE or
+ * covr), preferring the front cover when several are present.
+ *
+ * bytesRead counts every byte read from disk since construction.
+ */
+class AudioTagReader
+{
+
+public:
+
+    AudioTagReader();
+
+    ~AudioTagReader();
+
+    bool readTrack(const QString &fileName, MusicAudioTrack &track);
+
+    bool readCover(const QString &fileName, QByteArray &coverData);
+
+    qint64 bytesRead() const;
+
+private:
+
+    std::unique_ptr<AudioTagReaderPrivate> d;
+
+};
+
+#endif // AUDIOTAGREADER_H
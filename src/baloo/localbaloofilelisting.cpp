@@ -22,9 +22,12 @@
 #include "musicaudiotrack.h"
 #include "notificationitem.h"
 #include "elisa_settings.h"
+#include "indexingstatistics.h"
 
 #include "baloo/scheduler.h"
 #include "baloo/fileindexer.h"
+#include "baloo/main.h"
+#include "baloo/baloowatcherapplicationadaptor.h"
 
 #include <Baloo/Query>
 #include <Baloo/File>
@@ -41,30 +44,40 @@
 #include <QDBusServiceWatcher>
 
 #include <QThread>
+#include <QThreadPool>
+#include <QRunnable>
 #include <QHash>
 #include <QFileInfo>
 #include <QDir>
 #include <QAtomicInt>
 #include <QScopedPointer>
+#include <QElapsedTimer>
 #include <QDebug>
 #include <QGuiApplication>
 
 #include <algorithm>
 #include <memory>
 
+struct BalooLoadBatch
+{
+
+    QVector<QUrl> mFiles;
+
+    QVector<MusicAudioTrack> mTracks;
+
+};
+
 class LocalBalooFileListingPrivate
 {
 public:
 
-    Baloo::Query mQuery;
-
-    QHash<QString, QVector<MusicAudioTrack>> mAllAlbums;
+    static MusicAudioTrack loadTrack(const QUrl &scanFile);
 
-    QHash<QString, QVector<MusicAudioTrack>> mNewAlbums;
+    void startLoad(BalooLoadBatch &batch, IndexingStatistics &statistics);
 
-    QList<MusicAudioTrack> mNewTracks;
+    Baloo::Query mQuery;
 
-    QHash<QString, QUrl> mAllAlbumCover;
+    QThreadPool mLoadThreadPool;
 
     QAtomicInt mStopRequest = 0;
 
@@ -78,14 +91,59 @@ public:
 
     QScopedPointer<org::kde::baloo::scheduler> mBalooScheduler;
 
+    QScopedPointer<org::kde::baloo::main> mBalooMainInterface;
+
+};
+
+class BalooLoadJob : public QRunnable
+{
+public:
+
+    BalooLoadJob(BalooLoadBatch &batch, IndexingStatistics &statistics, const QAtomicInt &stopRequest)
+        : mBatch(batch), mStatistics(statistics), mStopRequest(stopRequest)
+    {
+    }
+
+    void run() override
+    {
+        QElapsedTimer extractTimer;
+
+        for (int i = 0; i < mBatch.mFiles.size() && mStopRequest == 0; ++i) {
+            extractTimer.start();
+
+            mBatch.mTracks[i] = LocalBalooFileListingPrivate::loadTrack(mBatch.mFiles[i]);
+
+            mStatistics.addDuration(IndexingStatistics::Extract, extractTimer.nsecsElapsed() / 1000);
+        }
+    }
+
+private:
+
+    BalooLoadBatch &mBatch;
+
+    IndexingStatistics &mStatistics;
+
+    const QAtomicInt &mStopRequest;
+
 };
 
+void LocalBalooFileListingPrivate::startLoad(BalooLoadBatch &batch, IndexingStatistics &statistics)
+{
+    batch.mTracks = QVector<MusicAudioTrack>(batch.mFiles.size());
+
+    mLoadThreadPool.start(new BalooLoadJob(batch, statistics, mStopRequest));
+}
+
 LocalBalooFileListing::LocalBalooFileListing(QObject *parent)
     : AbstractFileListing(QStringLiteral("baloo"), parent), d(std::make_unique<LocalBalooFileListingPrivate>())
 {
     d->mQuery.addType(QStringLiteral("Audio"));
     setHandleNewFiles(false);
 
+    // Baloo shares one database handle per process, a single loader overlapping
+    // with the walk of the query results is all the parallelism it allows
+    d->mLoadThreadPool.setMaxThreadCount(1);
+
     auto sessionBus = QDBusConnection::sessionBus();
 
     connect(&d->mServiceWatcher, &QDBusServiceWatcher::serviceRegistered,
@@ -95,6 +153,10 @@ LocalBalooFileListing::LocalBalooFileListing(QObject *parent)
     connect(&d->mServiceWatcher, &QDBusServiceWatcher::serviceUnregistered,
             this, &LocalBalooFileListing::serviceUnregistered);
 
+    new BalooWatcherApplicationAdaptor(this);
+
+    sessionBus.registerObject(QStringLiteral("/org/kde/BalooWatcherApplication"), this, QDBusConnection::ExportAdaptors);
+
     d->mServiceWatcher.setConnection(sessionBus);
     d->mServiceWatcher.addWatchedService(QStringLiteral("org.kde.baloo"));
 
@@ -182,6 +244,15 @@ void LocalBalooFileListing::registerToBaloo()
         return;
     }
 
+    d->mBalooMainInterface.reset(new org::kde::baloo::main(QStringLiteral("org.kde.baloo"), QStringLiteral("/"),
+                                                           sessionBus, this));
+
+    if (d->mBalooMainInterface->isValid()) {
+        d->mBalooMainInterface->registerBalooWatcher(sessionBus.baseService() + QStringLiteral("/org/kde/BalooWatcherApplication"));
+    } else {
+        qDebug() << "LocalBalooFileListing::registerToBaloo" << "invalid org.kde.baloo/main interface";
+    }
+
     qDebug() << "LocalBalooFileListing::registerToBaloo" << "call registerMonitor";
     auto answer = d->mBalooIndexer->registerMonitor();
 
@@ -200,6 +271,32 @@ void LocalBalooFileListing::registerToBaloo()
 void LocalBalooFileListing::renamedFiles(const QString &from, const QString &to, const QStringList &listFiles)
 {
     qDebug() << "LocalBalooFileListing::renamedFiles" << from << to << listFiles;
+
+    auto allRenamedFiles = QHash<QUrl, QUrl>();
+
+    renameFile(QUrl::fromLocalFile(from), QUrl::fromLocalFile(to), allRenamedFiles);
+
+    for (const auto &oneFile : listFiles) {
+        auto oldFileName = oneFile;
+        auto newFileName = oneFile;
+
+        if (oneFile.startsWith(to)) {
+            oldFileName = from + oneFile.mid(to.size());
+        } else if (oneFile.startsWith(from)) {
+            newFileName = to + oneFile.mid(from.size());
+        } else {
+            continue;
+        }
+
+        const auto &oldFile = QUrl::fromLocalFile(oldFileName);
+        if (!allRenamedFiles.contains(oldFile)) {
+            allRenamedFiles[oldFile] = QUrl::fromLocalFile(newFileName);
+        }
+    }
+
+    if (!allRenamedFiles.isEmpty()) {
+        Q_EMIT renamedTracksList(allRenamedFiles);
+    }
 }
 
 void LocalBalooFileListing::serviceOwnerChanged(const QString &serviceName, const QString &oldOwner, const QString &newOwner)
@@ -249,30 +346,83 @@ void LocalBalooFileListing::triggerRefreshOfContent()
 
     auto resultIterator = d->mQuery.exec();
     auto newFiles = QList<MusicAudioTrack>();
+    auto pendingFiles = QVector<QUrl>();
+    auto loadingBatch = std::make_unique<BalooLoadBatch>();
+    auto loadedBatch = std::make_unique<BalooLoadBatch>();
+    auto hasMoreResults = true;
+    QElapsedTimer walkTimer;
+    walkTimer.start();
+
+    auto addLoadedFiles = [this, &newFiles](const BalooLoadBatch &batch) {
+        for (int i = 0; i < batch.mFiles.size() && d->mStopRequest == 0; ++i) {
+            const auto &newFileUrl = batch.mFiles[i];
+            const auto &fileName = newFileUrl.toLocalFile();
+            auto scanFileInfo = QFileInfo(fileName);
+
+            addFileInDirectory(newFileUrl, QUrl::fromLocalFile(scanFileInfo.absoluteDir().absolutePath()));
+
+            if (scanFileInfo.exists()) {
+                watchPath(fileName);
+            }
+
+            auto newTrack = batch.mTracks[i];
 
-    while(resultIterator.next() && d->mStopRequest == 0) {
-        const auto &newFileUrl = QUrl::fromLocalFile(resultIterator.filePath());
-        auto scanFileInfo = QFileInfo(resultIterator.filePath());
-        const auto currentDirectory = QUrl::fromLocalFile(scanFileInfo.absoluteDir().absolutePath());
+            if (newTrack.isValid()) {
+                statistics().addFiles(1, 0);
+            } else {
+                newTrack = AbstractFileListing::scanOneFile(newFileUrl);
+            }
 
-        addFileInDirectory(newFileUrl, currentDirectory);
+            if (!newTrack.isValid()) {
+                continue;
+            }
 
-        const auto &newTrack = scanOneFile(newFileUrl);
+            addCover(newTrack);
 
-        if (newTrack.isValid()) {
             newFiles.push_back(newTrack);
             increaseImportedTracksCount();
             if (newFiles.size() % 50 == 0) {
                 Q_EMIT importedTracksCountChanged();
             }
-            if (newFiles.size() > 500 && d->mStopRequest == 0) {
+            if (newFiles.size() >= batchSize() && d->mStopRequest == 0) {
                 Q_EMIT importedTracksCountChanged();
                 emitNewFiles(newFiles);
                 newFiles.clear();
             }
         }
+    };
+
+    while (hasMoreResults && d->mStopRequest == 0) {
+        hasMoreResults = resultIterator.next();
+
+        if (hasMoreResults) {
+            pendingFiles.push_back(QUrl::fromLocalFile(resultIterator.filePath()));
+        }
+
+        if (pendingFiles.isEmpty() || (hasMoreResults && pendingFiles.size() < batchSize())) {
+            continue;
+        }
+
+        statistics().addDuration(IndexingStatistics::Walk, walkTimer.nsecsElapsed() / 1000);
+
+        // the next batch is loaded while the previous one is added and the query is walked further
+        d->mLoadThreadPool.waitForDone();
+
+        std::swap(loadingBatch, loadedBatch);
+        loadingBatch->mFiles = std::move(pendingFiles);
+        pendingFiles.clear();
+        d->startLoad(*loadingBatch, statistics());
+
+        addLoadedFiles(*loadedBatch);
+        loadedBatch->mFiles.clear();
+
+        walkTimer.restart();
     }
 
+    d->mLoadThreadPool.waitForDone();
+
+    addLoadedFiles(*loadingBatch);
+
     if (!newFiles.isEmpty() && d->mStopRequest == 0) {
         Q_EMIT importedTracksCountChanged();
         emitNewFiles(newFiles);
@@ -281,16 +431,11 @@ void LocalBalooFileListing::triggerRefreshOfContent()
     Q_EMIT indexingFinished();
 }
 
-MusicAudioTrack LocalBalooFileListing::scanOneFile(const QUrl &scanFile)
+MusicAudioTrack LocalBalooFileListingPrivate::loadTrack(const QUrl &scanFile)
 {
     auto newTrack = MusicAudioTrack();
 
     auto fileName = scanFile.toLocalFile();
-    auto scanFileInfo = QFileInfo(fileName);
-
-    if (scanFileInfo.exists()) {
-        watchPath(fileName);
-    }
 
     Baloo::File match(fileName);
     match.load();
@@ -307,10 +452,7 @@ MusicAudioTrack LocalBalooFileListing::scanOneFile(const QUrl &scanFile)
     auto fileData = KFileMetaData::UserMetaData(fileName);
 
     if (albumProperty != allProperties.end()) {
-        auto albumValue = albumProperty->toString();
-        auto &allTracks = d->mAllAlbums[albumValue];
-
-        newTrack.setAlbumName(albumValue);
+        newTrack.setAlbumName(albumProperty->toString());
 
         if (artistProperty != allProperties.end()) {
             newTrack.setArtist(artistProperty->toString());
@@ -350,23 +492,6 @@ MusicAudioTrack LocalBalooFileListing::scanOneFile(const QUrl &scanFile)
 
         newTrack.setResourceURI(scanFile);
 
-        QFileInfo coverFilePath(scanFileInfo.dir().filePath(QStringLiteral("cover.jpg")));
-        if (coverFilePath.exists()) {
-            d->mAllAlbumCover[albumValue] = QUrl::fromLocalFile(coverFilePath.absoluteFilePath());
-        }
-
-        auto itTrack = std::find(allTracks.begin(), allTracks.end(), newTrack);
-        if (itTrack == allTracks.end()) {
-            allTracks.push_back(newTrack);
-            d->mNewTracks.push_back(newTrack);
-            d->mNewAlbums[newTrack.albumName()].push_back(newTrack);
-
-            auto &newTracks = d->mAllAlbums[newTrack.albumName()];
-
-            std::sort(allTracks.begin(), allTracks.end());
-            std::sort(newTracks.begin(), newTracks.end());
-        }
-
         if (newTrack.title().isEmpty()) {
             return newTrack;
         }
@@ -386,6 +511,20 @@ MusicAudioTrack LocalBalooFileListing::scanOneFile(const QUrl &scanFile)
         newTrack.setValid(true);
     }
 
+    return newTrack;
+}
+
+MusicAudioTrack LocalBalooFileListing::scanOneFile(const QUrl &scanFile)
+{
+    auto fileName = scanFile.toLocalFile();
+    auto scanFileInfo = QFileInfo(fileName);
+
+    if (scanFileInfo.exists()) {
+        watchPath(fileName);
+    }
+
+    auto newTrack = LocalBalooFileListingPrivate::loadTrack(scanFile);
+
     if (!newTrack.isValid()) {
         newTrack = AbstractFileListing::scanOneFile(scanFile);
     }
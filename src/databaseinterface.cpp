@@ -19,6 +19,8 @@
 
 #include "databaseinterface.h"
 
+#include "stringpool.h"
+
 #include <KI18n/KLocalizedString>
 
 #include <QSqlDatabase>
@@ -30,6 +32,8 @@
 #include <QMutex>
 #include <QVariant>
 #include <QAtomicInt>
+#include <QStringList>
+#include <QPair>
 #include <QDebug>
 
 #include <algorithm>
@@ -58,12 +62,15 @@ public:
           mSelectTracksMapping(mTracksDatabase), mSelectTracksMappingPriority(mTracksDatabase),
           mUpdateAlbumArtUriFromAlbumIdQuery(mTracksDatabase), mSelectTracksMappingPriorityByTrackId(mTracksDatabase),
           mSelectAllTrackFilesFromSourceQuery(mTracksDatabase), mFindInvalidTrackFilesQuery(mTracksDatabase),
-          mSelectAlbumIdsFromArtist(mTracksDatabase), mRemoveTracksMappingFromSource(mTracksDatabase),
+          mSelectAlbumIdsFromArtist(mTracksDatabase), mSelectAlbumIdsWithArtist(mTracksDatabase),
+          mRemoveTracksMappingFromSource(mTracksDatabase),
           mRemoveTracksMapping(mTracksDatabase), mSelectTracksWithoutMappingQuery(mTracksDatabase),
           mSelectAlbumIdFromTitleAndArtistQuery(mTracksDatabase), mSelectAlbumIdFromTitleWithoutArtistQuery(mTracksDatabase),
           mInsertAlbumArtistQuery(mTracksDatabase), mInsertTrackArtistQuery(mTracksDatabase),
           mRemoveTrackArtistQuery(mTracksDatabase), mRemoveAlbumArtistQuery(mTracksDatabase),
-          mSelectTrackIdFromTitleAlbumTrackDiscNumberQuery(mTracksDatabase)
+          mSelectTrackIdFromTitleAlbumTrackDiscNumberQuery(mTracksDatabase), mRenameTracksMapping(mTracksDatabase),
+          mRenameAlbumArtUriQuery(mTracksDatabase), mInsertExtractionFailureQuery(mTracksDatabase),
+          mSelectExtractionFailuresQuery(mTracksDatabase)
     {
     }
 
@@ -145,6 +152,8 @@ public:
 
     QSqlQuery mSelectAlbumIdsFromArtist;
 
+    QSqlQuery mSelectAlbumIdsWithArtist;
+
     QSqlQuery mRemoveTracksMappingFromSource;
 
     QSqlQuery mRemoveTracksMapping;
@@ -165,6 +174,14 @@ public:
 
     QSqlQuery mSelectTrackIdFromTitleAlbumTrackDiscNumberQuery;
 
+    QSqlQuery mRenameTracksMapping;
+
+    QSqlQuery mRenameAlbumArtUriQuery;
+
+    QSqlQuery mInsertExtractionFailureQuery;
+
+    QSqlQuery mSelectExtractionFailuresQuery;
+
     qulonglong mAlbumId = 1;
 
     qulonglong mArtistId = 1;
@@ -177,6 +194,16 @@ public:
 
     QAtomicInt mStopRequest = 0;
 
+    QList<MusicArtist> mAddedArtists;
+
+    QList<MusicArtist> mRemovedArtists;
+
+    QList<MusicAlbum> mAddedAlbums;
+
+    QList<MusicAlbum> mModifiedAlbums;
+
+    QList<MusicAlbum> mRemovedAlbums;
+
 };
 
 DatabaseInterface::DatabaseInterface(QObject *parent) : QObject(parent), d(nullptr)
@@ -523,6 +550,38 @@ QList<MusicAudioTrack> DatabaseInterface::tracksFromAuthor(const QString &artist
     return allTracks;
 }
 
+QList<MusicAlbum> DatabaseInterface::albumsFromAuthor(const QString &artistName)
+{
+    auto allAlbums = QList<MusicAlbum>();
+
+    if (!d) {
+        return allAlbums;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return allAlbums;
+    }
+
+    const auto &allAlbumIds = internalAlbumIdsWithArtist(artistName);
+    allAlbums.reserve(allAlbumIds.size());
+
+    for (auto oneAlbumId : allAlbumIds) {
+        auto oneAlbum = internalAlbumFromId(oneAlbumId);
+
+        if (oneAlbum.isValid()) {
+            allAlbums.push_back(oneAlbum);
+        }
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return allAlbums;
+    }
+
+    return allAlbums;
+}
+
 MusicArtist DatabaseInterface::internalArtistFromId(qulonglong artistId)
 {
     auto result = MusicArtist();
@@ -607,6 +666,32 @@ MusicAudioTrack DatabaseInterface::trackFromDatabaseId(qulonglong id)
     return result;
 }
 
+QList<MusicAudioTrack> DatabaseInterface::tracksFromDatabaseIds(const QList<qulonglong> &ids)
+{
+    auto result = QList<MusicAudioTrack>();
+
+    if (!d || ids.isEmpty()) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    result.reserve(ids.size());
+    for (auto oneId : ids) {
+        result.push_back(internalTrackFromDatabaseId(oneId));
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
 qulonglong DatabaseInterface::trackIdFromTitleAlbumTrackDiscNumber(const QString &title, const QString &artist, const QString &album,
                                                                    int trackNumber, int discNumber)
 {
@@ -631,6 +716,40 @@ qulonglong DatabaseInterface::trackIdFromTitleAlbumTrackDiscNumber(const QString
     return result;
 }
 
+QList<MusicAudioTrack> DatabaseInterface::tracksFromTitleAlbumTrackDiscNumbers(const QList<MusicAudioTrack> &tracks)
+{
+    auto result = QList<MusicAudioTrack>();
+
+    if (!d || tracks.isEmpty()) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    result.reserve(tracks.size());
+    for (const auto &oneTrack : tracks) {
+        const auto trackId = internalTrackIdFromTitleAlbumTracDiscNumber(oneTrack.title(), oneTrack.artist(), oneTrack.albumName(),
+                                                                         oneTrack.trackNumber(), oneTrack.discNumber());
+
+        if (trackId == 0) {
+            result.push_back({});
+            continue;
+        }
+
+        result.push_back(internalTrackFromDatabaseId(trackId));
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
 qulonglong DatabaseInterface::trackIdFromFileName(const QUrl &fileName)
 {
     auto result = qulonglong(0);
@@ -654,6 +773,121 @@ qulonglong DatabaseInterface::trackIdFromFileName(const QUrl &fileName)
     return result;
 }
 
+QHash<QUrl, MusicAudioTrack> DatabaseInterface::tracksFromFileNames(const QList<QUrl> &fileNames)
+{
+    auto result = QHash<QUrl, MusicAudioTrack>();
+
+    if (!d || fileNames.isEmpty()) {
+        return result;
+    }
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    // SQLite limits the number of bound parameters of one statement
+    const auto chunkSize = 500;
+
+    auto allTrackIds = QList<QPair<QUrl, qulonglong>>();
+
+    for (int first = 0; first < fileNames.size(); first += chunkSize) {
+        const auto currentChunkSize = std::min(chunkSize, fileNames.size() - first);
+
+        auto placeholders = QStringList();
+        placeholders.reserve(currentChunkSize);
+        for (int i = 0; i < currentChunkSize; ++i) {
+            placeholders.push_back(QStringLiteral("?"));
+        }
+
+        QSqlQuery selectTracksMappingQuery(d->mTracksDatabase);
+        selectTracksMappingQuery.prepare(QStringLiteral("SELECT "
+                                                        "`TrackID`, "
+                                                        "`FileName` "
+                                                        "FROM "
+                                                        "`TracksMapping` "
+                                                        "WHERE "
+                                                        "`TrackID` IS NOT NULL AND "
+                                                        "`FileName` IN (%1)").arg(placeholders.join(QStringLiteral(", "))));
+
+        for (int i = first; i < first + currentChunkSize; ++i) {
+            selectTracksMappingQuery.addBindValue(fileNames[i]);
+        }
+
+        auto queryResult = selectTracksMappingQuery.exec();
+
+        if (!queryResult || !selectTracksMappingQuery.isSelect() || !selectTracksMappingQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qDebug() << "DatabaseInterface::tracksFromFileNames" << selectTracksMappingQuery.lastQuery();
+            qDebug() << "DatabaseInterface::tracksFromFileNames" << selectTracksMappingQuery.lastError();
+
+            continue;
+        }
+
+        while (selectTracksMappingQuery.next()) {
+            const auto &currentRecord = selectTracksMappingQuery.record();
+
+            allTrackIds.push_back({currentRecord.value(1).toUrl(), currentRecord.value(0).toULongLong()});
+        }
+    }
+
+    for (const auto &oneTrackId : allTrackIds) {
+        const auto &oneTrack = internalTrackFromDatabaseId(oneTrackId.second);
+
+        if (oneTrack.isValid()) {
+            result[oneTrackId.first] = oneTrack;
+        }
+    }
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
+QHash<QUrl, QDateTime> DatabaseInterface::extractionFailures()
+{
+    auto result = QHash<QUrl, QDateTime>();
+
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    auto queryResult = d->mSelectExtractionFailuresQuery.exec();
+
+    if (!queryResult || !d->mSelectExtractionFailuresQuery.isSelect() || !d->mSelectExtractionFailuresQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qDebug() << "DatabaseInterface::extractionFailures" << d->mSelectExtractionFailuresQuery.lastQuery();
+        qDebug() << "DatabaseInterface::extractionFailures" << d->mSelectExtractionFailuresQuery.lastError();
+
+        d->mSelectExtractionFailuresQuery.finish();
+
+        finishTransaction();
+
+        return result;
+    }
+
+    while (d->mSelectExtractionFailuresQuery.next()) {
+        const auto &currentRecord = d->mSelectExtractionFailuresQuery.record();
+
+        result[currentRecord.value(0).toUrl()] = currentRecord.value(1).toDateTime();
+    }
+
+    d->mSelectExtractionFailuresQuery.finish();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return result;
+    }
+
+    return result;
+}
+
 void DatabaseInterface::applicationAboutToQuit()
 {
     d->mStopRequest = 1;
@@ -788,7 +1022,7 @@ void DatabaseInterface::cleanInvalidTracks()
     }
 }
 
-void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers, const QString &musicSource)
+void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, const QString &musicSource)
 {
     if (d->mStopRequest == 1) {
         return;
@@ -830,7 +1064,7 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
 
         d->mSelectTracksMapping.finish();
 
-        const auto insertedTrackId = internalInsertTrack(oneTrack, covers, 0, modifiedAlbumIds,
+        const auto insertedTrackId = internalInsertTrack(oneTrack, 0, modifiedAlbumIds,
                                                          (isNewTrack ? TrackFileInsertType::NewTrackFileInsert : TrackFileInsertType::ModifiedTrackFileInsert));
 
         if (isNewTrack && insertedTrackId != 0) {
@@ -838,6 +1072,8 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
         }
 
         if (d->mStopRequest == 1) {
+            emitPendingLibraryChanges();
+
             transactionResult = finishTransaction();
             if (!transactionResult) {
                 return;
@@ -848,9 +1084,11 @@ void DatabaseInterface::insertTracksList(const QList<MusicAudioTrack> &tracks, c
 
     const auto &constModifiedAlbumIds = modifiedAlbumIds;
     for (auto albumId : constModifiedAlbumIds) {
-        Q_EMIT albumModified(internalAlbumFromId(albumId), albumId);
+        d->mModifiedAlbums.push_back(internalAlbumFromId(albumId));
     }
 
+    emitPendingLibraryChanges();
+
     QList<MusicAudioTrack> newTracks;
     for (auto trackId : qAsConst(insertedTracks)) {
         newTracks.push_back(internalTrackFromDatabaseId(trackId));
@@ -881,8 +1119,130 @@ void DatabaseInterface::removeTracksList(const QList<QUrl> &removedTracks)
     }
 }
 
-void DatabaseInterface::modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QHash<QString, QUrl> &covers,
-                                         const QString &musicSource)
+void DatabaseInterface::renameTracksList(const QHash<QUrl, QUrl> &renamedFiles)
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    auto renamedTrackIds = QList<qulonglong>();
+
+    for (auto itFile = renamedFiles.begin(); itFile != renamedFiles.end(); ++itFile) {
+        const auto trackId = internalTrackIdFromFileName(itFile.key());
+
+        d->mRenameTracksMapping.bindValue(QStringLiteral(":oldFileName"), itFile.key());
+        d->mRenameTracksMapping.bindValue(QStringLiteral(":newFileName"), itFile.value());
+
+        auto queryResult = d->mRenameTracksMapping.exec();
+
+        if (!queryResult || !d->mRenameTracksMapping.isActive()) {
+            Q_EMIT databaseError();
+
+            qDebug() << "DatabaseInterface::renameTracksList" << d->mRenameTracksMapping.lastQuery();
+            qDebug() << "DatabaseInterface::renameTracksList" << d->mRenameTracksMapping.boundValues();
+            qDebug() << "DatabaseInterface::renameTracksList" << d->mRenameTracksMapping.lastError();
+
+            d->mRenameTracksMapping.finish();
+
+            continue;
+        }
+
+        d->mRenameTracksMapping.finish();
+
+        if (trackId != 0) {
+            renamedTrackIds.push_back(trackId);
+            continue;
+        }
+
+        d->mRenameAlbumArtUriQuery.bindValue(QStringLiteral(":oldFileName"), itFile.key());
+        d->mRenameAlbumArtUriQuery.bindValue(QStringLiteral(":newFileName"), itFile.value());
+
+        queryResult = d->mRenameAlbumArtUriQuery.exec();
+
+        if (!queryResult || !d->mRenameAlbumArtUriQuery.isActive()) {
+            Q_EMIT databaseError();
+
+            qDebug() << "DatabaseInterface::renameTracksList" << d->mRenameAlbumArtUriQuery.lastQuery();
+            qDebug() << "DatabaseInterface::renameTracksList" << d->mRenameAlbumArtUriQuery.boundValues();
+            qDebug() << "DatabaseInterface::renameTracksList" << d->mRenameAlbumArtUriQuery.lastError();
+        }
+
+        d->mRenameAlbumArtUriQuery.finish();
+    }
+
+    QSet<qulonglong> modifiedAlbumIds;
+
+    for (auto trackId : renamedTrackIds) {
+        const auto &renamedTrack = internalTrackFromDatabaseId(trackId);
+
+        Q_EMIT trackModified(renamedTrack);
+
+        modifiedAlbumIds.insert(internalAlbumIdFromTitleAndArtist(renamedTrack.albumName(), renamedTrack.albumArtist()));
+    }
+
+    const auto &constModifiedAlbumIds = modifiedAlbumIds;
+    for (auto albumId : constModifiedAlbumIds) {
+        if (albumId != 0) {
+            d->mModifiedAlbums.push_back(internalAlbumFromId(albumId));
+        }
+    }
+
+    emitPendingLibraryChanges();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+}
+
+void DatabaseInterface::insertExtractionFailure(const QUrl &fileName, const QDateTime &fileModifiedTime)
+{
+    auto transactionResult = startTransaction();
+    if (!transactionResult) {
+        return;
+    }
+
+    d->mInsertExtractionFailureQuery.bindValue(QStringLiteral(":fileName"), fileName);
+    d->mInsertExtractionFailureQuery.bindValue(QStringLiteral(":fileModifiedTime"), fileModifiedTime);
+
+    auto queryResult = d->mInsertExtractionFailureQuery.exec();
+
+    if (!queryResult || !d->mInsertExtractionFailureQuery.isActive()) {
+        Q_EMIT databaseError();
+
+        qDebug() << "DatabaseInterface::insertExtractionFailure" << d->mInsertExtractionFailureQuery.lastQuery();
+        qDebug() << "DatabaseInterface::insertExtractionFailure" << d->mInsertExtractionFailureQuery.boundValues();
+        qDebug() << "DatabaseInterface::insertExtractionFailure" << d->mInsertExtractionFailureQuery.lastError();
+    }
+
+    d->mInsertExtractionFailureQuery.finish();
+
+    transactionResult = finishTransaction();
+    if (!transactionResult) {
+        return;
+    }
+}
+
+void DatabaseInterface::askExtractionFailures()
+{
+    if (!d) {
+        return;
+    }
+
+    Q_EMIT extractionFailuresList(extractionFailures());
+}
+
+void DatabaseInterface::fetchAlbumsFromArtist(const QString &artistName)
+{
+    if (!d) {
+        return;
+    }
+
+    Q_EMIT albumsFromArtistFetched(artistName, albumsFromAuthor(artistName));
+}
+
+void DatabaseInterface::modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QString &musicSource)
 {
     auto transactionResult = startTransaction();
     if (!transactionResult) {
@@ -910,16 +1270,18 @@ void DatabaseInterface::modifyTracksList(const QList<MusicAudioTrack> &modifiedT
             updateTrackOrigin(originTrackId, oneModifiedTrack.resourceURI());
         }
 
-        internalInsertTrack(oneModifiedTrack, covers, (modifyExistingTrack ? originTrackId : 0),
+        internalInsertTrack(oneModifiedTrack, (modifyExistingTrack ? originTrackId : 0),
                             modifiedAlbumIds,
                             (modifyExistingTrack ? TrackFileInsertType::ModifiedTrackFileInsert : TrackFileInsertType::NewTrackFileInsert));
     }
 
     const auto &constModifiedAlbumIds = modifiedAlbumIds;
     for (auto albumId : constModifiedAlbumIds) {
-        Q_EMIT albumModified(internalAlbumFromId(albumId), albumId);
+        d->mModifiedAlbums.push_back(internalAlbumFromId(albumId));
     }
 
+    emitPendingLibraryChanges();
+
     transactionResult = finishTransaction();
     if (!transactionResult) {
         return;
@@ -1130,6 +1492,20 @@ void DatabaseInterface::initDatabase() const
         }
     }
 
+    if (!listTables.contains(QStringLiteral("ExtractionFailures"))) {
+        QSqlQuery createSchemaQuery(d->mTracksDatabase);
+
+        const auto &result = createSchemaQuery.exec(QStringLiteral("CREATE TABLE `ExtractionFailures` ("
+                                                                   "`FileName` VARCHAR(255) NOT NULL, "
+                                                                   "`FileModifiedTime` DATETIME NOT NULL, "
+                                                                   "PRIMARY KEY (`FileName`))"));
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initDatabase" << createSchemaQuery.lastQuery();
+            qDebug() << "DatabaseInterface::initDatabase" << createSchemaQuery.lastError();
+        }
+    }
+
     {
         QSqlQuery createTrackIndex(d->mTracksDatabase);
 
@@ -1671,6 +2047,57 @@ void DatabaseInterface::initRequest()
         }
     }
 
+    {
+        auto renameTracksMappingQueryText = QStringLiteral("UPDATE `TracksMapping` "
+                                                           "SET `FileName` = :newFileName "
+                                                           "WHERE `FileName` = :oldFileName");
+
+        auto result = d->mRenameTracksMapping.prepare(renameTracksMappingQueryText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mRenameTracksMapping.lastQuery();
+            qDebug() << "DatabaseInterface::initRequest" << d->mRenameTracksMapping.lastError();
+        }
+    }
+
+    {
+        auto renameAlbumArtUriQueryText = QStringLiteral("UPDATE `Albums` "
+                                                         "SET `CoverFileName` = :newFileName "
+                                                         "WHERE `CoverFileName` = :oldFileName");
+
+        auto result = d->mRenameAlbumArtUriQuery.prepare(renameAlbumArtUriQueryText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mRenameAlbumArtUriQuery.lastQuery();
+            qDebug() << "DatabaseInterface::initRequest" << d->mRenameAlbumArtUriQuery.lastError();
+        }
+    }
+
+    {
+        auto insertExtractionFailureQueryText = QStringLiteral("INSERT OR REPLACE INTO `ExtractionFailures` "
+                                                               "(`FileName`, `FileModifiedTime`) "
+                                                               "VALUES (:fileName, :fileModifiedTime)");
+
+        auto result = d->mInsertExtractionFailureQuery.prepare(insertExtractionFailureQueryText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mInsertExtractionFailureQuery.lastQuery();
+            qDebug() << "DatabaseInterface::initRequest" << d->mInsertExtractionFailureQuery.lastError();
+        }
+    }
+
+    {
+        auto selectExtractionFailuresQueryText = QStringLiteral("SELECT `FileName`, `FileModifiedTime` "
+                                                                "FROM `ExtractionFailures`");
+
+        auto result = d->mSelectExtractionFailuresQuery.prepare(selectExtractionFailuresQueryText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectExtractionFailuresQuery.lastQuery();
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectExtractionFailuresQuery.lastError();
+        }
+    }
+
     {
         auto selectTracksWithoutMappingQueryText = QStringLiteral("SELECT "
                                                                   "tracks.`Id`, "
@@ -2023,6 +2450,35 @@ void DatabaseInterface::initRequest()
         }
     }
 
+    {
+        auto selectAlbumIdsWithArtistQueryText = QStringLiteral("SELECT "
+                                                                "albumArtist.`AlbumID` "
+                                                                "FROM "
+                                                                "`Artists` artist, "
+                                                                "`AlbumsArtists` albumArtist "
+                                                                "WHERE "
+                                                                "artist.`ID` = albumArtist.`ArtistID` AND "
+                                                                "artist.`Name` = :artistName "
+                                                                "UNION "
+                                                                "SELECT "
+                                                                "tracks.`AlbumID` "
+                                                                "FROM "
+                                                                "`Tracks` tracks, "
+                                                                "`Artists` artist, "
+                                                                "`TracksArtists` trackArtist "
+                                                                "WHERE "
+                                                                "tracks.`ID` = trackArtist.`TrackID` AND "
+                                                                "artist.`ID` = trackArtist.`ArtistID` AND "
+                                                                "artist.`Name` = :trackArtistName");
+
+        auto result = d->mSelectAlbumIdsWithArtist.prepare(selectAlbumIdsWithArtistQueryText);
+
+        if (!result) {
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectAlbumIdsWithArtist.lastQuery();
+            qDebug() << "DatabaseInterface::initRequest" << d->mSelectAlbumIdsWithArtist.lastError();
+        }
+    }
+
     {
         auto selectArtistQueryText = QStringLiteral("SELECT `ID`, "
                                                     "`Name` "
@@ -2261,7 +2717,9 @@ qulonglong DatabaseInterface::insertAlbum(const QString &title, const QString &a
 
     ++d->mAlbumId;
 
-    Q_EMIT albumAdded(internalAlbumFromId(d->mAlbumId - 1));
+    const auto &newAlbum = internalAlbumFromId(d->mAlbumId - 1);
+
+    d->mAddedAlbums.push_back(newAlbum);
 
     return result;
 }
@@ -2419,7 +2877,9 @@ qulonglong DatabaseInterface::insertArtist(const QString &name)
 
     d->mInsertArtistsQuery.finish();
 
-    Q_EMIT artistAdded(internalArtistFromId(d->mArtistId - 1));
+    const auto &newArtist = internalArtistFromId(d->mArtistId - 1);
+
+    d->mAddedArtists.push_back(newArtist);
 
     return result;
 }
@@ -2530,8 +2990,7 @@ int DatabaseInterface::computeTrackPriority(qulonglong trackId, const QUrl &file
     return result;
 }
 
-qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrack, const QHash<QString, QUrl> &covers,
-                                                  int originTrackId, QSet<qulonglong> &modifiedAlbumIds, TrackFileInsertType insertType)
+qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrack, int originTrackId, QSet<qulonglong> &modifiedAlbumIds, TrackFileInsertType insertType)
 {
     qulonglong resultId = 0;
 
@@ -2540,7 +2999,7 @@ qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrac
     }
 
     auto albumId = insertAlbum(oneTrack.albumName(), (oneTrack.isValidAlbumArtist() ? oneTrack.albumArtist() : QString()),
-                               oneTrack.artist(), covers[oneTrack.resourceURI().toString()], 0, true);
+                               oneTrack.artist(), oneTrack.albumCover(), 0, true);
 
     if (albumId == 0) {
         return resultId;
@@ -2632,7 +3091,7 @@ qulonglong DatabaseInterface::internalInsertTrack(const MusicAudioTrack &oneTrac
                 Q_EMIT trackAdded(originTrackId);
             }
 
-            if (updateAlbumFromId(albumId, covers[oneTrack.resourceURI().toString()], oneTrack)) {
+            if (updateAlbumFromId(albumId, albumCover, oneTrack)) {
                 modifiedAlbumIds.insert(albumId);
             }
 
@@ -2754,11 +3213,14 @@ void DatabaseInterface::internalRemoveTracksWithoutMapping()
     d->mSelectTracksWithoutMappingQuery.finish();
 
     QSet<qulonglong> modifiedAlbums;
+    auto removedTracksIds = QList<qulonglong>();
+    removedTracksIds.reserve(willRemoveTrack.size());
 
     for (const auto &oneRemovedTrack : willRemoveTrack) {
         removeTrackInDatabase(oneRemovedTrack.databaseId());
 
         Q_EMIT trackRemoved(oneRemovedTrack.databaseId());
+        removedTracksIds.push_back(oneRemovedTrack.databaseId());
 
         const auto &modifiedAlbumId = internalAlbumIdFromTitleAndArtist(oneRemovedTrack.albumName(), oneRemovedTrack.albumArtist());
         const auto &allTracksFromArtist = internalTracksFromAuthor(oneRemovedTrack.artist());
@@ -2773,18 +3235,22 @@ void DatabaseInterface::internalRemoveTracksWithoutMapping()
 
         if (allTracksFromArtist.isEmpty() && allAlbumsFromArtist.isEmpty()) {
             removeArtistInDatabase(removedArtistId);
-            Q_EMIT artistRemoved(removedArtist);
+            d->mRemovedArtists.push_back(removedArtist);
         }
     }
 
+    if (!removedTracksIds.isEmpty()) {
+        Q_EMIT tracksRemoved(removedTracksIds);
+    }
+
     for (auto modifiedAlbumId : modifiedAlbums) {
         auto modifiedAlbum = internalAlbumFromId(modifiedAlbumId);
 
         if (modifiedAlbum.isValid() && !modifiedAlbum.isEmpty()) {
-            Q_EMIT albumModified(modifiedAlbum, modifiedAlbumId);
+            d->mModifiedAlbums.push_back(modifiedAlbum);
         } else {
             removeAlbumInDatabase(modifiedAlbum.databaseId());
-            Q_EMIT albumRemoved(modifiedAlbum, modifiedAlbumId);
+            d->mRemovedAlbums.push_back(modifiedAlbum);
 
             const auto &allTracksFromArtist = internalTracksFromAuthor(modifiedAlbum.artist());
             const auto &allAlbumsFromArtist = internalAlbumIdsFromAuthor(modifiedAlbum.artist());
@@ -2793,10 +3259,14 @@ void DatabaseInterface::internalRemoveTracksWithoutMapping()
 
             if (allTracksFromArtist.isEmpty() && allAlbumsFromArtist.isEmpty()) {
                 removeArtistInDatabase(removedArtistId);
-                Q_EMIT artistRemoved(removedArtist);
+                d->mRemovedArtists.push_back(removedArtist);
             }
         }
     }
+
+    emitPendingLibraryChanges();
+
+    StringPool::purge();
 }
 
 qulonglong DatabaseInterface::internalArtistIdFromName(const QString &name)
@@ -2836,6 +3306,34 @@ qulonglong DatabaseInterface::internalArtistIdFromName(const QString &name)
     return result;
 }
 
+void DatabaseInterface::emitPendingLibraryChanges()
+{
+    if (!d->mAddedArtists.isEmpty()) {
+        Q_EMIT artistsAdded(d->mAddedArtists);
+        d->mAddedArtists.clear();
+    }
+
+    if (!d->mAddedAlbums.isEmpty()) {
+        Q_EMIT albumsAdded(d->mAddedAlbums);
+        d->mAddedAlbums.clear();
+    }
+
+    if (!d->mModifiedAlbums.isEmpty()) {
+        Q_EMIT albumsModified(d->mModifiedAlbums);
+        d->mModifiedAlbums.clear();
+    }
+
+    if (!d->mRemovedAlbums.isEmpty()) {
+        Q_EMIT albumsRemoved(d->mRemovedAlbums);
+        d->mRemovedAlbums.clear();
+    }
+
+    if (!d->mRemovedArtists.isEmpty()) {
+        Q_EMIT artistsRemoved(d->mRemovedArtists);
+        d->mRemovedArtists.clear();
+    }
+}
+
 void DatabaseInterface::removeTrackInDatabase(qulonglong trackId)
 {
     d->mRemoveTrackArtistQuery.bindValue(QStringLiteral(":trackId"), trackId);
@@ -2933,17 +3431,21 @@ void DatabaseInterface::reloadExistingDatabase()
     const auto restoredArtists = allArtists();
     for (const auto &oneArtist : restoredArtists) {
         d->mArtistId = std::max(d->mArtistId, oneArtist.databaseId());
-        Q_EMIT artistAdded(oneArtist);
     }
     ++d->mArtistId;
 
+    d->mAddedArtists.append(restoredArtists);
+
     const auto restoredAlbums = allAlbums();
     for (const auto &oneAlbum : restoredAlbums) {
         d->mAlbumId = std::max(d->mAlbumId, oneAlbum.databaseId());
-        Q_EMIT albumAdded(oneAlbum);
     }
     ++d->mAlbumId;
 
+    d->mAddedAlbums.append(restoredAlbums);
+
+    emitPendingLibraryChanges();
+
     const auto restoredTracks = allTracks();
     Q_EMIT tracksAdded(restoredTracks);
     for (const auto &oneTrack : restoredTracks) {
@@ -3432,5 +3934,35 @@ QList<qulonglong> DatabaseInterface::internalAlbumIdsFromAuthor(const QString &a
     return allAlbumIds;
 }
 
+QList<qulonglong> DatabaseInterface::internalAlbumIdsWithArtist(const QString &artistName)
+{
+    auto allAlbumIds = QList<qulonglong>();
+
+    d->mSelectAlbumIdsWithArtist.bindValue(QStringLiteral(":artistName"), artistName);
+    d->mSelectAlbumIdsWithArtist.bindValue(QStringLiteral(":trackArtistName"), artistName);
+
+    auto result = d->mSelectAlbumIdsWithArtist.exec();
+
+    if (!result || !d->mSelectAlbumIdsWithArtist.isSelect() || !d->mSelectAlbumIdsWithArtist.isActive()) {
+        Q_EMIT databaseError();
+
+        qDebug() << "DatabaseInterface::internalAlbumIdsWithArtist" << d->mSelectAlbumIdsWithArtist.lastQuery();
+        qDebug() << "DatabaseInterface::internalAlbumIdsWithArtist" << d->mSelectAlbumIdsWithArtist.boundValues();
+        qDebug() << "DatabaseInterface::internalAlbumIdsWithArtist" << d->mSelectAlbumIdsWithArtist.lastError();
+
+        return allAlbumIds;
+    }
+
+    while (d->mSelectAlbumIdsWithArtist.next()) {
+        const auto &currentRecord = d->mSelectAlbumIdsWithArtist.record();
+
+        allAlbumIds.push_back(currentRecord.value(0).toULongLong());
+    }
+
+    d->mSelectAlbumIdsWithArtist.finish();
+
+    return allAlbumIds;
+}
+
 
 #include "moc_databaseinterface.cpp"
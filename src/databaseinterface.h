@@ -30,6 +30,7 @@
 #include <QList>
 #include <QVariant>
 #include <QUrl>
+#include <QDateTime>
 
 #include <memory>
 
@@ -71,48 +72,72 @@ public:
 
     QList<MusicAudioTrack> tracksFromAuthor(const QString &artistName);
 
+    QList<MusicAlbum> albumsFromAuthor(const QString &artistName);
+
     MusicAudioTrack trackFromDatabaseId(qulonglong id);
 
+    QList<MusicAudioTrack> tracksFromDatabaseIds(const QList<qulonglong> &ids);
+
     qulonglong trackIdFromTitleAlbumTrackDiscNumber(const QString &title, const QString &artist, const QString &album,
                                                     int trackNumber, int discNumber);
 
+    QList<MusicAudioTrack> tracksFromTitleAlbumTrackDiscNumbers(const QList<MusicAudioTrack> &tracks);
+
     qulonglong trackIdFromFileName(const QUrl &fileName);
 
+    QHash<QUrl, MusicAudioTrack> tracksFromFileNames(const QList<QUrl> &fileNames);
+
+    QHash<QUrl, QDateTime> extractionFailures();
+
     void applicationAboutToQuit();
 
 Q_SIGNALS:
 
-    void artistAdded(const MusicArtist &newArtist);
+    void artistsAdded(const QList<MusicArtist> &newArtists);
 
-    void albumAdded(const MusicAlbum &newAlbum);
+    void albumsAdded(const QList<MusicAlbum> &newAlbums);
 
     void trackAdded(qulonglong id);
 
     void tracksAdded(const QList<MusicAudioTrack> &allTracks);
 
-    void artistRemoved(const MusicArtist &removedArtist);
+    void artistsRemoved(const QList<MusicArtist> &removedArtists);
 
-    void albumRemoved(const MusicAlbum &removedAlbum, qulonglong removedAlbumId);
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
 
     void trackRemoved(qulonglong id);
 
+    void tracksRemoved(const QList<qulonglong> &removedTracksIds);
+
     void artistModified(const MusicArtist &modifiedArtist);
 
-    void albumModified(const MusicAlbum &modifiedAlbum, qulonglong modifiedAlbumId);
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
 
     void trackModified(const MusicAudioTrack &modifiedTrack);
 
+    void extractionFailuresList(const QHash<QUrl, QDateTime> &failedFiles);
+
+    void albumsFromArtistFetched(const QString &artistName, const QList<MusicAlbum> &albums);
+
     void requestsInitDone();
 
     void databaseError();
 
 public Q_SLOTS:
 
-    void insertTracksList(const QList<MusicAudioTrack> &tracks, const QHash<QString, QUrl> &covers, const QString &musicSource);
+    void insertTracksList(const QList<MusicAudioTrack> &tracks, const QString &musicSource);
 
     void removeTracksList(const QList<QUrl> &removedTracks);
 
-    void modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QHash<QString, QUrl> &covers, const QString &musicSource);
+    void renameTracksList(const QHash<QUrl, QUrl> &renamedFiles);
+
+    void modifyTracksList(const QList<MusicAudioTrack> &modifiedTracks, const QString &musicSource);
+
+    void insertExtractionFailure(const QUrl &fileName, const QDateTime &fileModifiedTime);
+
+    void askExtractionFailures();
+
+    void fetchAlbumsFromArtist(const QString &artistName);
 
     void removeAllTracksFromSource(const QString &sourceName);
 
@@ -157,6 +182,8 @@ private:
 
     QList<qulonglong> internalAlbumIdsFromAuthor(const QString &artistName);
 
+    QList<qulonglong> internalAlbumIdsWithArtist(const QString &artistName);
+
     void initDatabase() const;
 
     void initRequest();
@@ -186,8 +213,7 @@ private:
 
     int computeTrackPriority(qulonglong trackId, const QUrl &fileName);
 
-    qulonglong internalInsertTrack(const MusicAudioTrack &oneModifiedTrack, const QHash<QString, QUrl> &covers,
-                                   int originTrackId, QSet<qulonglong> &modifiedAlbumIds, TrackFileInsertType insertType);
+    qulonglong internalInsertTrack(const MusicAudioTrack &oneModifiedTrack, int originTrackId, QSet<qulonglong> &modifiedAlbumIds, TrackFileInsertType insertType);
 
     MusicAudioTrack buildTrackFromDatabaseRecord(const QSqlRecord &trackRecord) const;
 
@@ -197,6 +223,8 @@ private:
 
     void internalRemoveTracksWithoutMapping();
 
+    void emitPendingLibraryChanges();
+
     std::unique_ptr<DatabaseInterfacePrivate> d;
 
 };
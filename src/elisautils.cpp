@@ -19,23 +19,53 @@
 
 #include "elisautils.h"
 
+#include "audiotagreader.h"
+#include "indexingstatistics.h"
+
 #include <KFileMetaData/Properties>
 #include <KFileMetaData/ExtractorCollection>
 #include <KFileMetaData/Extractor>
 #include <KFileMetaData/SimpleExtractionResult>
 #include <KFileMetaData/UserMetaData>
 
-MusicAudioTrack ElisaUtils::scanOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase,
-                                        const KFileMetaData::ExtractorCollection &allExtractors)
+#include <QElapsedTimer>
+
+static void finishScannedTrack(MusicAudioTrack &newTrack, const QUrl &scanFile)
 {
-    MusicAudioTrack newTrack;
+    if (newTrack.artist().isEmpty()) {
+        newTrack.setArtist(newTrack.albumArtist());
+    }
 
-    const auto &fileMimeType = mimeDatabase.mimeTypeForFile(scanFile.toLocalFile());
-    if (!fileMimeType.name().startsWith(QStringLiteral("audio/"))) {
-        return newTrack;
+    newTrack.setResourceURI(scanFile);
+
+#if defined Q_OS_LINUX && !defined Q_OS_ANDROID
+    auto fileData = KFileMetaData::UserMetaData(scanFile.toLocalFile());
+    newTrack.setRating(fileData.rating());
+#endif
+
+    if (newTrack.title().isEmpty()) {
+        return;
+    }
+
+    if (newTrack.artist().isEmpty()) {
+        return;
+    }
+
+    if (newTrack.albumName().isEmpty()) {
+        return;
     }
 
-    QString mimetype = fileMimeType.name();
+    if (!newTrack.duration().isValid()) {
+        return;
+    }
+
+    newTrack.setValid(true);
+}
+
+MusicAudioTrack ElisaUtils::extractOneFile(const QUrl &scanFile, const QString &mimetype,
+                                           const KFileMetaData::ExtractorCollection &allExtractors)
+{
+    MusicAudioTrack newTrack;
 
     QList<KFileMetaData::Extractor*> exList = allExtractors.fetchExtractors(mimetype);
 
@@ -58,9 +88,6 @@ MusicAudioTrack ElisaUtils::scanOneFile(const QUrl &scanFile, const QMimeDatabas
     auto albumArtistProperty = allProperties.find(KFileMetaData::Property::AlbumArtist);
     auto trackNumberProperty = allProperties.find(KFileMetaData::Property::TrackNumber);
     auto discNumberProperty = allProperties.find(KFileMetaData::Property::DiscNumber);
-#if defined Q_OS_LINUX && !defined Q_OS_ANDROID
-    auto fileData = KFileMetaData::UserMetaData(scanFile.toLocalFile());
-#endif
 
     if (albumProperty != allProperties.end()) {
         auto albumValue = albumProperty->toString();
@@ -97,33 +124,75 @@ MusicAudioTrack ElisaUtils::scanOneFile(const QUrl &scanFile, const QMimeDatabas
             }
         }
 
-        if (newTrack.artist().isEmpty()) {
-            newTrack.setArtist(newTrack.albumArtist());
-        }
+        finishScannedTrack(newTrack, scanFile);
+    }
 
-        newTrack.setResourceURI(scanFile);
+    return newTrack;
+}
 
-#if defined Q_OS_LINUX && !defined Q_OS_ANDROID
-        newTrack.setRating(fileData.rating());
-#endif
+MusicAudioTrack ElisaUtils::scanOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase,
+                                        const KFileMetaData::ExtractorCollection &allExtractors)
+{
+    const auto &fileMimeType = mimeDatabase.mimeTypeForFile(scanFile.toLocalFile());
+    if (!fileMimeType.name().startsWith(QStringLiteral("audio/"))) {
+        return {};
+    }
 
-        if (newTrack.title().isEmpty()) {
-            return newTrack;
-        }
+    return extractOneFile(scanFile, fileMimeType.name(), allExtractors);
+}
 
-        if (newTrack.artist().isEmpty()) {
-            return newTrack;
-        }
+bool ElisaUtils::readOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase, AudioTagReader &tagReader,
+                             MusicAudioTrack &track, QString &mimeType, IndexingStatistics *statistics)
+{
+    QElapsedTimer stageTimer;
+    stageTimer.start();
 
-        if (newTrack.albumName().isEmpty()) {
-            return newTrack;
-        }
+    const auto &fileMimeType = mimeDatabase.mimeTypeForFile(scanFile.toLocalFile());
 
-        if (!newTrack.duration().isValid()) {
-            return newTrack;
-        }
+    if (statistics) {
+        statistics->addDuration(IndexingStatistics::Mime, stageTimer.nsecsElapsed() / 1000);
+        stageTimer.restart();
+    }
+
+    track = {};
+
+    if (!fileMimeType.name().startsWith(QStringLiteral("audio/"))) {
+        return true;
+    }
+
+    mimeType = fileMimeType.name();
+
+    if (!tagReader.readTrack(scanFile.toLocalFile(), track)) {
+        return false;
+    }
+
+    finishScannedTrack(track, scanFile);
+
+    if (statistics) {
+        statistics->addDuration(IndexingStatistics::Extract, stageTimer.nsecsElapsed() / 1000);
+    }
+
+    return true;
+}
+
+MusicAudioTrack ElisaUtils::scanOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase,
+                                        const KFileMetaData::ExtractorCollection &allExtractors,
+                                        AudioTagReader &tagReader, IndexingStatistics *statistics)
+{
+    MusicAudioTrack newTrack;
+    QString fileMimeType;
+
+    if (readOneFile(scanFile, mimeDatabase, tagReader, newTrack, fileMimeType, statistics)) {
+        return newTrack;
+    }
+
+    QElapsedTimer extractTimer;
+    extractTimer.start();
+
+    newTrack = extractOneFile(scanFile, fileMimeType, allExtractors);
 
-        newTrack.setValid(true);
+    if (statistics) {
+        statistics->addDuration(IndexingStatistics::Extract, extractTimer.nsecsElapsed() / 1000);
     }
 
     return newTrack;
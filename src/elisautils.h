@@ -25,13 +25,27 @@
 #include <KFileMetaData/ExtractorCollection>
 
 #include <QUrl>
+#include <QString>
 #include <QMimeDatabase>
 
+class AudioTagReader;
+class IndexingStatistics;
+
 namespace ElisaUtils {
 
 MusicAudioTrack scanOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase,
                             const KFileMetaData::ExtractorCollection &allExtractors);
 
+MusicAudioTrack scanOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase,
+                            const KFileMetaData::ExtractorCollection &allExtractors,
+                            AudioTagReader &tagReader, IndexingStatistics *statistics = nullptr);
+
+bool readOneFile(const QUrl &scanFile, const QMimeDatabase &mimeDatabase, AudioTagReader &tagReader,
+                 MusicAudioTrack &track, QString &mimeType, IndexingStatistics *statistics = nullptr);
+
+MusicAudioTrack extractOneFile(const QUrl &scanFile, const QString &mimetype,
+                               const KFileMetaData::ExtractorCollection &allExtractors);
+
 }
 
 #endif // ELISAUTILS_H
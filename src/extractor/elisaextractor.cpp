@@ -0,0 +1,114 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "extractorprotocol.h"
+
+#include "musicaudiotrack.h"
+#include "elisautils.h"
+
+#include <KFileMetaData/ExtractorCollection>
+
+#include <QCoreApplication>
+#include <QMimeDatabase>
+#include <QFile>
+#include <QFileInfo>
+
+#if defined Q_OS_UNIX
+#include <unistd.h>
+#endif
+
+static quint64 readBytesCount()
+{
+#if defined Q_OS_LINUX
+    QFile ioStatistics(QStringLiteral("/proc/self/io"));
+
+    if (ioStatistics.open(QIODevice::ReadOnly)) {
+        const auto &allLines = ioStatistics.readAll().split('\n');
+
+        for (const auto &oneLine : allLines) {
+            if (oneLine.startsWith("rchar:")) {
+                return oneLine.mid(6).trimmed().toULongLong();
+            }
+        }
+    }
+#endif
+
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    int protocolDescriptor = 1;
+
+#if defined Q_OS_UNIX
+    // extractors are free to print on stdout: keep the real one for the
+    // protocol and send everything else to stderr
+    protocolDescriptor = ::dup(STDOUT_FILENO);
+    ::dup2(STDERR_FILENO, STDOUT_FILENO);
+#endif
+
+    QFile input;
+    QFile output;
+
+    if (!input.open(0, QIODevice::ReadOnly | QIODevice::Unbuffered) ||
+            !output.open(protocolDescriptor, QIODevice::WriteOnly | QIODevice::Unbuffered)) {
+        return 1;
+    }
+
+    QMimeDatabase mimeDatabase;
+    KFileMetaData::ExtractorCollection extractors;
+
+    QByteArray buffer;
+
+    while (true) {
+        QByteArray payload;
+
+        while (!ExtractorProtocol::takeFrame(buffer, payload)) {
+            const auto newData = input.read(64 * 1024);
+
+            if (newData.isEmpty()) {
+                return 0;
+            }
+
+            buffer.append(newData);
+        }
+
+        QUrl scanFile;
+        if (!ExtractorProtocol::decodeRequest(payload, scanFile)) {
+            return 1;
+        }
+
+        const auto previousBytesCount = readBytesCount();
+
+        const auto &newTrack = ElisaUtils::scanOneFile(scanFile, mimeDatabase, extractors);
+
+        // without I/O accounting, the whole file is assumed to have been read
+        auto bytesRead = readBytesCount() - previousBytesCount;
+        if (previousBytesCount == 0) {
+            bytesRead = static_cast<quint64>(QFileInfo(scanFile.toLocalFile()).size());
+        }
+
+        const auto &response = ExtractorProtocol::frame(ExtractorProtocol::encodeResponse(newTrack, bytesRead));
+        if (output.write(response) != response.size()) {
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "extractorprotocol.h"
+
+#include "musicaudiotrack.h"
+
+#include <QDataStream>
+#include <QtEndian>
+
+static const quint8 requestVersion = 1;
+
+static const int maximumPayloadSize = 16 * 1024 * 1024;
+
+static const int headerSize = sizeof(quint32);
+
+QByteArray ExtractorProtocol::encodeRequest(const QUrl &scanFile)
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_9);
+
+    stream << requestVersion << scanFile.toLocalFile();
+
+    return payload;
+}
+
+bool ExtractorProtocol::decodeRequest(const QByteArray &payload, QUrl &scanFile)
+{
+    QDataStream stream(payload);
+    stream.setVersion(QDataStream::Qt_5_9);
+
+    quint8 version = 0;
+    QString fileName;
+
+    stream >> version >> fileName;
+
+    if (stream.status() != QDataStream::Ok || version != requestVersion || fileName.isEmpty()) {
+        return false;
+    }
+
+    scanFile = QUrl::fromLocalFile(fileName);
+
+    return true;
+}
+
+QByteArray ExtractorProtocol::encodeResponse(const MusicAudioTrack &track, quint64 bytesRead)
+{
+    QByteArray payload;
+    QDataStream stream(&payload, QIODevice::WriteOnly);
+    stream.setVersion(QDataStream::Qt_5_9);
+
+    stream << bytesRead << track;
+
+    return payload;
+}
+
+bool ExtractorProtocol::decodeResponse(const QByteArray &payload, MusicAudioTrack &track, quint64 &bytesRead)
+{
+    QDataStream stream(payload);
+    stream.setVersion(QDataStream::Qt_5_9);
+
+    stream >> bytesRead >> track;
+
+    return stream.status() == QDataStream::Ok;
+}
+
+QByteArray ExtractorProtocol::frame(const QByteArray &payload)
+{
+    QByteArray result(headerSize, Qt::Uninitialized);
+    qToBigEndian<quint32>(static_cast<quint32>(payload.size()), result.data());
+
+    result.append(payload);
+
+    return result;
+}
+
+bool ExtractorProtocol::takeFrame(QByteArray &buffer, QByteArray &payload)
+{
+    if (buffer.size() < headerSize) {
+        return false;
+    }
+
+    const auto payloadSize = qFromBigEndian<quint32>(buffer.constData());
+
+    if (payloadSize > maximumPayloadSize) {
+        buffer.clear();
+        payload.clear();
+
+        return true;
+    }
+
+    if (buffer.size() < headerSize + static_cast<int>(payloadSize)) {
+        return false;
+    }
+
+    payload = buffer.mid(headerSize, static_cast<int>(payloadSize));
+    buffer.remove(0, headerSize + static_cast<int>(payloadSize));
+
+    return true;
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef EXTRACTORPROTOCOL_H
+#define EXTRACTORPROTOCOL_H
+
+#include <QByteArray>
+#include <QUrl>
+
+class MusicAudioTrack;
+
+/**
+ * Messages exchanged over the pipes of the elisaextractor helper.
+ *
+ * Each message is a frame made of a big endian quint32 payload size followed
+ * by a QDataStream encoded payload: the local file name for a request, the
+ * number of bytes the helper read from the file and the extracted track for a
+ * response. takeFrame reports a frame announcing an
+ * oversized payload as an empty payload, which never decodes.
+ */
+namespace ExtractorProtocol {
+
+QByteArray encodeRequest(const QUrl &scanFile);
+
+bool decodeRequest(const QByteArray &payload, QUrl &scanFile);
+
+QByteArray encodeResponse(const MusicAudioTrack &track, quint64 bytesRead);
+
+bool decodeResponse(const QByteArray &payload, MusicAudioTrack &track, quint64 &bytesRead);
+
+QByteArray frame(const QByteArray &payload);
+
+bool takeFrame(QByteArray &buffer, QByteArray &payload);
+
+}
+
+#endif // EXTRACTORPROTOCOL_H
@@ -57,5 +57,12 @@ void FileListener::setRootPath(const QString &rootPath)
     d->mLocalFileIndexer.setRootPath(rootPath);
 }
 
+void FileListener::setPollingParameters(int pollingInterval, int pollingJitter, bool forcePolling)
+{
+    d->mLocalFileIndexer.setPollingInterval(pollingInterval);
+    d->mLocalFileIndexer.setPollingJitter(pollingJitter);
+    d->mLocalFileIndexer.setForcePolling(forcePolling);
+}
+
 
 #include "moc_filelistener.cpp"
@@ -55,6 +55,8 @@ public Q_SLOTS:
 
     void setRootPath(const QString &rootPath);
 
+    void setPollingParameters(int pollingInterval, int pollingJitter, bool forcePolling);
+
 private:
 
     std::unique_ptr<FileListenerPrivate> d;
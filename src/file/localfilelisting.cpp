@@ -34,19 +34,50 @@
 #include <QFileSystemWatcher>
 #include <QMimeDatabase>
 #include <QStandardPaths>
+#include <QStorageInfo>
+#include <QTimer>
+#include <QAtomicInt>
 
 #include <QDebug>
 
 #include <algorithm>
+#include <random>
 
 class LocalFileListingPrivate
 {
 public:
 
+    static bool isNetworkFileSystem(const QString &path);
+
     QString mRootPath;
 
+    QAtomicInt mPollingInterval = 300000;
+
+    QAtomicInt mPollingJitter = 30000;
+
+    QAtomicInt mForcePolling = 0;
+
+    bool mIsPolling = false;
+
+    bool mPollingScheduled = false;
+
 };
 
+bool LocalFileListingPrivate::isNetworkFileSystem(const QString &path)
+{
+    static const auto networkFileSystems = QList<QByteArray>{
+        QByteArrayLiteral("nfs"), QByteArrayLiteral("nfs4"), QByteArrayLiteral("cifs"),
+        QByteArrayLiteral("smb3"), QByteArrayLiteral("smbfs"), QByteArrayLiteral("ncpfs"),
+        QByteArrayLiteral("afs"), QByteArrayLiteral("9p"), QByteArrayLiteral("ceph"),
+        QByteArrayLiteral("glusterfs"), QByteArrayLiteral("davfs"), QByteArrayLiteral("coda"),
+        QByteArrayLiteral("sshfs"),
+    };
+
+    const auto &fileSystemType = QStorageInfo(path).fileSystemType();
+
+    return fileSystemType.startsWith("fuse") || networkFileSystems.contains(fileSystemType);
+}
+
 LocalFileListing::LocalFileListing(QObject *parent) : AbstractFileListing(QStringLiteral("local"), parent), d(std::make_unique<LocalFileListingPrivate>())
 {
 }
@@ -69,6 +100,22 @@ void LocalFileListing::setRootPath(const QString &rootPath)
     Q_EMIT rootPathChanged();
 
     setSourceName(rootPath);
+    setScanDevice(QStorageInfo(rootPath).device());
+}
+
+void LocalFileListing::setPollingInterval(int pollingInterval)
+{
+    d->mPollingInterval = pollingInterval;
+}
+
+void LocalFileListing::setPollingJitter(int pollingJitter)
+{
+    d->mPollingJitter = pollingJitter;
+}
+
+void LocalFileListing::setForcePolling(bool forcePolling)
+{
+    d->mForcePolling = (forcePolling ? 1 : 0);
 }
 
 void LocalFileListing::executeInit()
@@ -81,9 +128,56 @@ void LocalFileListing::triggerRefreshOfContent()
 
     AbstractFileListing::triggerRefreshOfContent();
 
-    scanDirectoryTree(d->mRootPath);
+    d->mIsPolling = d->mForcePolling != 0 || LocalFileListingPrivate::isNetworkFileSystem(d->mRootPath);
+    setWatchFileSystem(!d->mIsPolling);
+
+    if (d->mIsPolling) {
+        qDebug() << "LocalFileListing::triggerRefreshOfContent" << d->mRootPath << "polled for changes";
+    }
+
+    if (acquireScanDevice()) {
+        scanDirectoryTree(d->mRootPath);
+
+        releaseScanDevice();
+    }
 
     Q_EMIT indexingFinished();
+
+    schedulePolling();
+}
+
+void LocalFileListing::schedulePolling()
+{
+    if (!d->mIsPolling || d->mPollingScheduled) {
+        return;
+    }
+
+    auto pollingDelay = int(d->mPollingInterval);
+    const auto pollingJitter = int(d->mPollingJitter);
+    if (pollingJitter > 0) {
+        thread_local std::mt19937 jitterGenerator{std::random_device{}()};
+        pollingDelay += std::uniform_int_distribution<int>(0, pollingJitter)(jitterGenerator);
+    }
+
+    d->mPollingScheduled = true;
+    QTimer::singleShot(pollingDelay, this, &LocalFileListing::pollRootPath);
+}
+
+void LocalFileListing::pollRootPath()
+{
+    d->mPollingScheduled = false;
+
+    if (!d->mIsPolling) {
+        return;
+    }
+
+    if (acquireScanDevice()) {
+        rescanModifiedDirectories();
+
+        releaseScanDevice();
+    }
+
+    schedulePolling();
 }
 
 
@@ -54,8 +54,18 @@ public Q_SLOTS:
 
     void setRootPath(const QString &rootPath);
 
+    void setPollingInterval(int pollingInterval);
+
+    void setPollingJitter(int pollingJitter);
+
+    void setForcePolling(bool forcePolling);
+
 private:
 
+    void schedulePolling();
+
+    void pollRootPath();
+
     void executeInit() override;
 
     void triggerRefreshOfContent() override;
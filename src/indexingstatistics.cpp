@@ -0,0 +1,319 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "indexingstatistics.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QElapsedTimer>
+#include <QStringList>
+
+#include <array>
+#include <algorithm>
+#include <cmath>
+
+class IndexingStatisticsPrivate
+{
+public:
+
+    static const int BucketsCount = 160;
+
+    class Histogram
+    {
+    public:
+
+        std::array<quint64, BucketsCount> mBuckets = {};
+
+        int mCount = 0;
+
+        qint64 mMaximum = 0;
+
+        qint64 mTotal = 0;
+
+    };
+
+    static int bucketIndex(qint64 microseconds)
+    {
+        if (microseconds < 1) {
+            return 0;
+        }
+
+        return std::min(BucketsCount - 1, 1 + static_cast<int>(4 * std::log2(static_cast<double>(microseconds))));
+    }
+
+    static qint64 bucketUpperBound(int index)
+    {
+        if (index == 0) {
+            return 0;
+        }
+
+        return static_cast<qint64>(std::ceil(std::exp2(index / 4.)));
+    }
+
+    void copyFrom(const IndexingStatisticsPrivate &other)
+    {
+        mHistograms = other.mHistograms;
+        mFilesCount = other.mFilesCount;
+        mBytesRead = other.mBytesRead;
+        mTimer = other.mTimer;
+    }
+
+    mutable QMutex mMutex;
+
+    std::array<Histogram, IndexingStatistics::StagesCount> mHistograms;
+
+    int mFilesCount = 0;
+
+    qint64 mBytesRead = 0;
+
+    QElapsedTimer mTimer;
+
+};
+
+IndexingStatistics::IndexingStatistics() : d(std::make_unique<IndexingStatisticsPrivate>())
+{
+    d->mTimer.start();
+}
+
+IndexingStatistics::IndexingStatistics(const IndexingStatistics &other) : d(std::make_unique<IndexingStatisticsPrivate>())
+{
+    QMutexLocker locker(&other.d->mMutex);
+
+    d->copyFrom(*other.d);
+}
+
+IndexingStatistics &IndexingStatistics::operator=(const IndexingStatistics &other)
+{
+    if (&other == this) {
+        return *this;
+    }
+
+    IndexingStatisticsPrivate copy;
+
+    {
+        QMutexLocker locker(&other.d->mMutex);
+        copy.copyFrom(*other.d);
+    }
+
+    QMutexLocker locker(&d->mMutex);
+    d->copyFrom(copy);
+
+    return *this;
+}
+
+IndexingStatistics::~IndexingStatistics()
+= default;
+
+void IndexingStatistics::reset()
+{
+    QMutexLocker locker(&d->mMutex);
+
+    d->mHistograms = {};
+    d->mFilesCount = 0;
+    d->mBytesRead = 0;
+    d->mTimer.restart();
+}
+
+void IndexingStatistics::addDuration(Stage stage, qint64 microseconds)
+{
+    if (stage < 0 || stage >= StagesCount) {
+        return;
+    }
+
+    QMutexLocker locker(&d->mMutex);
+
+    auto &histogram = d->mHistograms[stage];
+
+    ++histogram.mBuckets[IndexingStatisticsPrivate::bucketIndex(microseconds)];
+    ++histogram.mCount;
+    histogram.mMaximum = std::max(histogram.mMaximum, microseconds);
+    histogram.mTotal += microseconds;
+}
+
+void IndexingStatistics::addFiles(int filesCount, qint64 bytesRead)
+{
+    QMutexLocker locker(&d->mMutex);
+
+    d->mFilesCount += filesCount;
+    d->mBytesRead += bytesRead;
+}
+
+int IndexingStatistics::count(Stage stage) const
+{
+    if (stage < 0 || stage >= StagesCount) {
+        return 0;
+    }
+
+    QMutexLocker locker(&d->mMutex);
+
+    return d->mHistograms[stage].mCount;
+}
+
+qint64 IndexingStatistics::percentile(Stage stage, int percent) const
+{
+    if (stage < 0 || stage >= StagesCount) {
+        return 0;
+    }
+
+    QMutexLocker locker(&d->mMutex);
+
+    const auto &histogram = d->mHistograms[stage];
+
+    if (histogram.mCount == 0) {
+        return 0;
+    }
+
+    const auto rank = std::max(quint64(1), static_cast<quint64>(std::ceil(histogram.mCount * percent / 100.)));
+
+    auto cumulatedCount = quint64(0);
+    for (int i = 0; i < IndexingStatisticsPrivate::BucketsCount; ++i) {
+        cumulatedCount += histogram.mBuckets[i];
+
+        if (cumulatedCount >= rank) {
+            return std::min(IndexingStatisticsPrivate::bucketUpperBound(i), histogram.mMaximum);
+        }
+    }
+
+    return histogram.mMaximum;
+}
+
+qint64 IndexingStatistics::maximum(Stage stage) const
+{
+    if (stage < 0 || stage >= StagesCount) {
+        return 0;
+    }
+
+    QMutexLocker locker(&d->mMutex);
+
+    return d->mHistograms[stage].mMaximum;
+}
+
+qint64 IndexingStatistics::totalDuration(Stage stage) const
+{
+    if (stage < 0 || stage >= StagesCount) {
+        return 0;
+    }
+
+    QMutexLocker locker(&d->mMutex);
+
+    return d->mHistograms[stage].mTotal;
+}
+
+int IndexingStatistics::filesCount() const
+{
+    QMutexLocker locker(&d->mMutex);
+
+    return d->mFilesCount;
+}
+
+qint64 IndexingStatistics::bytesRead() const
+{
+    QMutexLocker locker(&d->mMutex);
+
+    return d->mBytesRead;
+}
+
+qint64 IndexingStatistics::elapsed() const
+{
+    QMutexLocker locker(&d->mMutex);
+
+    return d->mTimer.elapsed();
+}
+
+double IndexingStatistics::filesPerSecond() const
+{
+    QMutexLocker locker(&d->mMutex);
+
+    const auto elapsedTime = d->mTimer.elapsed();
+
+    if (elapsedTime <= 0) {
+        return 0;
+    }
+
+    return 1000. * d->mFilesCount / elapsedTime;
+}
+
+QVariantMap IndexingStatistics::toVariantMap() const
+{
+    auto result = QVariantMap();
+
+    result[QStringLiteral("files")] = filesCount();
+    result[QStringLiteral("bytesRead")] = bytesRead();
+    result[QStringLiteral("elapsed")] = elapsed();
+    result[QStringLiteral("filesPerSecond")] = filesPerSecond();
+
+    for (int stage = 0; stage < StagesCount; ++stage) {
+        const auto currentStage = static_cast<Stage>(stage);
+        auto stageStatistics = QVariantMap();
+
+        stageStatistics[QStringLiteral("count")] = count(currentStage);
+        stageStatistics[QStringLiteral("p50")] = percentile(currentStage, 50);
+        stageStatistics[QStringLiteral("p95")] = percentile(currentStage, 95);
+        stageStatistics[QStringLiteral("max")] = maximum(currentStage);
+        stageStatistics[QStringLiteral("total")] = totalDuration(currentStage);
+
+        result[stageName(currentStage)] = stageStatistics;
+    }
+
+    return result;
+}
+
+QString IndexingStatistics::summary() const
+{
+    auto allStages = QStringList();
+
+    for (int stage = 0; stage < StagesCount; ++stage) {
+        const auto currentStage = static_cast<Stage>(stage);
+
+        if (count(currentStage) == 0) {
+            continue;
+        }
+
+        allStages.push_back(QStringLiteral("%1 %2/%3/%4us").arg(stageName(currentStage))
+                            .arg(percentile(currentStage, 50)).arg(percentile(currentStage, 95))
+                            .arg(maximum(currentStage)));
+    }
+
+    return QStringLiteral("%1 files in %2 ms (%3 files/s, %4 KiB read) p50/p95/max: %5")
+            .arg(filesCount()).arg(elapsed()).arg(filesPerSecond(), 0, 'f', 1)
+            .arg(bytesRead() / 1024).arg(allStages.join(QStringLiteral(", ")));
+}
+
+QString IndexingStatistics::stageName(Stage stage)
+{
+    switch (stage)
+    {
+    case Walk:
+        return QStringLiteral("walk");
+    case Mime:
+        return QStringLiteral("mime");
+    case Extract:
+        return QStringLiteral("extract");
+    case Cover:
+        return QStringLiteral("cover");
+    case Enqueue:
+        return QStringLiteral("enqueue");
+    case Commit:
+        return QStringLiteral("commit");
+    case StagesCount:
+        break;
+    }
+
+    return {};
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "librarydiffworker.h"
+
+#include <QList>
+#include <QHash>
+#include <QTime>
+#include <QUrl>
+#include <QMetaObject>
+
+template <typename Item>
+class PendingChanges
+{
+public:
+
+    bool isEmpty() const
+    {
+        return mRemovedIds.isEmpty() && mAddedItems.isEmpty() && mModifiedItems.isEmpty();
+    }
+
+    void add(const Item &item)
+    {
+        mModifiedItems.remove(item.databaseId());
+
+        auto itAdded = mAddedIndexById.constFind(item.databaseId());
+        if (itAdded != mAddedIndexById.constEnd()) {
+            mAddedItems[itAdded.value()] = item;
+            return;
+        }
+
+        mAddedIndexById[item.databaseId()] = mAddedItems.size();
+        mAddedItems.push_back(item);
+    }
+
+    void remove(qulonglong databaseId)
+    {
+        mModifiedItems.remove(databaseId);
+
+        auto itAdded = mAddedIndexById.find(databaseId);
+        if (itAdded != mAddedIndexById.end()) {
+            mAddedItems[itAdded.value()] = Item();
+            mAddedIndexById.erase(itAdded);
+        }
+
+        mRemovedIds.push_back(databaseId);
+    }
+
+    void modify(const Item &item)
+    {
+        auto itAdded = mAddedIndexById.constFind(item.databaseId());
+        if (itAdded != mAddedIndexById.constEnd()) {
+            mAddedItems[itAdded.value()] = item;
+            return;
+        }
+
+        mModifiedItems[item.databaseId()] = item;
+    }
+
+    ModelDiff<Item> takeDiff(ModelShadow<Item> &shadow)
+    {
+        auto result = shadow.computeDiff(mRemovedIds, mAddedItems, mModifiedItems.values());
+        shadow.applyDiff(result);
+
+        mRemovedIds.clear();
+        mAddedItems.clear();
+        mAddedIndexById.clear();
+        mModifiedItems.clear();
+
+        return result;
+    }
+
+private:
+
+    QList<qulonglong> mRemovedIds;
+
+    QList<Item> mAddedItems;
+
+    QHash<qulonglong, int> mAddedIndexById;
+
+    QHash<qulonglong, Item> mModifiedItems;
+
+};
+
+static ModelDisplayData<MusicAudioTrack> displayData(const MusicAudioTrack &track)
+{
+    auto result = ModelDisplayData<MusicAudioTrack>();
+
+    const auto &trackDuration = track.duration();
+    if (trackDuration.hour() == 0) {
+        result.mDuration = trackDuration.toString(QStringLiteral("mm:ss"));
+    } else {
+        result.mDuration = trackDuration.toString();
+    }
+
+    const auto &imageUrl = track.albumCover();
+    if (imageUrl.isValid()) {
+        result.mImage = imageUrl;
+    }
+
+    result.mResource = track.resourceURI();
+
+    return result;
+}
+
+static ModelDisplayData<MusicAlbum> displayData(const MusicAlbum &album)
+{
+    auto result = ModelDisplayData<MusicAlbum>();
+
+    result.mAllTracksTitle = album.allTracksTitle();
+    result.mAllArtists = album.allArtists().join(QStringLiteral(", "));
+
+    const auto &albumArt = album.albumArtURI();
+    if (albumArt.isValid()) {
+        result.mImage = albumArt;
+    }
+
+    return result;
+}
+
+template <typename Item>
+static void fillDisplayData(ModelDiff<Item> &changes)
+{
+    changes.mInsertedDisplayData.clear();
+    changes.mInsertedDisplayData.reserve(changes.mInsertedItems.size());
+    for (const auto &oneItem : changes.mInsertedItems) {
+        changes.mInsertedDisplayData.push_back(displayData(oneItem));
+    }
+
+    changes.mModifiedDisplayData.clear();
+    changes.mModifiedDisplayData.reserve(changes.mModifiedRows.size());
+    for (const auto &oneRow : changes.mModifiedRows) {
+        changes.mModifiedDisplayData.push_back(displayData(oneRow.second));
+    }
+}
+
+class LibraryDiffWorkerPrivate
+{
+public:
+
+    ModelShadow<MusicAudioTrack> mTracksShadow;
+
+    ModelShadow<MusicAlbum> mAlbumsShadow;
+
+    PendingChanges<MusicAudioTrack> mPendingTracks;
+
+    PendingChanges<MusicAlbum> mPendingAlbums;
+
+    bool mEmitScheduled = false;
+
+};
+
+LibraryDiffWorker::LibraryDiffWorker(QObject *parent) : QObject(parent), d(std::make_unique<LibraryDiffWorkerPrivate>())
+{
+}
+
+LibraryDiffWorker::~LibraryDiffWorker()
+= default;
+
+void LibraryDiffWorker::buildDisplayData(TracksModelDiff &changes)
+{
+    fillDisplayData(changes);
+}
+
+void LibraryDiffWorker::buildDisplayData(AlbumsModelDiff &changes)
+{
+    fillDisplayData(changes);
+}
+
+void LibraryDiffWorker::tracksAdded(const QList<MusicAudioTrack> &allTracks)
+{
+    for (const auto &oneTrack : allTracks) {
+        d->mPendingTracks.add(oneTrack);
+    }
+
+    schedulePendingChanges();
+}
+
+void LibraryDiffWorker::tracksRemoved(const QList<qulonglong> &removedTracksIds)
+{
+    for (auto oneTrackId : removedTracksIds) {
+        d->mPendingTracks.remove(oneTrackId);
+    }
+
+    schedulePendingChanges();
+}
+
+void LibraryDiffWorker::trackModified(const MusicAudioTrack &modifiedTrack)
+{
+    d->mPendingTracks.modify(modifiedTrack);
+
+    schedulePendingChanges();
+}
+
+void LibraryDiffWorker::albumsAdded(const QList<MusicAlbum> &newAlbums)
+{
+    for (const auto &oneAlbum : newAlbums) {
+        d->mPendingAlbums.add(oneAlbum);
+    }
+
+    schedulePendingChanges();
+}
+
+void LibraryDiffWorker::albumsRemoved(const QList<MusicAlbum> &removedAlbums)
+{
+    for (const auto &oneAlbum : removedAlbums) {
+        d->mPendingAlbums.remove(oneAlbum.databaseId());
+    }
+
+    schedulePendingChanges();
+}
+
+void LibraryDiffWorker::albumsModified(const QList<MusicAlbum> &modifiedAlbums)
+{
+    for (const auto &oneAlbum : modifiedAlbums) {
+        d->mPendingAlbums.modify(oneAlbum);
+    }
+
+    schedulePendingChanges();
+}
+
+void LibraryDiffWorker::emitPendingChanges()
+{
+    d->mEmitScheduled = false;
+
+    if (!d->mPendingTracks.isEmpty()) {
+        auto tracksChanges = d->mPendingTracks.takeDiff(d->mTracksShadow);
+
+        if (!tracksChanges.isEmpty()) {
+            buildDisplayData(tracksChanges);
+            Q_EMIT tracksChangesComputed(tracksChanges);
+        }
+    }
+
+    if (!d->mPendingAlbums.isEmpty()) {
+        auto albumsChanges = d->mPendingAlbums.takeDiff(d->mAlbumsShadow);
+
+        if (!albumsChanges.isEmpty()) {
+            buildDisplayData(albumsChanges);
+            Q_EMIT albumsChangesComputed(albumsChanges);
+        }
+    }
+}
+
+void LibraryDiffWorker::schedulePendingChanges()
+{
+    if (d->mEmitScheduled) {
+        return;
+    }
+
+    d->mEmitScheduled = true;
+
+    QMetaObject::invokeMethod(this, "emitPendingChanges", Qt::QueuedConnection);
+}
+
+
+#include "moc_librarydiffworker.cpp"
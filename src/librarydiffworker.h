@@ -0,0 +1,80 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef LIBRARYDIFFWORKER_H
+#define LIBRARYDIFFWORKER_H
+
+#include <QObject>
+
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+#include "modeldiff.h"
+
+#include <memory>
+
+class LibraryDiffWorkerPrivate;
+
+class LibraryDiffWorker : public QObject
+{
+
+    Q_OBJECT
+
+public:
+
+    explicit LibraryDiffWorker(QObject *parent = nullptr);
+
+    ~LibraryDiffWorker() override;
+
+    static void buildDisplayData(TracksModelDiff &changes);
+
+    static void buildDisplayData(AlbumsModelDiff &changes);
+
+Q_SIGNALS:
+
+    void tracksChangesComputed(const TracksModelDiff &changes);
+
+    void albumsChangesComputed(const AlbumsModelDiff &changes);
+
+public Q_SLOTS:
+
+    void tracksAdded(const QList<MusicAudioTrack> &allTracks);
+
+    void tracksRemoved(const QList<qulonglong> &removedTracksIds);
+
+    void trackModified(const MusicAudioTrack &modifiedTrack);
+
+    void albumsAdded(const QList<MusicAlbum> &newAlbums);
+
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
+
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
+
+private Q_SLOTS:
+
+    void emitPendingChanges();
+
+private:
+
+    void schedulePendingChanges();
+
+    std::unique_ptr<LibraryDiffWorkerPrivate> d;
+
+};
+
+#endif // LIBRARYDIFFWORKER_H
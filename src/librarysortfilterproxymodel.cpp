@@ -0,0 +1,646 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "librarysortfilterproxymodel.h"
+
+#include <QCollator>
+#include <QCollatorSortKey>
+#include <QStringList>
+#include <QVector>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+class LibrarySortFilterProxyModelPrivate
+{
+public:
+
+    class SortKey
+    {
+    public:
+
+        QCollatorSortKey mText;
+
+        qlonglong mNumber;
+
+        bool mIsText;
+
+    };
+
+    class RowKeys
+    {
+    public:
+
+        std::vector<SortKey> mSortKeys;
+
+        QString mSearchText;
+
+        int mRating = 0;
+
+    };
+
+    class Section
+    {
+    public:
+
+        QString mName;
+
+        int mCount;
+
+    };
+
+    LibrarySortFilterProxyModelPrivate() : mEmptySortKey(mCollator.sortKey(QString()))
+    {
+    }
+
+    // sections are built from the same text so that they follow the sort order
+    static QString sortText(const QVariant &value)
+    {
+        if (value.userType() == QMetaType::QStringList) {
+            return value.toStringList().join(QStringLiteral(", ")).trimmed();
+        }
+
+        return value.toString().trimmed();
+    }
+
+    QString computeSection(const QAbstractItemModel *model, int row) const
+    {
+        if (mSortRoles.isEmpty()) {
+            return {};
+        }
+
+        const auto &value = model->data(model->index(row, 0), mSortRoles.first());
+
+        if (value.userType() != QMetaType::QString && value.userType() != QMetaType::QStringList) {
+            return {};
+        }
+
+        return LibrarySortFilterProxyModel::sectionName(sortText(value));
+    }
+
+    RowKeys computeKeys(const QAbstractItemModel *model, int row) const
+    {
+        auto result = RowKeys();
+
+        const auto &currentIndex = model->index(row, 0);
+
+        result.mSortKeys.reserve(mSortRoles.size());
+        for (auto oneRole : mSortRoles) {
+            const auto &value = model->data(currentIndex, oneRole);
+
+            switch (value.userType())
+            {
+            case QMetaType::QString:
+            case QMetaType::QStringList:
+                result.mSortKeys.push_back({mCollator.sortKey(sortText(value)), 0, true});
+                break;
+            default:
+                result.mSortKeys.push_back({mEmptySortKey, value.toLongLong(), false});
+                break;
+            }
+        }
+
+        for (auto oneRole : mFilterRoles) {
+            const auto &value = model->data(currentIndex, oneRole);
+
+            if (value.userType() == QMetaType::QStringList) {
+                for (const auto &oneString : value.toStringList()) {
+                    result.mSearchText += LibrarySortFilterProxyModel::foldedText(oneString);
+                    result.mSearchText += QLatin1Char('\n');
+                }
+            } else {
+                result.mSearchText += LibrarySortFilterProxyModel::foldedText(value.toString());
+                result.mSearchText += QLatin1Char('\n');
+            }
+        }
+
+        if (mRatingRole >= 0) {
+            result.mRating = model->data(currentIndex, mRatingRole).toInt();
+        }
+
+        return result;
+    }
+
+    void rebuild(const QAbstractItemModel *model)
+    {
+        mRowKeys.clear();
+
+        if (!model) {
+            return;
+        }
+
+        const auto rowsCount = model->rowCount();
+
+        mRowKeys.reserve(rowsCount);
+        for (int row = 0; row < rowsCount; ++row) {
+            mRowKeys.push_back(computeKeys(model, row));
+        }
+    }
+
+    bool isKeyRole(int role) const
+    {
+        return role == mRatingRole || mSortRoles.contains(role) || mFilterRoles.contains(role);
+    }
+
+    bool acceptsKeys(const RowKeys &rowKeys) const
+    {
+        if (mRatingRole >= 0 && rowKeys.mRating < mFilterRating) {
+            return false;
+        }
+
+        if (mFoldedFilterText.isEmpty()) {
+            return true;
+        }
+
+        return rowKeys.mSearchText.contains(mFoldedFilterText);
+    }
+
+    bool updateSection(const RowKeys &rowKeys, const QString &section, int delta)
+    {
+        if (!acceptsKeys(rowKeys)) {
+            return false;
+        }
+
+        auto itSection = std::lower_bound(mSections.begin(), mSections.end(), section,
+                                          [this](const Section &oneSection, const QString &name) {
+            return mCollator.compare(oneSection.mName, name) < 0;
+        });
+
+        if (itSection == mSections.end() || itSection->mName != section) {
+            if (delta < 0) {
+                return false;
+            }
+
+            mSections.insert(itSection, {section, delta});
+
+            return true;
+        }
+
+        itSection->mCount += delta;
+
+        if (itSection->mCount <= 0) {
+            mSections.erase(itSection);
+
+            return true;
+        }
+
+        return false;
+    }
+
+    // the section index is only built once a view asks for it, then kept up to date until the next invalidation
+    void ensureSections(const QAbstractItemModel *model)
+    {
+        if (mSectionsValid || !model) {
+            return;
+        }
+
+        mSections.clear();
+        mRowSections.clear();
+        mRowSections.reserve(mRowKeys.size());
+
+        for (int row = 0; row < static_cast<int>(mRowKeys.size()); ++row) {
+            mRowSections.push_back(computeSection(model, row));
+            updateSection(mRowKeys[row], mRowSections.back(), 1);
+        }
+
+        mSectionsValid = true;
+    }
+
+    void invalidateSections()
+    {
+        mSectionsValid = false;
+        mSections.clear();
+        mRowSections.clear();
+    }
+
+    QCollator mCollator;
+
+    QCollatorSortKey mEmptySortKey;
+
+    QString mFilterText;
+
+    QString mFoldedFilterText;
+
+    int mFilterRating = 0;
+
+    QList<int> mFilterRoles;
+
+    int mRatingRole = -1;
+
+    QList<int> mSortRoles;
+
+    std::vector<RowKeys> mRowKeys;
+
+    std::vector<Section> mSections;
+
+    std::vector<QString> mRowSections;
+
+    bool mSectionsValid = false;
+
+};
+
+LibrarySortFilterProxyModel::LibrarySortFilterProxyModel(QObject *parent) : QSortFilterProxyModel(parent), d(std::make_unique<LibrarySortFilterProxyModelPrivate>())
+{
+    d->mCollator.setCaseSensitivity(Qt::CaseInsensitive);
+    d->mCollator.setNumericMode(true);
+    d->mEmptySortKey = d->mCollator.sortKey(QString());
+}
+
+LibrarySortFilterProxyModel::~LibrarySortFilterProxyModel()
+= default;
+
+void LibrarySortFilterProxyModel::setSourceModel(QAbstractItemModel *sourceModel)
+{
+    if (this->sourceModel()) {
+        disconnect(this->sourceModel(), &QAbstractItemModel::rowsInserted, this, &LibrarySortFilterProxyModel::sourceRowsInserted);
+        disconnect(this->sourceModel(), &QAbstractItemModel::rowsRemoved, this, &LibrarySortFilterProxyModel::sourceRowsRemoved);
+        disconnect(this->sourceModel(), &QAbstractItemModel::dataChanged, this, &LibrarySortFilterProxyModel::sourceDataChanged);
+        disconnect(this->sourceModel(), &QAbstractItemModel::modelReset, this, &LibrarySortFilterProxyModel::rebuildKeys);
+        disconnect(this->sourceModel(), &QAbstractItemModel::layoutChanged, this, &LibrarySortFilterProxyModel::rebuildKeys);
+        disconnect(this->sourceModel(), &QAbstractItemModel::rowsMoved, this, &LibrarySortFilterProxyModel::rebuildKeys);
+    }
+
+    // the keys have to be up to date before QSortFilterProxyModel reacts to
+    // the same signals, so these connections are made before its own ones
+    if (sourceModel) {
+        connect(sourceModel, &QAbstractItemModel::rowsInserted, this, &LibrarySortFilterProxyModel::sourceRowsInserted);
+        connect(sourceModel, &QAbstractItemModel::rowsRemoved, this, &LibrarySortFilterProxyModel::sourceRowsRemoved);
+        connect(sourceModel, &QAbstractItemModel::dataChanged, this, &LibrarySortFilterProxyModel::sourceDataChanged);
+        connect(sourceModel, &QAbstractItemModel::modelReset, this, &LibrarySortFilterProxyModel::rebuildKeys);
+        connect(sourceModel, &QAbstractItemModel::layoutChanged, this, &LibrarySortFilterProxyModel::rebuildKeys);
+        connect(sourceModel, &QAbstractItemModel::rowsMoved, this, &LibrarySortFilterProxyModel::rebuildKeys);
+    }
+
+    d->rebuild(sourceModel);
+
+    QSortFilterProxyModel::setSourceModel(sourceModel);
+
+    invalidateSections();
+}
+
+QVariant LibrarySortFilterProxyModel::data(const QModelIndex &index, int role) const
+{
+    if (role != ColumnsRoles::SectionRole) {
+        return QSortFilterProxyModel::data(index, role);
+    }
+
+    const auto &sourceIndex = mapToSource(index);
+
+    if (!sourceIndex.isValid()) {
+        return {};
+    }
+
+    return d->computeSection(sourceModel(), sourceIndex.row());
+}
+
+QHash<int, QByteArray> LibrarySortFilterProxyModel::roleNames() const
+{
+    auto roles = QSortFilterProxyModel::roleNames();
+
+    roles[static_cast<int>(ColumnsRoles::SectionRole)] = "section";
+
+    return roles;
+}
+
+QString LibrarySortFilterProxyModel::filterText() const
+{
+    return d->mFilterText;
+}
+
+int LibrarySortFilterProxyModel::filterRating() const
+{
+    return d->mFilterRating;
+}
+
+QList<int> LibrarySortFilterProxyModel::filterRoles() const
+{
+    return d->mFilterRoles;
+}
+
+int LibrarySortFilterProxyModel::ratingRole() const
+{
+    return d->mRatingRole;
+}
+
+QList<int> LibrarySortFilterProxyModel::sortRoles() const
+{
+    return d->mSortRoles;
+}
+
+QStringList LibrarySortFilterProxyModel::sections() const
+{
+    d->ensureSections(sourceModel());
+
+    auto result = QStringList();
+
+    result.reserve(static_cast<int>(d->mSections.size()));
+    for (const auto &oneSection : d->mSections) {
+        if (!oneSection.mName.isEmpty()) {
+            result.push_back(oneSection.mName);
+        }
+    }
+
+    if (sortOrder() == Qt::DescendingOrder) {
+        std::reverse(result.begin(), result.end());
+    }
+
+    return result;
+}
+
+int LibrarySortFilterProxyModel::sectionFirstRow(const QString &section) const
+{
+    if (rowCount() == 0) {
+        return -1;
+    }
+
+    d->ensureSections(sourceModel());
+
+    auto result = 0;
+
+    for (const auto &oneSection : d->mSections) {
+        const auto comparison = d->mCollator.compare(oneSection.mName, section);
+
+        if (sortOrder() == Qt::AscendingOrder && comparison < 0) {
+            result += oneSection.mCount;
+        } else if (sortOrder() == Qt::DescendingOrder && comparison > 0) {
+            result += oneSection.mCount;
+        }
+    }
+
+    return std::min(result, rowCount() - 1);
+}
+
+QString LibrarySortFilterProxyModel::foldedText(const QString &text)
+{
+    const auto &decomposedText = text.normalized(QString::NormalizationForm_KD);
+
+    auto result = QString();
+    result.reserve(decomposedText.size());
+
+    for (const auto &oneCharacter : decomposedText) {
+        if (oneCharacter.category() == QChar::Mark_NonSpacing) {
+            continue;
+        }
+
+        result.push_back(oneCharacter);
+    }
+
+    return result.toCaseFolded();
+}
+
+QString LibrarySortFilterProxyModel::sectionName(const QString &text)
+{
+    const auto &trimmedText = text.trimmed();
+
+    if (trimmedText.isEmpty()) {
+        return {};
+    }
+
+    const auto &firstCharacter = foldedText(trimmedText.left(trimmedText.at(0).isHighSurrogate() ? 2 : 1));
+
+    if (firstCharacter.isEmpty() || !firstCharacter.at(0).isLetter()) {
+        return QStringLiteral("#");
+    }
+
+    return firstCharacter.toUpper();
+}
+
+void LibrarySortFilterProxyModel::setFilterText(const QString &filterText)
+{
+    if (d->mFilterText == filterText) {
+        return;
+    }
+
+    d->mFilterText = filterText;
+    d->mFoldedFilterText = foldedText(filterText);
+
+    invalidateFilter();
+    invalidateSections();
+
+    Q_EMIT filterTextChanged(d->mFilterText);
+}
+
+void LibrarySortFilterProxyModel::setFilterRating(int filterRating)
+{
+    if (d->mFilterRating == filterRating) {
+        return;
+    }
+
+    d->mFilterRating = filterRating;
+
+    invalidateFilter();
+    invalidateSections();
+
+    Q_EMIT filterRatingChanged(filterRating);
+}
+
+void LibrarySortFilterProxyModel::setFilterRoles(const QList<int> &filterRoles)
+{
+    if (d->mFilterRoles == filterRoles) {
+        return;
+    }
+
+    d->mFilterRoles = filterRoles;
+
+    d->rebuild(sourceModel());
+    invalidateFilter();
+    invalidateSections();
+
+    Q_EMIT filterRolesChanged();
+}
+
+void LibrarySortFilterProxyModel::setRatingRole(int ratingRole)
+{
+    if (d->mRatingRole == ratingRole) {
+        return;
+    }
+
+    d->mRatingRole = ratingRole;
+
+    d->rebuild(sourceModel());
+    invalidateFilter();
+    invalidateSections();
+
+    Q_EMIT ratingRoleChanged();
+}
+
+void LibrarySortFilterProxyModel::setSortRoles(const QList<int> &sortRoles)
+{
+    if (d->mSortRoles == sortRoles) {
+        return;
+    }
+
+    d->mSortRoles = sortRoles;
+
+    d->rebuild(sourceModel());
+
+    if (d->mSortRoles.isEmpty()) {
+        sort(-1);
+    } else if (sortColumn() != 0) {
+        sort(0);
+    } else {
+        invalidate();
+    }
+
+    invalidateSections();
+
+    Q_EMIT sortRolesChanged();
+}
+
+bool LibrarySortFilterProxyModel::filterAcceptsRow(int source_row, const QModelIndex &source_parent) const
+{
+    if (source_parent.isValid() || source_row < 0 || source_row >= static_cast<int>(d->mRowKeys.size())) {
+        return false;
+    }
+
+    return d->acceptsKeys(d->mRowKeys[source_row]);
+}
+
+bool LibrarySortFilterProxyModel::lessThan(const QModelIndex &source_left, const QModelIndex &source_right) const
+{
+    const auto rowKeysCount = static_cast<int>(d->mRowKeys.size());
+
+    if (source_left.row() >= rowKeysCount || source_right.row() >= rowKeysCount) {
+        return source_left.row() < source_right.row();
+    }
+
+    const auto &leftKeys = d->mRowKeys[source_left.row()].mSortKeys;
+    const auto &rightKeys = d->mRowKeys[source_right.row()].mSortKeys;
+
+    for (size_t i = 0; i < leftKeys.size() && i < rightKeys.size(); ++i) {
+        const auto &leftKey = leftKeys[i];
+        const auto &rightKey = rightKeys[i];
+
+        if (leftKey.mIsText != rightKey.mIsText) {
+            return !leftKey.mIsText;
+        }
+
+        if (leftKey.mIsText) {
+            const auto comparison = leftKey.mText.compare(rightKey.mText);
+
+            if (comparison != 0) {
+                return comparison < 0;
+            }
+        } else if (leftKey.mNumber != rightKey.mNumber) {
+            return leftKey.mNumber < rightKey.mNumber;
+        }
+    }
+
+    return source_left.row() < source_right.row();
+}
+
+void LibrarySortFilterProxyModel::sourceRowsInserted(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid()) {
+        return;
+    }
+
+    auto newKeys = std::vector<LibrarySortFilterProxyModelPrivate::RowKeys>();
+    newKeys.reserve(last - first + 1);
+
+    auto newSections = std::vector<QString>();
+
+    auto sectionsModified = false;
+    for (int row = first; row <= last; ++row) {
+        newKeys.push_back(d->computeKeys(sourceModel(), row));
+
+        if (d->mSectionsValid) {
+            newSections.push_back(d->computeSection(sourceModel(), row));
+            sectionsModified = d->updateSection(newKeys.back(), newSections.back(), 1) || sectionsModified;
+        }
+    }
+
+    d->mRowKeys.insert(d->mRowKeys.begin() + first, std::make_move_iterator(newKeys.begin()), std::make_move_iterator(newKeys.end()));
+
+    if (d->mSectionsValid) {
+        d->mRowSections.insert(d->mRowSections.begin() + first, std::make_move_iterator(newSections.begin()), std::make_move_iterator(newSections.end()));
+    }
+
+    if (sectionsModified) {
+        Q_EMIT sectionsChanged();
+    }
+}
+
+void LibrarySortFilterProxyModel::sourceRowsRemoved(const QModelIndex &parent, int first, int last)
+{
+    if (parent.isValid()) {
+        return;
+    }
+
+    auto sectionsModified = false;
+    if (d->mSectionsValid) {
+        for (int row = first; row <= last && row < static_cast<int>(d->mRowKeys.size()); ++row) {
+            sectionsModified = d->updateSection(d->mRowKeys[row], d->mRowSections[row], -1) || sectionsModified;
+        }
+
+        d->mRowSections.erase(d->mRowSections.begin() + first, d->mRowSections.begin() + last + 1);
+    }
+
+    d->mRowKeys.erase(d->mRowKeys.begin() + first, d->mRowKeys.begin() + last + 1);
+
+    if (sectionsModified) {
+        Q_EMIT sectionsChanged();
+    }
+}
+
+void LibrarySortFilterProxyModel::sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles)
+{
+    if (topLeft.parent().isValid()) {
+        return;
+    }
+
+    if (!roles.isEmpty() && std::none_of(roles.begin(), roles.end(), [this](int oneRole) {return d->isKeyRole(oneRole);})) {
+        return;
+    }
+
+    auto sectionsModified = false;
+    for (int row = topLeft.row(); row <= bottomRight.row() && row < static_cast<int>(d->mRowKeys.size()); ++row) {
+        if (!d->mSectionsValid) {
+            d->mRowKeys[row] = d->computeKeys(sourceModel(), row);
+            continue;
+        }
+
+        sectionsModified = d->updateSection(d->mRowKeys[row], d->mRowSections[row], -1) || sectionsModified;
+        d->mRowKeys[row] = d->computeKeys(sourceModel(), row);
+        d->mRowSections[row] = d->computeSection(sourceModel(), row);
+        sectionsModified = d->updateSection(d->mRowKeys[row], d->mRowSections[row], 1) || sectionsModified;
+    }
+
+    if (sectionsModified) {
+        Q_EMIT sectionsChanged();
+    }
+}
+
+void LibrarySortFilterProxyModel::rebuildKeys()
+{
+    d->rebuild(sourceModel());
+
+    invalidateSections();
+}
+
+void LibrarySortFilterProxyModel::invalidateSections()
+{
+    d->invalidateSections();
+
+    Q_EMIT sectionsChanged();
+}
+
+
+#include "moc_librarysortfilterproxymodel.cpp"
@@ -0,0 +1,164 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef LIBRARYSORTFILTERPROXYMODEL_H
+#define LIBRARYSORTFILTERPROXYMODEL_H
+
+#include <QSortFilterProxyModel>
+#include <QList>
+#include <QStringList>
+
+#include <memory>
+
+class LibrarySortFilterProxyModelPrivate;
+
+/**
+ * Sort and filter proxy shared by the library views.
+ *
+ * Collation sort keys and case and diacritic folded search keys are computed
+ * once per source row and kept up to date when rows are inserted, removed or
+ * changed, so sorting and filtering never convert values or run a regular
+ * expression per row.
+ *
+ * The first sort role also gives each row a section, its first letter once
+ * folded. The number of visible rows per section is only counted once sections
+ * or sectionFirstRow are used, then kept up to date so a view can jump to the
+ * first row of a section.
+ */
+class LibrarySortFilterProxyModel : public QSortFilterProxyModel
+{
+
+    Q_OBJECT
+
+    Q_PROPERTY(QString filterText
+               READ filterText
+               WRITE setFilterText
+               NOTIFY filterTextChanged)
+
+    Q_PROPERTY(int filterRating
+               READ filterRating
+               WRITE setFilterRating
+               NOTIFY filterRatingChanged)
+
+    Q_PROPERTY(QList<int> filterRoles
+               READ filterRoles
+               WRITE setFilterRoles
+               NOTIFY filterRolesChanged)
+
+    Q_PROPERTY(int ratingRole
+               READ ratingRole
+               WRITE setRatingRole
+               NOTIFY ratingRoleChanged)
+
+    Q_PROPERTY(QList<int> sortRoles
+               READ sortRoles
+               WRITE setSortRoles
+               NOTIFY sortRolesChanged)
+
+    Q_PROPERTY(QStringList sections
+               READ sections
+               NOTIFY sectionsChanged)
+
+public:
+
+    enum ColumnsRoles {
+        SectionRole = Qt::UserRole + 1000,
+    };
+
+    Q_ENUM(ColumnsRoles)
+
+    explicit LibrarySortFilterProxyModel(QObject *parent = nullptr);
+
+    ~LibrarySortFilterProxyModel() override;
+
+    void setSourceModel(QAbstractItemModel *sourceModel) override;
+
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    QHash<int, QByteArray> roleNames() const override;
+
+    QString filterText() const;
+
+    int filterRating() const;
+
+    QList<int> filterRoles() const;
+
+    int ratingRole() const;
+
+    QList<int> sortRoles() const;
+
+    QStringList sections() const;
+
+    Q_INVOKABLE int sectionFirstRow(const QString &section) const;
+
+    static QString foldedText(const QString &text);
+
+    static QString sectionName(const QString &text);
+
+public Q_SLOTS:
+
+    void setFilterText(const QString &filterText);
+
+    void setFilterRating(int filterRating);
+
+    void setFilterRoles(const QList<int> &filterRoles);
+
+    void setRatingRole(int ratingRole);
+
+    void setSortRoles(const QList<int> &sortRoles);
+
+Q_SIGNALS:
+
+    void filterTextChanged(const QString &filterText);
+
+    void filterRatingChanged(int filterRating);
+
+    void filterRolesChanged();
+
+    void ratingRoleChanged();
+
+    void sortRolesChanged();
+
+    void sectionsChanged();
+
+protected:
+
+    bool filterAcceptsRow(int source_row, const QModelIndex &source_parent) const override;
+
+    bool lessThan(const QModelIndex &source_left, const QModelIndex &source_right) const override;
+
+private Q_SLOTS:
+
+    void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+
+    void sourceRowsRemoved(const QModelIndex &parent, int first, int last);
+
+    void sourceDataChanged(const QModelIndex &topLeft, const QModelIndex &bottomRight, const QVector<int> &roles);
+
+    void rebuildKeys();
+
+    void invalidateSections();
+
+private:
+
+    std::unique_ptr<LibrarySortFilterProxyModelPrivate> d;
+
+};
+
+#endif // LIBRARYSORTFILTERPROXYMODEL_H
@@ -21,20 +21,127 @@
 #include "databaseinterface.h"
 #include "musicaudiotrack.h"
 #include "musiclistenersmanager.h"
+#include "playliststore.h"
 
 #include <QUrl>
 #include <QPersistentModelIndex>
 #include <QList>
+#include <QMultiHash>
 #include <QMediaPlaylist>
 #include <QFileInfo>
+#include <QTimer>
+#include <QCoreApplication>
 #include <QDebug>
 
 #include <algorithm>
 
+class PendingTrackKey
+{
+public:
+
+    QString mTitle;
+
+    QString mAlbum;
+
+    int mTrackNumber = -1;
+
+    int mDiscNumber = -1;
+
+    bool operator==(const PendingTrackKey &other) const
+    {
+        return mTitle == other.mTitle && mAlbum == other.mAlbum &&
+                mTrackNumber == other.mTrackNumber && mDiscNumber == other.mDiscNumber;
+    }
+
+};
+
+static uint qHash(const PendingTrackKey &key, uint seed = 0)
+{
+    seed = qHash(key.mTitle, seed);
+    seed = qHash(key.mAlbum, seed);
+    seed = qHash(key.mTrackNumber, seed);
+
+    return qHash(key.mDiscNumber, seed);
+}
+
 class MediaPlayListPrivate
 {
 public:
 
+    void indexRow(int row)
+    {
+        const auto &oneEntry = mData[row];
+
+        if (oneEntry.mIsArtist) {
+            return;
+        }
+
+        mRowsById.insert(oneEntry.mId, row);
+
+        if (oneEntry.mTrackUrl.isValid()) {
+            mRowsByUrl.insert(oneEntry.mTrackUrl, row);
+        } else {
+            mRowsByTrackKey.insert({oneEntry.mTitle, oneEntry.mAlbum, oneEntry.mTrackNumber, oneEntry.mDiscNumber}, row);
+        }
+
+        const auto &resource = mTrackData[row].resourceURI();
+        if (resource.isValid() && resource != oneEntry.mTrackUrl) {
+            mRowsByUrl.insert(resource, row);
+        }
+    }
+
+    void unindexRow(int row)
+    {
+        const auto &oneEntry = mData[row];
+
+        if (oneEntry.mIsArtist) {
+            return;
+        }
+
+        mRowsById.remove(oneEntry.mId, row);
+
+        if (oneEntry.mTrackUrl.isValid()) {
+            mRowsByUrl.remove(oneEntry.mTrackUrl, row);
+        } else {
+            mRowsByTrackKey.remove({oneEntry.mTitle, oneEntry.mAlbum, oneEntry.mTrackNumber, oneEntry.mDiscNumber}, row);
+        }
+
+        const auto &resource = mTrackData[row].resourceURI();
+        if (resource.isValid() && resource != oneEntry.mTrackUrl) {
+            mRowsByUrl.remove(resource, row);
+        }
+    }
+
+    void indexRows(int first, int last)
+    {
+        for (int row = first; row <= last; ++row) {
+            indexRow(row);
+        }
+    }
+
+    void unindexRows(int first, int last)
+    {
+        for (int row = first; row <= last; ++row) {
+            unindexRow(row);
+        }
+    }
+
+    QList<int> rowsForTrack(const MusicAudioTrack &track) const
+    {
+        auto result = mRowsByUrl.values(track.resourceURI());
+
+        if (track.databaseId() != 0) {
+            result.append(mRowsById.values(track.databaseId()));
+        }
+
+        result.append(mRowsByTrackKey.values({track.title(), track.albumName(), track.trackNumber(), track.discNumber()}));
+
+        std::sort(result.begin(), result.end());
+        result.erase(std::unique(result.begin(), result.end()), result.end());
+
+        return result;
+    }
+
     QList<MediaPlayListEntry> mData;
 
     QList<MusicAudioTrack> mTrackData;
@@ -53,16 +160,46 @@ public:
 
     QMediaPlaylist mLoadPlaylist;
 
+    QMultiHash<qulonglong, int> mRowsById;
+
+    QMultiHash<QUrl, int> mRowsByUrl;
+
+    QMultiHash<PendingTrackKey, int> mRowsByTrackKey;
+
+    PlayListStore mPlayListStore;
+
+    QTimer mPlayListStoreTimer;
+
+    bool mRestoredFromStore = false;
+
 };
 
 MediaPlayList::MediaPlayList(QObject *parent) : QAbstractListModel(parent), d(new MediaPlayListPrivate)
 {
     connect(&d->mLoadPlaylist, &QMediaPlaylist::loaded, this, &MediaPlayList::loadPlayListLoaded);
     connect(&d->mLoadPlaylist, &QMediaPlaylist::loadFailed, this, &MediaPlayList::loadPlayListLoadFailed);
+
+    d->mPlayListStoreTimer.setSingleShot(true);
+    d->mPlayListStoreTimer.setInterval(1000);
+
+    connect(&d->mPlayListStoreTimer, &QTimer::timeout, this, &MediaPlayList::savePlayListStore);
+    connect(this, &MediaPlayList::persistentStateChanged, this, &MediaPlayList::schedulePlayListStoreSave);
+    connect(this, &MediaPlayList::dataChanged, this, &MediaPlayList::schedulePlayListStoreSave);
+    connect(this, &MediaPlayList::currentTrackChanged, this, &MediaPlayList::schedulePlayListStoreSave);
+    connect(this, &MediaPlayList::randomPlayChanged, this, &MediaPlayList::schedulePlayListStoreSave);
+    connect(this, &MediaPlayList::repeatPlayChanged, this, &MediaPlayList::schedulePlayListStoreSave);
+
+    if (QCoreApplication::instance()) {
+        connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit, this, &MediaPlayList::savePlayListStore);
+    }
 }
 
 MediaPlayList::~MediaPlayList()
-= default;
+{
+    if (d->mPlayListStoreTimer.isActive()) {
+        savePlayListStore();
+    }
+}
 
 int MediaPlayList::rowCount(const QModelIndex &parent) const
 {
@@ -296,51 +433,11 @@ QHash<int, QByteArray> MediaPlayList::roleNames() const
 
 bool MediaPlayList::removeRows(int row, int count, const QModelIndex &parent)
 {
-    beginRemoveRows(parent, row, row + count - 1);
-
-    bool hadAlbumHeader = false;
-
-    if (rowCount() > row + count) {
-        hadAlbumHeader = rowHasHeader(row + count);
-    }
-
-    for (int i = row, cpt = 0; cpt < count; ++i, ++cpt) {
-        d->mData.removeAt(i);
-        d->mTrackData.removeAt(i);
-    }
-    endRemoveRows();
-
-    if (!d->mCurrentTrack.isValid()) {
-        d->mCurrentTrack = index(d->mCurrentPlayListPosition, 0);
-
-        if (d->mCurrentTrack.isValid()) {
-            notifyCurrentTrackChanged();
-        }
-
-        if (!d->mCurrentTrack.isValid()) {
-            Q_EMIT playListFinished();
-            resetCurrentTrack();
-            if (!d->mCurrentTrack.isValid()) {
-                notifyCurrentTrackChanged();
-            }
-        }
-    }
-
-    if (!d->mCurrentTrack.isValid() && rowCount(parent) <= row) {
-        resetCurrentTrack();
-    }
-
-    Q_EMIT tracksCountChanged();
-
-    if (hadAlbumHeader != rowHasHeader(row)) {
-        Q_EMIT dataChanged(index(row, 0), index(row, 0), {ColumnsRoles::HasAlbumHeader});
-
-        if (!d->mCurrentTrack.isValid()) {
-            resetCurrentTrack();
-        }
+    if (parent.isValid() || count <= 0 || row < 0 || row + count > d->mData.size()) {
+        return false;
     }
 
-    Q_EMIT persistentStateChanged();
+    removeRanges({{row, row + count - 1}});
 
     return false;
 }
@@ -376,6 +473,7 @@ void MediaPlayList::enqueue(const MediaPlayListEntry &newEntry, const MusicAudio
     } else {
         d->mTrackData.push_back({});
     }
+    d->indexRow(d->mData.size() - 1);
     endInsertRows();
 
     restorePlayListPosition();
@@ -388,7 +486,6 @@ void MediaPlayList::enqueue(const MediaPlayListEntry &newEntry, const MusicAudio
 
     if (!newEntry.mIsValid) {
         if (newEntry.mTrackUrl.isValid()) {
-            qDebug() << "MediaPlayList::enqueue" << "newTrackByFileNameInList" << newEntry.mTrackUrl;
             if (newEntry.mTrackUrl.isLocalFile()) {
                 QFileInfo newTrackFile(newEntry.mTrackUrl.toLocalFile());
                 if (newTrackFile.exists()) {
@@ -414,6 +511,180 @@ void MediaPlayList::enqueue(const MediaPlayListEntry &newEntry, const MusicAudio
     }
 }
 
+void MediaPlayList::enqueue(const QVector<MediaPlayListEntry> &newEntries, const QVector<MusicAudioTrack> &audioTracks)
+{
+    insertEntries(d->mData.size(), newEntries, audioTracks);
+}
+
+void MediaPlayList::insertEntries(int firstNewRow, const QVector<MediaPlayListEntry> &newEntries, const QVector<MusicAudioTrack> &audioTracks)
+{
+    if (newEntries.isEmpty()) {
+        return;
+    }
+
+    const auto lastNewRow = firstNewRow + newEntries.size() - 1;
+
+    beginInsertRows(QModelIndex(), firstNewRow, lastNewRow);
+    d->unindexRows(firstNewRow, d->mData.size() - 1);
+    for (int i = 0; i < newEntries.size(); ++i) {
+        d->mData.insert(firstNewRow + i, newEntries[i]);
+        if (i < audioTracks.size() && audioTracks[i].isValid()) {
+            d->mTrackData.insert(firstNewRow + i, audioTracks[i]);
+        } else {
+            d->mTrackData.insert(firstNewRow + i, MusicAudioTrack());
+        }
+    }
+    d->indexRows(firstNewRow, d->mData.size() - 1);
+    endInsertRows();
+
+    if (d->mCurrentTrack.isValid() && d->mCurrentTrack.row() != d->mCurrentPlayListPosition) {
+        notifyCurrentTrackChanged();
+    }
+
+    restorePlayListPosition();
+    if (!d->mCurrentTrack.isValid()) {
+        resetCurrentTrack();
+    }
+
+    Q_EMIT tracksCountChanged();
+    Q_EMIT persistentStateChanged();
+
+    auto newTrackIds = QList<qulonglong>();
+    auto newFileNames = QList<QUrl>();
+    auto knownTrackIds = QList<qulonglong>();
+    auto knownFileNames = QList<QUrl>();
+    auto newTracksByName = QList<MusicAudioTrack>();
+    auto newArtists = QStringList();
+    auto hasPendingEntries = false;
+
+    for (int row = firstNewRow; row <= lastNewRow; ++row) {
+        auto &oneEntry = d->mData[row];
+
+        if (oneEntry.mIsArtist) {
+            newArtists.push_back(oneEntry.mArtist);
+        } else if (oneEntry.mIsValid) {
+            newTrackIds.push_back(oneEntry.mId);
+        } else if (oneEntry.mTrackUrl.isValid()) {
+            hasPendingEntries = true;
+
+            if (oneEntry.mTrackUrl.isLocalFile() && QFileInfo(oneEntry.mTrackUrl.toLocalFile()).exists()) {
+                oneEntry.mIsValid = true;
+            }
+
+            if (oneEntry.mId != 0) {
+                knownTrackIds.push_back(oneEntry.mId);
+                knownFileNames.push_back(oneEntry.mTrackUrl);
+            } else if (oneEntry.mTrackUrl.isLocalFile()) {
+                newFileNames.push_back(oneEntry.mTrackUrl);
+            }
+        } else {
+            hasPendingEntries = true;
+
+            auto pendingTrack = MusicAudioTrack();
+            pendingTrack.setTitle(oneEntry.mTitle);
+            pendingTrack.setArtist(oneEntry.mArtist);
+            pendingTrack.setAlbumName(oneEntry.mAlbum);
+            pendingTrack.setTrackNumber(oneEntry.mTrackNumber);
+            pendingTrack.setDiscNumber(oneEntry.mDiscNumber);
+            newTracksByName.push_back(pendingTrack);
+        }
+    }
+
+    if (!newTrackIds.isEmpty()) {
+        Q_EMIT newTracksByIdInList(newTrackIds);
+    }
+
+    if (!newTracksByName.isEmpty()) {
+        Q_EMIT newTracksByNameInList(newTracksByName);
+    }
+
+    if (!newFileNames.isEmpty()) {
+        Q_EMIT newTracksByFileNameInList(newFileNames);
+    }
+
+    if (!knownTrackIds.isEmpty()) {
+        Q_EMIT newTracksByIdOrFileNameInList(knownTrackIds, knownFileNames);
+    }
+
+    for (const auto &oneArtist : newArtists) {
+        Q_EMIT newArtistInList(oneArtist);
+    }
+
+    Q_EMIT trackHasBeenAdded(data(index(lastNewRow, 0), ColumnsRoles::TitleRole).toString(), data(index(lastNewRow, 0), ColumnsRoles::ImageRole).toUrl());
+
+    if (lastNewRow + 1 < rowCount()) {
+        Q_EMIT dataChanged(index(lastNewRow + 1, 0), index(lastNewRow + 1, 0), {MediaPlayList::HasAlbumHeader});
+    }
+
+    if (hasPendingEntries) {
+        Q_EMIT dataChanged(index(firstNewRow, 0), index(lastNewRow, 0), {MediaPlayList::HasAlbumHeader});
+
+        if (!d->mCurrentTrack.isValid()) {
+            resetCurrentTrack();
+        }
+    }
+}
+
+void MediaPlayList::enqueue(const QList<qulonglong> &newTrackIds)
+{
+    auto newEntries = QVector<MediaPlayListEntry>();
+    newEntries.reserve(newTrackIds.size());
+
+    for (auto oneTrackId : newTrackIds) {
+        newEntries.push_back(MediaPlayListEntry(oneTrackId));
+    }
+
+    enqueue(newEntries);
+}
+
+QString MediaPlayList::playListStoreFileName() const
+{
+    return d->mPlayListStore.fileName();
+}
+
+void MediaPlayList::setPlayListStoreFileName(const QString &fileName)
+{
+    if (d->mPlayListStore.fileName() == fileName) {
+        return;
+    }
+
+    d->mPlayListStore.setFileName(fileName);
+
+    d->mPlayListStore.load(this, "playListStoreLoaded");
+}
+
+void MediaPlayList::playListStoreLoaded()
+{
+    auto restoredEntries = QVector<MediaPlayListEntry>();
+    auto restoredCurrentTrack = 0;
+    auto restoredRandomPlay = false;
+    auto restoredRepeatPlay = false;
+
+    if (!d->mPlayListStore.takeLoaded(restoredEntries, restoredCurrentTrack, restoredRandomPlay, restoredRepeatPlay)) {
+        return;
+    }
+
+    // tracks enqueued before the store was read, like the files given on the
+    // command line, stay after the restored ones and keep the current track
+    const auto playListWasEmpty = d->mData.isEmpty();
+
+    d->mRestoredFromStore = true;
+
+    if (playListWasEmpty) {
+        d->mPersistentState[QStringLiteral("currentTrack")] = restoredCurrentTrack;
+    } else {
+        d->mPersistentState.remove(QStringLiteral("currentTrack"));
+    }
+    d->mPersistentState[QStringLiteral("randomPlay")] = restoredRandomPlay;
+    d->mPersistentState[QStringLiteral("repeatPlay")] = restoredRepeatPlay;
+
+    insertEntries(0, restoredEntries, {});
+
+    restorePlayListPosition();
+    restoreRandomPlay();
+    restoreRepeatPlay();
+}
+
 bool MediaPlayList::moveRows(const QModelIndex &sourceParent, int sourceRow, int count, const QModelIndex &destinationParent, int destinationChild)
 {
     if (sourceParent != destinationParent) {
@@ -431,6 +702,10 @@ bool MediaPlayList::moveRows(const QModelIndex &sourceParent, int sourceRow, int
         nextTrackHasHeader = rowHasHeader(sourceRow + count);
     }
 
+    const auto firstMovedRow = std::min(sourceRow, destinationChild);
+    const auto lastMovedRow = std::min(std::max(sourceRow + count, destinationChild), d->mData.size()) - 1;
+
+    d->unindexRows(firstMovedRow, lastMovedRow);
     for (auto cptItem = 0; cptItem < count; ++cptItem) {
         if (sourceRow < destinationChild) {
             d->mData.move(sourceRow, destinationChild - 1);
@@ -440,6 +715,7 @@ bool MediaPlayList::moveRows(const QModelIndex &sourceParent, int sourceRow, int
             d->mTrackData.move(sourceRow, destinationChild);
         }
     }
+    d->indexRows(firstMovedRow, lastMovedRow);
 
     endMoveRows();
 
@@ -513,9 +789,19 @@ void MediaPlayList::move(int from, int to, int n)
 
 void MediaPlayList::enqueue(const MusicAlbum &album)
 {
+    auto newEntries = QVector<MediaPlayListEntry>();
+    auto newTracks = QVector<MusicAudioTrack>();
+    newEntries.reserve(album.tracksCount());
+    newTracks.reserve(album.tracksCount());
+
     for (auto oneTrackIndex = 0; oneTrackIndex < album.tracksCount(); ++oneTrackIndex) {
-        enqueue(album.trackFromIndex(oneTrackIndex));
+        const auto &oneTrack = album.trackFromIndex(oneTrackIndex);
+
+        newEntries.push_back(MediaPlayListEntry(oneTrack));
+        newTracks.push_back(oneTrack);
     }
+
+    enqueue(newEntries, newTracks);
 }
 
 void MediaPlayList::enqueue(const MusicArtist &artist)
@@ -542,15 +828,58 @@ void MediaPlayList::enqueue(const QString &artistName)
 
 void MediaPlayList::enqueue(const QUrl &fileName)
 {
-    qDebug() << "MediaPlayList::enqueue" << fileName;
     enqueue(MediaPlayListEntry(fileName));
 }
 
 void MediaPlayList::enqueue(const QStringList &files)
 {
-    qDebug() << "MediaPlayList::enqueue" << files;
+    auto allFiles = QList<QUrl>();
+
     for (const auto &oneFileName : files) {
-        enqueue(QUrl::fromLocalFile(oneFileName));
+        if (QFileInfo(oneFileName).isDir()) {
+            Q_EMIT newFileNamesToExpandInList(files);
+            return;
+        }
+
+        allFiles.push_back(QUrl::fromLocalFile(oneFileName));
+    }
+
+    enqueueFileNames(allFiles);
+}
+
+void MediaPlayList::enqueueFileNames(const QList<QUrl> &allFiles)
+{
+    if (allFiles.isEmpty()) {
+        return;
+    }
+
+    const auto firstNewRow = d->mData.size();
+
+    beginInsertRows(QModelIndex(), firstNewRow, firstNewRow + allFiles.size() - 1);
+    for (const auto &oneFile : allFiles) {
+        d->mData.push_back(MediaPlayListEntry(oneFile));
+        d->mData.last().mIsValid = QFileInfo(oneFile.toLocalFile()).exists();
+        d->mTrackData.push_back({});
+    }
+    d->indexRows(firstNewRow, d->mData.size() - 1);
+    endInsertRows();
+
+    restorePlayListPosition();
+    if (!d->mCurrentTrack.isValid()) {
+        resetCurrentTrack();
+    }
+
+    Q_EMIT tracksCountChanged();
+    Q_EMIT persistentStateChanged();
+
+    Q_EMIT newTracksByFileNameInList(allFiles);
+
+    Q_EMIT trackHasBeenAdded(data(index(d->mData.size() - 1, 0), ColumnsRoles::TitleRole).toString(), data(index(d->mData.size() - 1, 0), ColumnsRoles::ImageRole).toUrl());
+
+    Q_EMIT dataChanged(index(firstNewRow, 0), index(rowCount() - 1, 0), {MediaPlayList::HasAlbumHeader});
+
+    if (!d->mCurrentTrack.isValid()) {
+        resetCurrentTrack();
     }
 }
 
@@ -583,9 +912,12 @@ void MediaPlayList::clearPlayList()
         return;
     }
 
-    beginRemoveRows({}, 0, d->mData.count());
+    beginRemoveRows({}, 0, d->mData.count() - 1);
     d->mData.clear();
     d->mTrackData.clear();
+    d->mRowsById.clear();
+    d->mRowsByUrl.clear();
+    d->mRowsByTrackKey.clear();
     endRemoveRows();
 
     Q_EMIT tracksCountChanged();
@@ -615,6 +947,15 @@ bool MediaPlayList::savePlaylist(const QUrl &fileName)
 QVariantMap MediaPlayList::persistentState() const
 {
     auto currentState = QVariantMap();
+
+    currentState[QStringLiteral("currentTrack")] = d->mCurrentPlayListPosition;
+    currentState[QStringLiteral("randomPlay")] = d->mRandomPlay;
+    currentState[QStringLiteral("repeatPlay")] = d->mRepeatPlay;
+
+    if (!d->mPlayListStore.fileName().isEmpty()) {
+        return currentState;
+    }
+
     auto result = QList<QVariant>();
 
     for (int trackIndex = 0; trackIndex < d->mData.size(); ++trackIndex) {
@@ -634,9 +975,6 @@ QVariantMap MediaPlayList::persistentState() const
     }
 
     currentState[QStringLiteral("playList")] = result;
-    currentState[QStringLiteral("currentTrack")] = d->mCurrentPlayListPosition;
-    currentState[QStringLiteral("randomPlay")] = d->mRandomPlay;
-    currentState[QStringLiteral("repeatPlay")] = d->mRepeatPlay;
 
     return currentState;
 }
@@ -679,9 +1017,15 @@ void MediaPlayList::setPersistentState(const QVariantMap &persistentStateValue)
 
     qDebug() << "MediaPlayList::setPersistentState" << persistentStateValue;
 
+    if (d->mRestoredFromStore) {
+        return;
+    }
+
     d->mPersistentState = persistentStateValue;
 
     auto persistentState = d->mPersistentState[QStringLiteral("playList")].toList();
+    auto restoredEntries = QVector<MediaPlayListEntry>();
+    restoredEntries.reserve(persistentState.size());
 
     for (auto &oneData : persistentState) {
         auto trackData = oneData.toStringList();
@@ -695,9 +1039,11 @@ void MediaPlayList::setPersistentState(const QVariantMap &persistentStateValue)
         auto restoredTrackNumber = trackData[3].toInt();
         auto restoredDiscNumber = trackData[4].toInt();
 
-        enqueue({restoredTitle, restoredArtist, restoredAlbum, restoredTrackNumber, restoredDiscNumber});
+        restoredEntries.push_back({restoredTitle, restoredArtist, restoredAlbum, restoredTrackNumber, restoredDiscNumber});
     }
 
+    enqueue(restoredEntries);
+
     restorePlayListPosition();
     restoreRandomPlay();
     restoreRepeatPlay();
@@ -708,10 +1054,23 @@ void MediaPlayList::setPersistentState(const QVariantMap &persistentStateValue)
 void MediaPlayList::removeSelection(QList<int> selection)
 {
     std::sort(selection.begin(), selection.end());
-    std::reverse(selection.begin(), selection.end());
-    for (auto oneItem : selection) {
-        removeRow(oneItem);
+    selection.erase(std::unique(selection.begin(), selection.end()), selection.end());
+
+    auto ranges = QList<QPair<int, int>>();
+
+    for (auto itRow = selection.crbegin(); itRow != selection.crend(); ++itRow) {
+        if (*itRow < 0 || *itRow >= d->mData.size()) {
+            continue;
+        }
+
+        if (!ranges.isEmpty() && ranges.last().first == *itRow + 1) {
+            ranges.last().first = *itRow;
+        } else {
+            ranges.push_back({*itRow, *itRow});
+        }
     }
+
+    removeRanges(ranges);
 }
 
 void MediaPlayList::albumAdded(const QList<MusicAudioTrack> &tracks)
@@ -731,6 +1090,7 @@ void MediaPlayList::albumAdded(const QList<MusicAudioTrack> &tracks)
         oneEntry.mId = tracks.first().databaseId();
         oneEntry.mIsValid = true;
         oneEntry.mIsArtist = false;
+        d->indexRow(playListIndex);
 
         Q_EMIT dataChanged(index(playListIndex, 0), index(playListIndex, 0), {});
 
@@ -739,11 +1099,14 @@ void MediaPlayList::albumAdded(const QList<MusicAudioTrack> &tracks)
         }
 
         if (tracks.size() > 1) {
+            const auto firstNewRow = d->mData.size();
+
             beginInsertRows(QModelIndex(), playListIndex + 1, playListIndex - 1 + tracks.size());
             for (int trackIndex = 1; trackIndex < tracks.size(); ++trackIndex) {
                 d->mData.push_back(MediaPlayListEntry{tracks[trackIndex].databaseId()});
                 d->mTrackData.push_back(tracks[trackIndex]);
             }
+            d->indexRows(firstNewRow, d->mData.size() - 1);
             endInsertRows();
 
             restorePlayListPosition();
@@ -760,7 +1123,9 @@ void MediaPlayList::albumAdded(const QList<MusicAudioTrack> &tracks)
 
 void MediaPlayList::trackChanged(const MusicAudioTrack &track)
 {
-    for (int i = 0; i < d->mData.size(); ++i) {
+    const auto &candidateRows = d->rowsForTrack(track);
+
+    for (auto i : candidateRows) {
         auto &oneEntry = d->mData[i];
 
         if (!oneEntry.mIsArtist && oneEntry.mIsValid) {
@@ -773,7 +1138,13 @@ void MediaPlayList::trackChanged(const MusicAudioTrack &track)
             }
 
             if (d->mTrackData[i] != track) {
+                d->unindexRow(i);
                 d->mTrackData[i] = track;
+                if (oneEntry.mId != 0) {
+                    // the id restored from the play list store may be stale
+                    oneEntry.mId = track.databaseId();
+                }
+                d->indexRow(i);
 
                 Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
 
@@ -799,9 +1170,11 @@ void MediaPlayList::trackChanged(const MusicAudioTrack &track)
                 continue;
             }
 
+            d->unindexRow(i);
             d->mTrackData[i] = track;
             oneEntry.mId = track.databaseId();
             oneEntry.mIsValid = true;
+            d->indexRow(i);
 
             Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
 
@@ -811,15 +1184,15 @@ void MediaPlayList::trackChanged(const MusicAudioTrack &track)
 
             break;
         } else if (!oneEntry.mIsArtist && !oneEntry.mIsValid && oneEntry.mTrackUrl.isValid()) {
-            qDebug() << "MediaPlayList::trackChanged" << oneEntry << track;
-            qDebug() << "MediaPlayList::trackChanged" << track.resourceURI() << oneEntry.mTrackUrl;
             if (track.resourceURI() != oneEntry.mTrackUrl) {
                 continue;
             }
 
+            d->unindexRow(i);
             d->mTrackData[i] = track;
             oneEntry.mId = track.databaseId();
             oneEntry.mIsValid = true;
+            d->indexRow(i);
 
             Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
 
@@ -836,17 +1209,22 @@ void MediaPlayList::trackChanged(const MusicAudioTrack &track)
 
 void MediaPlayList::trackRemoved(qulonglong trackId)
 {
-    for (int i = 0; i < d->mData.size(); ++i) {
+    auto candidateRows = d->mRowsById.values(trackId);
+    std::sort(candidateRows.begin(), candidateRows.end());
+
+    for (auto i : candidateRows) {
         auto &oneEntry = d->mData[i];
 
         if (oneEntry.mIsValid) {
             if (oneEntry.mId == trackId) {
+                d->unindexRow(i);
                 oneEntry.mIsValid = false;
                 oneEntry.mTitle = d->mTrackData[i].title();
                 oneEntry.mArtist = d->mTrackData[i].artist();
                 oneEntry.mAlbum = d->mTrackData[i].albumName();
                 oneEntry.mTrackNumber = d->mTrackData[i].trackNumber();
                 oneEntry.mDiscNumber = d->mTrackData[i].discNumber();
+                d->indexRow(i);
 
                 Q_EMIT dataChanged(index(i, 0), index(i, 0), {});
 
@@ -965,7 +1343,11 @@ void MediaPlayList::trackInError(QUrl sourceInError, QMediaPlayer::Error playerE
 {
     Q_UNUSED(playerError)
 
-    for (int i = 0; i < d->mData.size(); ++i) {
+    auto candidateRows = d->mRowsByUrl.values(sourceInError);
+    std::sort(candidateRows.begin(), candidateRows.end());
+    candidateRows.erase(std::unique(candidateRows.begin(), candidateRows.end()), candidateRows.end());
+
+    for (auto i : candidateRows) {
         auto &oneTrack = d->mData[i];
         if (oneTrack.mIsValid) {
             const auto &oneTrackData = d->mTrackData.at(i);
@@ -978,6 +1360,82 @@ void MediaPlayList::trackInError(QUrl sourceInError, QMediaPlayer::Error playerE
     }
 }
 
+void MediaPlayList::removeRanges(const QList<QPair<int, int>> &ranges)
+{
+    if (ranges.isEmpty()) {
+        return;
+    }
+
+    const auto firstRemovedRow = ranges.last().first;
+
+    auto hadAlbumHeader = QVector<bool>();
+    hadAlbumHeader.reserve(ranges.size());
+    for (const auto &oneRange : ranges) {
+        hadAlbumHeader.push_back(rowHasHeader(oneRange.second + 1));
+    }
+
+    const auto previousCurrentRow = d->mCurrentTrack.isValid() ? d->mCurrentTrack.row() : -1;
+
+    d->unindexRows(firstRemovedRow, d->mData.size() - 1);
+
+    for (const auto &oneRange : ranges) {
+        beginRemoveRows({}, oneRange.first, oneRange.second);
+        d->mData.erase(d->mData.begin() + oneRange.first, d->mData.begin() + oneRange.second + 1);
+        d->mTrackData.erase(d->mTrackData.begin() + oneRange.first, d->mTrackData.begin() + oneRange.second + 1);
+        endRemoveRows();
+    }
+
+    if (!d->mCurrentTrack.isValid()) {
+        auto nextCurrentRow = d->mCurrentPlayListPosition;
+
+        if (previousCurrentRow != -1) {
+            // the removed current track is replaced by the first row following it
+            nextCurrentRow = previousCurrentRow;
+            for (const auto &oneRange : ranges) {
+                if (oneRange.first <= previousCurrentRow) {
+                    nextCurrentRow -= std::min(oneRange.second + 1, previousCurrentRow) - oneRange.first;
+                }
+            }
+        }
+
+        d->mCurrentTrack = index(nextCurrentRow, 0);
+
+        if (d->mCurrentTrack.isValid()) {
+            notifyCurrentTrackChanged();
+        }
+
+        if (!d->mCurrentTrack.isValid()) {
+            Q_EMIT playListFinished();
+            resetCurrentTrack();
+            if (!d->mCurrentTrack.isValid()) {
+                notifyCurrentTrackChanged();
+            }
+        }
+    }
+
+    d->indexRows(firstRemovedRow, d->mData.size() - 1);
+
+    Q_EMIT tracksCountChanged();
+
+    auto removedRowsCount = 0;
+    for (int rangeIndex = ranges.size() - 1; rangeIndex >= 0; --rangeIndex) {
+        const auto &oneRange = ranges[rangeIndex];
+        const auto nextRow = oneRange.first - removedRowsCount;
+
+        removedRowsCount += oneRange.second - oneRange.first + 1;
+
+        if (hadAlbumHeader[rangeIndex] != rowHasHeader(nextRow)) {
+            Q_EMIT dataChanged(index(nextRow, 0), index(nextRow, 0), {ColumnsRoles::HasAlbumHeader});
+
+            if (!d->mCurrentTrack.isValid()) {
+                resetCurrentTrack();
+            }
+        }
+    }
+
+    Q_EMIT persistentStateChanged();
+}
+
 bool MediaPlayList::rowHasHeader(int row) const
 {
     if (row >= rowCount()) {
@@ -1043,6 +1501,26 @@ void MediaPlayList::loadPlayListLoadFailed()
     Q_EMIT playListLoadFailed();
 }
 
+void MediaPlayList::schedulePlayListStoreSave()
+{
+    if (d->mPlayListStore.fileName().isEmpty() || d->mPlayListStoreTimer.isActive()) {
+        return;
+    }
+
+    d->mPlayListStoreTimer.start();
+}
+
+void MediaPlayList::savePlayListStore()
+{
+    d->mPlayListStoreTimer.stop();
+
+    if (d->mPlayListStore.fileName().isEmpty()) {
+        return;
+    }
+
+    d->mPlayListStore.save(d->mData, d->mTrackData, d->mCurrentPlayListPosition, d->mRandomPlay, d->mRepeatPlay);
+}
+
 void MediaPlayList::resetCurrentTrack()
 {
     for(int row = 0; row < rowCount(); ++row) {
@@ -26,7 +26,9 @@
 
 #include <QAbstractListModel>
 #include <QVector>
+#include <QPair>
 #include <utility>
+#include <memory>
 #include <QMediaPlayer>
 
 class MediaPlayListPrivate;
@@ -139,14 +141,32 @@ public:
 
     bool repeatPlay() const;
 
+    void enqueue(const QVector<MediaPlayListEntry> &newEntries, const QVector<MusicAudioTrack> &audioTracks = {});
+
+    void enqueue(const QList<qulonglong> &newTrackIds);
+
+    QString playListStoreFileName() const;
+
+    void setPlayListStoreFileName(const QString &fileName);
+
 Q_SIGNALS:
 
     void newTrackByNameInList(const QString &title, const QString &artist, const QString &album, int trackNumber, int discNumber);
 
     void newTrackByFileNameInList(const QUrl &fileName);
 
+    void newTracksByFileNameInList(const QList<QUrl> &fileNames);
+
+    void newFileNamesToExpandInList(const QStringList &fileNames);
+
     void newTrackByIdInList(qulonglong newTrackId);
 
+    void newTracksByIdInList(const QList<qulonglong> &newTrackIds);
+
+    void newTracksByNameInList(const QList<MusicAudioTrack> &tracks);
+
+    void newTracksByIdOrFileNameInList(const QList<qulonglong> &trackIds, const QList<QUrl> &fileNames);
+
     void newArtistInList(const QString &artist);
 
     void trackHasBeenAdded(const QString &title, const QUrl &image);
@@ -215,6 +235,8 @@ public Q_SLOTS:
 
     void enqueue(const QStringList &files);
 
+    void enqueueFileNames(const QList<QUrl> &allFiles);
+
     void clearAndEnqueue(qulonglong newTrackId);
 
     void clearAndEnqueue(const MusicAudioTrack &newTrack);
@@ -237,8 +259,18 @@ private Q_SLOTS:
 
     void loadPlayListLoadFailed();
 
+    void schedulePlayListStoreSave();
+
+    void savePlayListStore();
+
+    void playListStoreLoaded();
+
 private:
 
+    void insertEntries(int firstNewRow, const QVector<MediaPlayListEntry> &newEntries, const QVector<MusicAudioTrack> &audioTracks);
+
+    void removeRanges(const QList<QPair<int, int>> &ranges);
+
     void resetCurrentTrack();
 
     void notifyCurrentTrackChanged();
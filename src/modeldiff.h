@@ -0,0 +1,246 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef MODELDIFF_H
+#define MODELDIFF_H
+
+#include "musicalbum.h"
+#include "musicaudiotrack.h"
+
+#include <QVector>
+#include <QList>
+#include <QHash>
+#include <QMap>
+#include <QPair>
+#include <QVariant>
+#include <QMetaType>
+
+#include <algorithm>
+
+/**
+ * Values shown by the views that are costly to compute, built once per item by LibraryDiffWorker::buildDisplayData.
+ */
+template <typename Item>
+class ModelDisplayData;
+
+template <>
+class ModelDisplayData<MusicAudioTrack>
+{
+public:
+
+    QVariant mDuration;
+
+    QVariant mImage;
+
+    QVariant mResource;
+
+};
+
+template <>
+class ModelDisplayData<MusicAlbum>
+{
+public:
+
+    QVariant mAllTracksTitle;
+
+    QVariant mAllArtists;
+
+    QVariant mImage;
+
+};
+
+/**
+ * Row operations to apply to a list model, in this order: removals, insertions at the end and modifications.
+ */
+template <typename Item>
+class ModelDiff
+{
+public:
+
+    bool isEmpty() const
+    {
+        return mRemovedRanges.isEmpty() && mInsertedItems.isEmpty() && mModifiedRows.isEmpty();
+    }
+
+    /**
+     * Removed rows as first and last row, from the last range to the first one.
+     */
+    QVector<QPair<int, int>> mRemovedRanges;
+
+    QVector<Item> mInsertedItems;
+
+    /**
+     * Modified rows after the removals and insertions, sorted by row.
+     */
+    QVector<QPair<int, Item>> mModifiedRows;
+
+    QVector<ModelDisplayData<Item>> mInsertedDisplayData;
+
+    QVector<ModelDisplayData<Item>> mModifiedDisplayData;
+
+};
+
+/**
+ * Rows of a list model identified by database id, used to compute a ModelDiff without touching the model itself.
+ * The owner of the model applies each diff back with applyDiff once the model has been updated.
+ */
+template <typename Item>
+class ModelShadow
+{
+public:
+
+    bool contains(qulonglong databaseId) const
+    {
+        return mRowById.contains(databaseId);
+    }
+
+    int size() const
+    {
+        return mIds.size();
+    }
+
+    void clear()
+    {
+        mIds.clear();
+        mRowById.clear();
+    }
+
+    ModelDiff<Item> computeDiff(const QList<qulonglong> &removedIds, const QList<Item> &addedItems, const QList<Item> &modifiedItems) const
+    {
+        auto result = ModelDiff<Item>();
+
+        auto removedRows = QVector<int>();
+        removedRows.reserve(removedIds.size());
+
+        for (auto oneId : removedIds) {
+            auto itRow = mRowById.constFind(oneId);
+            if (itRow == mRowById.constEnd()) {
+                continue;
+            }
+
+            removedRows.push_back(itRow.value());
+        }
+
+        std::sort(removedRows.begin(), removedRows.end());
+        removedRows.erase(std::unique(removedRows.begin(), removedRows.end()), removedRows.end());
+
+        auto lastRow = removedRows.size() - 1;
+        while (lastRow >= 0) {
+            auto firstRow = lastRow;
+            while (firstRow > 0 && removedRows[firstRow - 1] == removedRows[firstRow] - 1) {
+                --firstRow;
+            }
+
+            result.mRemovedRanges.push_back({removedRows[firstRow], removedRows[lastRow]});
+
+            lastRow = firstRow - 1;
+        }
+
+        auto isRemovedRow = [&removedRows](int row) {
+            return std::binary_search(removedRows.begin(), removedRows.end(), row);
+        };
+
+        const auto keptCount = mIds.size() - removedRows.size();
+        auto insertedRowById = QHash<qulonglong, int>();
+
+        result.mInsertedItems.reserve(addedItems.size());
+
+        for (const auto &oneItem : addedItems) {
+            if (!oneItem.isValid() || insertedRowById.contains(oneItem.databaseId())) {
+                continue;
+            }
+
+            auto itRow = mRowById.constFind(oneItem.databaseId());
+            if (itRow != mRowById.constEnd() && !isRemovedRow(itRow.value())) {
+                continue;
+            }
+
+            insertedRowById[oneItem.databaseId()] = keptCount + result.mInsertedItems.size();
+            result.mInsertedItems.push_back(oneItem);
+        }
+
+        auto modifiedRows = QMap<int, Item>();
+
+        for (const auto &oneItem : modifiedItems) {
+            auto itInserted = insertedRowById.constFind(oneItem.databaseId());
+            if (itInserted != insertedRowById.constEnd()) {
+                modifiedRows[itInserted.value()] = oneItem;
+                continue;
+            }
+
+            auto itRow = mRowById.constFind(oneItem.databaseId());
+            if (itRow == mRowById.constEnd() || isRemovedRow(itRow.value())) {
+                continue;
+            }
+
+            const auto removedBefore = static_cast<int>(std::lower_bound(removedRows.begin(), removedRows.end(), itRow.value()) - removedRows.begin());
+            modifiedRows[itRow.value() - removedBefore] = oneItem;
+        }
+
+        result.mModifiedRows.reserve(modifiedRows.size());
+
+        for (auto itModified = modifiedRows.constBegin(); itModified != modifiedRows.constEnd(); ++itModified) {
+            result.mModifiedRows.push_back({itModified.key(), itModified.value()});
+        }
+
+        return result;
+    }
+
+    void applyDiff(const ModelDiff<Item> &changes)
+    {
+        auto firstChangedRow = mIds.size();
+
+        for (const auto &oneRange : changes.mRemovedRanges) {
+            for (int row = oneRange.first; row <= oneRange.second; ++row) {
+                mRowById.remove(mIds[row]);
+            }
+
+            mIds.remove(oneRange.first, oneRange.second - oneRange.first + 1);
+            firstChangedRow = std::min(firstChangedRow, oneRange.first);
+        }
+
+        firstChangedRow = std::min(firstChangedRow, mIds.size());
+
+        mIds.reserve(mIds.size() + changes.mInsertedItems.size());
+        for (const auto &oneItem : changes.mInsertedItems) {
+            mIds.push_back(oneItem.databaseId());
+        }
+
+        for (int row = firstChangedRow; row < mIds.size(); ++row) {
+            mRowById[mIds[row]] = row;
+        }
+    }
+
+private:
+
+    QVector<qulonglong> mIds;
+
+    QHash<qulonglong, int> mRowById;
+
+};
+
+using TracksModelDiff = ModelDiff<MusicAudioTrack>;
+
+using AlbumsModelDiff = ModelDiff<MusicAlbum>;
+
+Q_DECLARE_METATYPE(TracksModelDiff)
+
+Q_DECLARE_METATYPE(AlbumsModelDiff)
+
+#endif // MODELDIFF_H
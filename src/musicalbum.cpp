@@ -19,16 +19,19 @@
 
 #include "musicalbum.h"
 
+#include "stringpool.h"
+
 #include <algorithm>
 
 #include <QList>
 #include <QString>
 #include <QUrl>
 #include <QMap>
+#include <QSharedData>
 
 #include <QDebug>
 
-class MusicAlbumPrivate
+class MusicAlbumPrivate : public QSharedData
 {
 public:
 
@@ -56,37 +59,21 @@ public:
 
 };
 
-MusicAlbum::MusicAlbum() : d(std::make_unique<MusicAlbumPrivate>())
+MusicAlbum::MusicAlbum() : d(new MusicAlbumPrivate)
 {
 }
 
 MusicAlbum::MusicAlbum(MusicAlbum &&other)
-{
-    d.swap(other.d);
-}
+= default;
 
-MusicAlbum::MusicAlbum(const MusicAlbum &other) : d(std::make_unique<MusicAlbumPrivate>(*other.d))
-{
-}
+MusicAlbum::MusicAlbum(const MusicAlbum &other)
+= default;
 
 MusicAlbum& MusicAlbum::operator=(MusicAlbum &&other)
-{
-    if (&other != this) {
-        d.reset();
-        d.swap(other.d);
-    }
-
-    return *this;
-}
+= default;
 
 MusicAlbum& MusicAlbum::operator=(const MusicAlbum &other)
-{
-    if (&other != this) {
-        (*d) = (*other.d);
-    }
-
-    return *this;
-}
+= default;
 
 MusicAlbum::~MusicAlbum()
 = default;
@@ -143,7 +130,7 @@ int MusicAlbum::tracksCount() const
 
 void MusicAlbum::setTitle(const QString &value)
 {
-    d->mTitle = value;
+    d->mTitle = StringPool::intern(value);
 }
 
 QString MusicAlbum::title() const
@@ -153,7 +140,7 @@ QString MusicAlbum::title() const
 
 void MusicAlbum::setArtist(const QString &value)
 {
-    d->mArtist = value;
+    d->mArtist = StringPool::intern(value);
 }
 
 QString MusicAlbum::artist() const
@@ -28,7 +28,7 @@
 #include <QStringList>
 #include <QMetaType>
 
-#include <memory>
+#include <QSharedDataPointer>
 
 class MusicAlbumPrivate;
 class QDebug;
@@ -118,7 +118,7 @@ public:
 
 private:
 
-    std::unique_ptr<MusicAlbumPrivate> d;
+    QSharedDataPointer<MusicAlbumPrivate> d;
 
 };
 
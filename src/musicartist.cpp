@@ -19,11 +19,14 @@
 
 #include "musicartist.h"
 
+#include "stringpool.h"
+
 #include <QtGlobal>
 #include <QString>
 #include <QDebug>
+#include <QSharedData>
 
-class MusicArtistPrivate
+class MusicArtistPrivate : public QSharedData
 {
 public:
 
@@ -37,37 +40,21 @@ public:
 
 };
 
-MusicArtist::MusicArtist() : d(std::make_unique<MusicArtistPrivate>())
+MusicArtist::MusicArtist() : d(new MusicArtistPrivate)
 {
 }
 
 MusicArtist::MusicArtist(MusicArtist &&other)
-{
-    d.swap(other.d);
-}
+= default;
 
-MusicArtist::MusicArtist(const MusicArtist &other) : d(std::make_unique<MusicArtistPrivate>(*other.d))
-{
-}
+MusicArtist::MusicArtist(const MusicArtist &other)
+= default;
 
 MusicArtist& MusicArtist::operator=(MusicArtist &&other)
-{
-    if (&other != this) {
-        d.reset();
-        d.swap(other.d);
-    }
-
-    return *this;
-}
+= default;
 
 MusicArtist &MusicArtist::operator=(const MusicArtist &other)
-{
-    if (&other != this) {
-        (*d) = (*other.d);
-    }
-
-    return *this;
-}
+= default;
 
 MusicArtist::~MusicArtist()
 = default;
@@ -84,7 +71,7 @@ bool MusicArtist::isValid() const
 
 void MusicArtist::setName(const QString &aName)
 {
-    d->mName = aName;
+    d->mName = StringPool::intern(aName);
 }
 
 QString MusicArtist::name() const
@@ -23,7 +23,7 @@
 #include <QString>
 #include <QMetaType>
 
-#include <memory>
+#include <QSharedDataPointer>
 
 class MusicArtistPrivate;
 class QDebug;
@@ -62,7 +62,7 @@ public:
 
 private:
 
-    std::unique_ptr<MusicArtistPrivate> d;
+    QSharedDataPointer<MusicArtistPrivate> d;
 
 };
 
@@ -19,10 +19,14 @@
 
 #include "musicaudiotrack.h"
 
+#include "stringpool.h"
+
 #include <QDebug>
+#include <QDataStream>
+#include <QSharedData>
 #include <utility>
 
-class MusicAudioTrackPrivate
+class MusicAudioTrackPrivate : public QSharedData
 {
 public:
 
@@ -34,8 +38,8 @@ public:
                            QString aTitle, QString aArtist, QString aAlbumName,
                            QString aAlbumArtist, int aTrackNumber, QTime aDuration,
                            QUrl aResourceURI, QUrl aAlbumCover, int rating, bool aIsSingleDiscAlbum)
-        : mId(std::move(aId)), mParentId(std::move(aParentId)), mTitle(std::move(aTitle)), mArtist(std::move(aArtist)),
-          mAlbumName(std::move(aAlbumName)), mAlbumArtist(std::move(aAlbumArtist)), mTrackNumber(aTrackNumber),
+        : mId(std::move(aId)), mParentId(std::move(aParentId)), mTitle(std::move(aTitle)), mArtist(StringPool::intern(aArtist)),
+          mAlbumName(StringPool::intern(aAlbumName)), mAlbumArtist(StringPool::intern(aAlbumArtist)), mTrackNumber(aTrackNumber),
           mDuration(aDuration), mResourceURI(std::move(aResourceURI)), mAlbumCover(std::move(aAlbumCover)),
           mRating(rating), mIsValid(aValid), mIsSingleDiscAlbum(aIsSingleDiscAlbum)
     {
@@ -45,8 +49,8 @@ public:
                            QString aTitle, QString aArtist, QString aAlbumName, QString aAlbumArtist,
                            int aTrackNumber, int aDiscNumber, QTime aDuration, QUrl aResourceURI,
                            QUrl aAlbumCover, int rating, bool aIsSingleDiscAlbum)
-        : mId(std::move(aId)), mParentId(std::move(aParentId)), mTitle(std::move(aTitle)), mArtist(std::move(aArtist)),
-          mAlbumName(std::move(aAlbumName)), mAlbumArtist(std::move(aAlbumArtist)), mTrackNumber(aTrackNumber),
+        : mId(std::move(aId)), mParentId(std::move(aParentId)), mTitle(std::move(aTitle)), mArtist(StringPool::intern(aArtist)),
+          mAlbumName(StringPool::intern(aAlbumName)), mAlbumArtist(StringPool::intern(aAlbumArtist)), mTrackNumber(aTrackNumber),
           mDiscNumber(aDiscNumber), mDuration(aDuration), mResourceURI(std::move(aResourceURI)),
           mAlbumCover(std::move(aAlbumCover)), mRating(rating), mIsValid(aValid), mIsSingleDiscAlbum(aIsSingleDiscAlbum)
     {
@@ -84,7 +88,7 @@ public:
 
 };
 
-MusicAudioTrack::MusicAudioTrack() : d(std::make_unique<MusicAudioTrackPrivate>())
+MusicAudioTrack::MusicAudioTrack() : d(new MusicAudioTrackPrivate)
 {
 }
 
@@ -92,9 +96,9 @@ MusicAudioTrack::MusicAudioTrack(bool aValid, const QString &aId, const QString
                                  const QString &aTitle, const QString &aArtist, const QString &aAlbumName, const QString &aAlbumArtist,
                                  int aTrackNumber, QTime aDuration, const QUrl &aResourceURI, const QUrl &aAlbumCover, int rating,
                                  bool aIsSingleDiscAlbum)
-    : d(std::make_unique<MusicAudioTrackPrivate>(aValid, aId, aParentId, aTitle, aArtist, aAlbumName,
-                                                 aAlbumArtist, aTrackNumber, aDuration, aResourceURI, aAlbumCover,
-                                                 rating, aIsSingleDiscAlbum))
+    : d(new MusicAudioTrackPrivate(aValid, aId, aParentId, aTitle, aArtist, aAlbumName,
+                                   aAlbumArtist, aTrackNumber, aDuration, aResourceURI, aAlbumCover,
+                                   rating, aIsSingleDiscAlbum))
 {
 }
 
@@ -103,42 +107,26 @@ MusicAudioTrack::MusicAudioTrack(bool aValid, const QString &aId, const QString
                                  const QString &aAlbumArtist, int aTrackNumber, int aDiscNumber,
                                  QTime aDuration, const QUrl &aResourceURI, const QUrl &aAlbumCover, int rating,
                                  bool aIsSingleDiscAlbum)
-    : d(std::make_unique<MusicAudioTrackPrivate>(aValid, aId, aParentId, aTitle, aArtist, aAlbumName, aAlbumArtist,
-                                                 aTrackNumber, aDiscNumber, aDuration, aResourceURI, aAlbumCover, rating,
-                                                 aIsSingleDiscAlbum))
+    : d(new MusicAudioTrackPrivate(aValid, aId, aParentId, aTitle, aArtist, aAlbumName, aAlbumArtist,
+                                   aTrackNumber, aDiscNumber, aDuration, aResourceURI, aAlbumCover, rating,
+                                   aIsSingleDiscAlbum))
 {
 }
 
 MusicAudioTrack::MusicAudioTrack(MusicAudioTrack &&other)
-{
-    d.swap(other.d);
-}
+= default;
 
-MusicAudioTrack::MusicAudioTrack(const MusicAudioTrack &other) : d(std::make_unique<MusicAudioTrackPrivate>(*other.d))
-{
-}
+MusicAudioTrack::MusicAudioTrack(const MusicAudioTrack &other)
+= default;
 
 MusicAudioTrack::~MusicAudioTrack()
 = default;
 
 MusicAudioTrack& MusicAudioTrack::operator=(MusicAudioTrack &&other)
-{
-    if (this != &other) {
-        d.reset();
-        d.swap(other.d);
-    }
-
-    return *this;
-}
+= default;
 
 MusicAudioTrack& MusicAudioTrack::operator=(const MusicAudioTrack &other)
-{
-    if (this != &other) {
-        (*d) = (*other.d);
-    }
-
-    return *this;
-}
+= default;
 
 bool MusicAudioTrack::operator <(const MusicAudioTrack &other) const
 {
@@ -183,7 +171,7 @@ qulonglong MusicAudioTrack::databaseId() const
     return d->mDatabaseId;
 }
 
-void MusicAudioTrack::setId(const QString &value) const
+void MusicAudioTrack::setId(const QString &value)
 {
     d->mId = value;
 }
@@ -193,7 +181,7 @@ QString MusicAudioTrack::id() const
     return d->mId;
 }
 
-void MusicAudioTrack::setParentId(const QString &value) const
+void MusicAudioTrack::setParentId(const QString &value)
 {
     d->mParentId = value;
 }
@@ -203,7 +191,7 @@ QString MusicAudioTrack::parentId() const
     return d->mParentId;
 }
 
-void MusicAudioTrack::setTitle(const QString &value) const
+void MusicAudioTrack::setTitle(const QString &value)
 {
     d->mTitle = value;
 }
@@ -213,9 +201,9 @@ QString MusicAudioTrack::title() const
     return d->mTitle;
 }
 
-void MusicAudioTrack::setArtist(const QString &value) const
+void MusicAudioTrack::setArtist(const QString &value)
 {
-    d->mArtist = value;
+    d->mArtist = StringPool::intern(value);
 }
 
 QString MusicAudioTrack::artist() const
@@ -223,9 +211,9 @@ QString MusicAudioTrack::artist() const
     return d->mArtist;
 }
 
-void MusicAudioTrack::setAlbumName(const QString &value) const
+void MusicAudioTrack::setAlbumName(const QString &value)
 {
-    d->mAlbumName = value;
+    d->mAlbumName = StringPool::intern(value);
 }
 
 QString MusicAudioTrack::albumName() const
@@ -233,9 +221,9 @@ QString MusicAudioTrack::albumName() const
     return d->mAlbumName;
 }
 
-void MusicAudioTrack::setAlbumArtist(const QString &value) const
+void MusicAudioTrack::setAlbumArtist(const QString &value)
 {
-    d->mAlbumArtist = value;
+    d->mAlbumArtist = StringPool::intern(value);
 }
 
 QString MusicAudioTrack::albumArtist() const
@@ -248,7 +236,7 @@ bool MusicAudioTrack::isValidAlbumArtist() const
     return !d->mAlbumArtist.isEmpty();
 }
 
-void MusicAudioTrack::setAlbumCover(const QUrl &value) const
+void MusicAudioTrack::setAlbumCover(const QUrl &value)
 {
     d->mAlbumCover = value;
 }
@@ -298,7 +286,7 @@ const QUrl &MusicAudioTrack::resourceURI() const
     return d->mResourceURI;
 }
 
-void MusicAudioTrack::setRating(int value) const
+void MusicAudioTrack::setRating(int value)
 {
     d->mRating = value;
 }
@@ -323,3 +311,39 @@ QDebug operator<<(QDebug stream, const MusicAudioTrack &data)
     stream << data.title() << data.artist() << data.albumName() << data.albumArtist() << data.duration();
     return stream;
 }
+
+QDataStream &operator<<(QDataStream &stream, const MusicAudioTrack &data)
+{
+    stream << data.isValid() << data.databaseId() << data.id() << data.parentId() << data.title() << data.artist()
+           << data.albumName() << data.albumArtist() << qint32(data.trackNumber()) << qint32(data.discNumber())
+           << data.duration() << data.resourceURI() << data.albumCover() << qint32(data.rating()) << data.isSingleDiscAlbum();
+    return stream;
+}
+
+QDataStream &operator>>(QDataStream &stream, MusicAudioTrack &data)
+{
+    bool isValid = false;
+    qulonglong databaseId = 0;
+    QString id;
+    QString parentId;
+    QString title;
+    QString artist;
+    QString albumName;
+    QString albumArtist;
+    qint32 trackNumber = 0;
+    qint32 discNumber = 0;
+    QTime duration;
+    QUrl resourceURI;
+    QUrl albumCover;
+    qint32 rating = 0;
+    bool isSingleDiscAlbum = false;
+
+    stream >> isValid >> databaseId >> id >> parentId >> title >> artist >> albumName >> albumArtist
+           >> trackNumber >> discNumber >> duration >> resourceURI >> albumCover >> rating >> isSingleDiscAlbum;
+
+    data = MusicAudioTrack(isValid, id, parentId, title, artist, albumName, albumArtist, trackNumber, discNumber,
+                           duration, resourceURI, albumCover, rating, isSingleDiscAlbum);
+    data.setDatabaseId(databaseId);
+
+    return stream;
+}
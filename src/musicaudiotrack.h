@@ -25,10 +25,11 @@
 #include <QUrl>
 #include <QMetaType>
 
-#include <memory>
+#include <QSharedDataPointer>
 
 class MusicAudioTrackPrivate;
 class QDebug;
+class QDataStream;
 
 class MusicAudioTrack
 {
@@ -69,33 +70,33 @@ public:
 
     qulonglong databaseId() const;
 
-    void setId(const QString &value) const;
+    void setId(const QString &value);
 
     QString id() const;
 
-    void setParentId(const QString &value) const;
+    void setParentId(const QString &value);
 
     QString parentId() const;
 
-    void setTitle(const QString &value) const;
+    void setTitle(const QString &value);
 
     QString title() const;
 
-    void setArtist(const QString &value) const;
+    void setArtist(const QString &value);
 
     QString artist() const;
 
-    void setAlbumName(const QString &value) const;
+    void setAlbumName(const QString &value);
 
     QString albumName() const;
 
-    void setAlbumArtist(const QString &value) const;
+    void setAlbumArtist(const QString &value);
 
     QString albumArtist() const;
 
     bool isValidAlbumArtist() const;
 
-    void setAlbumCover(const QUrl &value) const;
+    void setAlbumCover(const QUrl &value);
 
     QUrl albumCover() const;
 
@@ -115,7 +116,7 @@ public:
 
     const QUrl& resourceURI() const;
 
-    void setRating(int value) const;
+    void setRating(int value);
 
     int rating() const;
 
@@ -125,12 +126,16 @@ public:
 
 private:
 
-    std::unique_ptr<MusicAudioTrackPrivate> d;
+    QSharedDataPointer<MusicAudioTrackPrivate> d;
 
 };
 
 QDebug operator<<(QDebug stream, const MusicAudioTrack &data);
 
+QDataStream& operator<<(QDataStream &stream, const MusicAudioTrack &data);
+
+QDataStream& operator>>(QDataStream &stream, MusicAudioTrack &data);
+
 Q_DECLARE_METATYPE(MusicAudioTrack)
 
 #endif // MUSICAUDIOTRACK_H
@@ -33,7 +33,10 @@
 #include "mediaplaylist.h"
 #include "file/filelistener.h"
 #include "file/localfilelisting.h"
+#include "abstractfile/scanscheduler.h"
+#include "abstractfile/extractorworker.h"
 #include "trackslistener.h"
+#include "librarydiffworker.h"
 #include "notificationitem.h"
 #include "elisaapplication.h"
 #include "elisa_settings.h"
@@ -74,8 +77,12 @@ public:
 
     DatabaseInterface mDatabaseInterface;
 
+    LibraryDiffWorker mLibraryDiffWorker;
+
     QFileSystemWatcher mConfigFileWatcher;
 
+    QString mPlayListStoreFileName;
+
     int mImportedTracksCount = 0;
 
     int mActiveMusicListenersCount = 0;
@@ -93,6 +100,7 @@ MusicListenersManager::MusicListenersManager(QObject *parent)
     d->mDatabaseThread.start();
 
     d->mDatabaseInterface.moveToThread(&d->mDatabaseThread);
+    d->mLibraryDiffWorker.moveToThread(&d->mDatabaseThread);
 
     connect(&d->mDatabaseInterface, &DatabaseInterface::requestsInitDone,
             this, &MusicListenersManager::databaseReady);
@@ -103,31 +111,53 @@ MusicListenersManager::MusicListenersManager(QObject *parent)
         QDir myDataDirectory;
         myDataDirectory.mkpath(localDataPaths.first());
         databaseFileName = localDataPaths.first() + QStringLiteral("/elisaDatabase.db");
+        d->mPlayListStoreFileName = localDataPaths.first() + QStringLiteral("/elisaPlayList.dat");
     }
 
     QMetaObject::invokeMethod(&d->mDatabaseInterface, "init", Qt::QueuedConnection,
                               Q_ARG(QString, QStringLiteral("listeners")), Q_ARG(QString, databaseFileName));
 
-    connect(&d->mDatabaseInterface, &DatabaseInterface::artistAdded,
-            this, &MusicListenersManager::artistAdded);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::albumAdded,
-            this, &MusicListenersManager::albumAdded);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::artistsAdded,
+            this, &MusicListenersManager::artistsAdded);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsAdded,
+            this, &MusicListenersManager::albumsAdded);
     connect(&d->mDatabaseInterface, &DatabaseInterface::trackAdded,
             this, &MusicListenersManager::trackAdded);
     connect(&d->mDatabaseInterface, &DatabaseInterface::tracksAdded,
             this, &MusicListenersManager::tracksAdded);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::artistRemoved,
-            this, &MusicListenersManager::artistRemoved);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::albumRemoved,
-            this, &MusicListenersManager::albumRemoved);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::artistsRemoved,
+            this, &MusicListenersManager::artistsRemoved);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsRemoved,
+            this, &MusicListenersManager::albumsRemoved);
     connect(&d->mDatabaseInterface, &DatabaseInterface::trackRemoved,
             this, &MusicListenersManager::trackRemoved);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::tracksRemoved,
+            this, &MusicListenersManager::tracksRemoved);
     connect(&d->mDatabaseInterface, &DatabaseInterface::artistModified,
             this, &MusicListenersManager::artistModified);
-    connect(&d->mDatabaseInterface, &DatabaseInterface::albumModified,
-            this, &MusicListenersManager::albumModified);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsModified,
+            this, &MusicListenersManager::albumsModified);
     connect(&d->mDatabaseInterface, &DatabaseInterface::trackModified,
             this, &MusicListenersManager::trackModified);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsFromArtistFetched,
+            this, &MusicListenersManager::albumsFromArtistFetched);
+
+    connect(&d->mDatabaseInterface, &DatabaseInterface::tracksAdded,
+            &d->mLibraryDiffWorker, &LibraryDiffWorker::tracksAdded);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::tracksRemoved,
+            &d->mLibraryDiffWorker, &LibraryDiffWorker::tracksRemoved);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::trackModified,
+            &d->mLibraryDiffWorker, &LibraryDiffWorker::trackModified);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsAdded,
+            &d->mLibraryDiffWorker, &LibraryDiffWorker::albumsAdded);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsRemoved,
+            &d->mLibraryDiffWorker, &LibraryDiffWorker::albumsRemoved);
+    connect(&d->mDatabaseInterface, &DatabaseInterface::albumsModified,
+            &d->mLibraryDiffWorker, &LibraryDiffWorker::albumsModified);
+    connect(&d->mLibraryDiffWorker, &LibraryDiffWorker::tracksChangesComputed,
+            this, &MusicListenersManager::tracksChangesComputed);
+    connect(&d->mLibraryDiffWorker, &LibraryDiffWorker::albumsChangesComputed,
+            this, &MusicListenersManager::albumsChangesComputed);
 
     connect(QCoreApplication::instance(), &QCoreApplication::aboutToQuit,
             this, &MusicListenersManager::applicationAboutToQuit);
@@ -172,10 +202,18 @@ void MusicListenersManager::subscribeForTracks(MediaPlayList *client)
     connect(helper, &TracksListener::trackHasChanged, client, &MediaPlayList::trackChanged);
     connect(helper, &TracksListener::trackHasBeenRemoved, client, &MediaPlayList::trackRemoved);
     connect(helper, &TracksListener::albumAdded, client, &MediaPlayList::albumAdded);
+    connect(helper, &TracksListener::fileNamesExpanded, client, &MediaPlayList::enqueueFileNames);
     connect(client, &MediaPlayList::newTrackByIdInList, helper, &TracksListener::trackByIdInList);
+    connect(client, &MediaPlayList::newTracksByIdInList, helper, &TracksListener::tracksByIdInList);
+    connect(client, &MediaPlayList::newTracksByNameInList, helper, &TracksListener::tracksByNameInList);
     connect(client, &MediaPlayList::newTrackByNameInList, helper, &TracksListener::trackByNameInList);
     connect(client, &MediaPlayList::newTrackByFileNameInList, helper, &TracksListener::trackByFileNameInList);
+    connect(client, &MediaPlayList::newTracksByFileNameInList, helper, &TracksListener::tracksByFileNameInList);
+    connect(client, &MediaPlayList::newTracksByIdOrFileNameInList, helper, &TracksListener::tracksByIdOrFileNameInList);
     connect(client, &MediaPlayList::newArtistInList, helper, &TracksListener::newArtistInList);
+    connect(client, &MediaPlayList::newFileNamesToExpandInList, helper, &TracksListener::expandFileNamesInList);
+
+    client->setPlayListStoreFileName(d->mPlayListStoreFileName);
 }
 
 int MusicListenersManager::importedTracksCount() const
@@ -198,6 +236,12 @@ void MusicListenersManager::databaseReady()
     configChanged();
 }
 
+void MusicListenersManager::fetchAlbumsFromArtist(const QString &artistName)
+{
+    QMetaObject::invokeMethod(&d->mDatabaseInterface, "fetchAlbumsFromArtist", Qt::QueuedConnection,
+                              Q_ARG(QString, artistName));
+}
+
 void MusicListenersManager::applicationAboutToQuit()
 {
     d->mDatabaseInterface.applicationAboutToQuit();
@@ -297,8 +341,18 @@ void MusicListenersManager::configChanged()
             &d->mUpnpListener, &UpnpListener::applicationAboutToQuit, Qt::DirectConnection);
 #endif
 
+    ScanScheduler::instance().setBytesPerSecond(currentConfiguration->scanBytesPerSecond());
+    ScanScheduler::instance().setFilesPerSecond(currentConfiguration->scanFilesPerSecond());
+
+    ExtractorWorker::setEnabled(currentConfiguration->externalExtraction());
+    ExtractorWorker::setTimeout(1000 * currentConfiguration->extractionTimeout());
+
     if (currentConfiguration->elisaFilesIndexer())
     {
+        const auto pollingInterval = 1000 * currentConfiguration->pollingInterval();
+        const auto pollingJitter = 1000 * currentConfiguration->pollingJitter();
+        const auto forcePolling = currentConfiguration->forcePolling();
+
         const auto &allRootPaths = currentConfiguration->rootPath();
         for (auto itFileListener = d->mFileListener.begin(); itFileListener != d->mFileListener.end(); ) {
             const auto &currentRootPath = (*itFileListener)->localFileIndexer().rootPath();
@@ -308,6 +362,7 @@ void MusicListenersManager::configChanged()
                 d->mDatabaseInterface.removeAllTracksFromSource((*itFileListener)->fileListing()->sourceName());
                 itFileListener = d->mFileListener.erase(itFileListener);
             } else {
+                (*itFileListener)->setPollingParameters(pollingInterval, pollingJitter, forcePolling);
                 ++itFileListener;
             }
         }
@@ -334,6 +389,7 @@ void MusicListenersManager::configChanged()
                         this, &MusicListenersManager::closeNotification);
 
                 newFileIndexer->setRootPath(oneRootPath);
+                newFileIndexer->setPollingParameters(pollingInterval, pollingJitter, forcePolling);
 
                 QMetaObject::invokeMethod(newFileIndexer.get(), "performInitialScan", Qt::QueuedConnection);
 
@@ -30,6 +30,7 @@
 #include "musicalbum.h"
 #include "musicartist.h"
 #include "musicaudiotrack.h"
+#include "modeldiff.h"
 
 #include <memory>
 
@@ -81,26 +82,34 @@ Q_SIGNALS:
 
     void viewDatabaseChanged();
 
-    void artistAdded(const MusicArtist &newArtist);
+    void artistsAdded(const QList<MusicArtist> &newArtists);
 
-    void albumAdded(const MusicAlbum &newAlbum);
+    void albumsAdded(const QList<MusicAlbum> &newAlbums);
 
     void trackAdded(qulonglong id);
 
     void tracksAdded(const QList<MusicAudioTrack> &allTracks);
 
-    void artistRemoved(const MusicArtist &removedArtist);
+    void artistsRemoved(const QList<MusicArtist> &removedArtists);
 
-    void albumRemoved(const MusicAlbum &removedAlbum, qulonglong removedAlbumId);
+    void albumsRemoved(const QList<MusicAlbum> &removedAlbums);
 
     void trackRemoved(qulonglong id);
 
+    void tracksRemoved(const QList<qulonglong> &removedTracksIds);
+
     void artistModified(const MusicArtist &modifiedArtist);
 
-    void albumModified(const MusicAlbum &modifiedAlbum, qulonglong modifiedAlbumId);
+    void albumsModified(const QList<MusicAlbum> &modifiedAlbums);
 
     void trackModified(const MusicAudioTrack &modifiedTrack);
 
+    void albumsFromArtistFetched(const QString &artistName, const QList<MusicAlbum> &albums);
+
+    void tracksChangesComputed(const TracksModelDiff &changes);
+
+    void albumsChangesComputed(const AlbumsModelDiff &changes);
+
     void applicationIsTerminating();
 
     void importedTracksCountChanged();
@@ -121,6 +130,8 @@ public Q_SLOTS:
 
     void databaseReady();
 
+    void fetchAlbumsFromArtist(const QString &artistName);
+
     void applicationAboutToQuit();
 
     void showConfiguration();
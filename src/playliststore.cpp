@@ -0,0 +1,362 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "playliststore.h"
+#include "mediaplaylist.h"
+
+#include <QObject>
+#include <QThreadPool>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QRunnable>
+#include <QSaveFile>
+#include <QFile>
+#include <QDataStream>
+#include <QUrl>
+#include <QDebug>
+
+#include <algorithm>
+
+class PlayListStorePrivate
+{
+public:
+
+    enum EntryFlags : quint8 {
+        HasId = 0x1,
+        HasUrl = 0x2,
+        HasName = 0x4,
+        IsArtist = 0x8,
+    };
+
+    static const quint32 Magic = 0x454c504c;
+
+    static const quint32 Version = 1;
+
+    static bool write(const QString &fileName, const QList<MediaPlayListEntry> &entries, const QList<MusicAudioTrack> &tracks,
+                      int currentTrack, bool randomPlay, bool repeatPlay)
+    {
+        QSaveFile playListFile(fileName);
+
+        if (!playListFile.open(QIODevice::WriteOnly)) {
+            qDebug() << "PlayListStore::save" << fileName << playListFile.errorString();
+            return false;
+        }
+
+        QDataStream stream(&playListFile);
+        stream.setVersion(QDataStream::Qt_5_9);
+
+        stream << Magic << Version << qint32(currentTrack) << randomPlay << repeatPlay << quint32(entries.size());
+
+        for (int i = 0; i < entries.size(); ++i) {
+            const auto &oneEntry = entries[i];
+
+            if (oneEntry.mIsArtist) {
+                stream << quint8(IsArtist) << oneEntry.mArtist;
+                continue;
+            }
+
+            const auto oneTrack = (i < tracks.size() ? tracks[i] : MusicAudioTrack());
+            const auto trackIsKnown = oneEntry.mIsValid && oneTrack.isValid();
+            const auto id = (trackIsKnown ? oneTrack.databaseId() : oneEntry.mId);
+            const auto url = (trackIsKnown ? oneTrack.resourceURI() : oneEntry.mTrackUrl);
+
+            auto flags = quint8(0);
+            if (id != 0) {
+                flags |= HasId;
+            }
+            if (url.isValid()) {
+                flags |= HasUrl;
+            }
+            if (flags == 0) {
+                flags |= HasName;
+            }
+
+            stream << flags;
+
+            if (flags & HasId) {
+                stream << quint64(id);
+            }
+
+            if (flags & HasUrl) {
+                stream << url;
+            }
+
+            if (flags & HasName) {
+                if (trackIsKnown) {
+                    stream << oneTrack.title() << oneTrack.artist() << oneTrack.albumName()
+                           << qint32(oneTrack.trackNumber()) << qint32(oneTrack.discNumber());
+                } else {
+                    stream << oneEntry.mTitle << oneEntry.mArtist << oneEntry.mAlbum
+                           << qint32(oneEntry.mTrackNumber) << qint32(oneEntry.mDiscNumber);
+                }
+            }
+        }
+
+        if (stream.status() != QDataStream::Ok) {
+            qDebug() << "PlayListStore::save" << fileName << "write failed";
+            playListFile.cancelWriting();
+            return false;
+        }
+
+        return playListFile.commit();
+    }
+
+    static bool read(const QString &fileName, QVector<MediaPlayListEntry> &entries, int &currentTrack, bool &randomPlay, bool &repeatPlay)
+    {
+        if (fileName.isEmpty()) {
+            return false;
+        }
+
+        QFile playListFile(fileName);
+
+        if (!playListFile.open(QIODevice::ReadOnly)) {
+            return false;
+        }
+
+        QDataStream stream(&playListFile);
+        stream.setVersion(QDataStream::Qt_5_9);
+
+        auto magic = quint32(0);
+        auto version = quint32(0);
+        stream >> magic >> version;
+
+        if (magic != Magic || version != Version) {
+            qDebug() << "PlayListStore::load" << fileName << "unknown format";
+            return false;
+        }
+
+        auto storedCurrentTrack = qint32(0);
+        auto storedRandomPlay = false;
+        auto storedRepeatPlay = false;
+        auto entriesCount = quint32(0);
+        stream >> storedCurrentTrack >> storedRandomPlay >> storedRepeatPlay >> entriesCount;
+
+        auto restoredEntries = QVector<MediaPlayListEntry>();
+        restoredEntries.reserve(static_cast<int>(std::min<qint64>(entriesCount, playListFile.size())));
+
+        for (auto i = quint32(0); i < entriesCount && stream.status() == QDataStream::Ok; ++i) {
+            auto flags = quint8(0);
+            stream >> flags;
+
+            if (flags & IsArtist) {
+                auto artist = QString();
+                stream >> artist;
+                restoredEntries.push_back(MediaPlayListEntry(artist));
+                continue;
+            }
+
+            auto id = quint64(0);
+            auto url = QUrl();
+
+            if (flags & HasId) {
+                stream >> id;
+            }
+
+            if (flags & HasUrl) {
+                stream >> url;
+            }
+
+            if (flags & HasName) {
+                auto title = QString();
+                auto artist = QString();
+                auto album = QString();
+                auto trackNumber = qint32(-1);
+                auto discNumber = qint32(-1);
+                stream >> title >> artist >> album >> trackNumber >> discNumber;
+                restoredEntries.push_back({title, artist, album, trackNumber, discNumber});
+            } else if (url.isValid()) {
+                auto restoredEntry = MediaPlayListEntry(url);
+                restoredEntry.mId = id;
+                restoredEntries.push_back(restoredEntry);
+            } else {
+                restoredEntries.push_back(MediaPlayListEntry(qulonglong(id)));
+            }
+        }
+
+        if (stream.status() != QDataStream::Ok) {
+            qDebug() << "PlayListStore::load" << fileName << "truncated file";
+            return false;
+        }
+
+        entries = restoredEntries;
+        currentTrack = storedCurrentTrack;
+        randomPlay = storedRandomPlay;
+        repeatPlay = storedRepeatPlay;
+
+        return true;
+    }
+
+    QString mFileName;
+
+    QThreadPool mSaveThreadPool;
+
+    QMutex mLoadedMutex;
+
+    QString mLoadedFileName;
+
+    QVector<MediaPlayListEntry> mLoadedEntries;
+
+    int mLoadedCurrentTrack = 0;
+
+    bool mLoadedRandomPlay = false;
+
+    bool mLoadedRepeatPlay = false;
+
+};
+
+class PlayListStoreJob : public QRunnable
+{
+public:
+
+    PlayListStoreJob(QString fileName, QList<MediaPlayListEntry> entries, QList<MusicAudioTrack> tracks,
+                     int currentTrack, bool randomPlay, bool repeatPlay)
+        : mFileName(std::move(fileName)), mEntries(std::move(entries)), mTracks(std::move(tracks)),
+          mCurrentTrack(currentTrack), mRandomPlay(randomPlay), mRepeatPlay(repeatPlay)
+    {
+    }
+
+    void run() override
+    {
+        PlayListStorePrivate::write(mFileName, mEntries, mTracks, mCurrentTrack, mRandomPlay, mRepeatPlay);
+    }
+
+private:
+
+    QString mFileName;
+
+    QList<MediaPlayListEntry> mEntries;
+
+    QList<MusicAudioTrack> mTracks;
+
+    int mCurrentTrack;
+
+    bool mRandomPlay;
+
+    bool mRepeatPlay;
+
+};
+
+class PlayListStoreLoadJob : public QRunnable
+{
+public:
+
+    PlayListStoreLoadJob(PlayListStorePrivate &store, QString fileName, QObject *receiver, const char *member)
+        : mStore(store), mFileName(std::move(fileName)), mReceiver(receiver), mMember(member)
+    {
+    }
+
+    void run() override
+    {
+        auto entries = QVector<MediaPlayListEntry>();
+        auto currentTrack = 0;
+        auto randomPlay = false;
+        auto repeatPlay = false;
+
+        if (!PlayListStorePrivate::read(mFileName, entries, currentTrack, randomPlay, repeatPlay)) {
+            return;
+        }
+
+        {
+            QMutexLocker locker(&mStore.mLoadedMutex);
+
+            mStore.mLoadedFileName = mFileName;
+            mStore.mLoadedEntries = entries;
+            mStore.mLoadedCurrentTrack = currentTrack;
+            mStore.mLoadedRandomPlay = randomPlay;
+            mStore.mLoadedRepeatPlay = repeatPlay;
+        }
+
+        QMetaObject::invokeMethod(mReceiver, mMember.constData(), Qt::QueuedConnection);
+    }
+
+private:
+
+    PlayListStorePrivate &mStore;
+
+    QString mFileName;
+
+    QObject *mReceiver;
+
+    QByteArray mMember;
+
+};
+
+PlayListStore::PlayListStore() : d(std::make_unique<PlayListStorePrivate>())
+{
+    d->mSaveThreadPool.setMaxThreadCount(1);
+}
+
+PlayListStore::~PlayListStore()
+{
+    d->mSaveThreadPool.waitForDone();
+}
+
+QString PlayListStore::fileName() const
+{
+    return d->mFileName;
+}
+
+void PlayListStore::setFileName(const QString &fileName)
+{
+    d->mSaveThreadPool.waitForDone();
+    d->mFileName = fileName;
+}
+
+void PlayListStore::load(QObject *receiver, const char *member)
+{
+    if (d->mFileName.isEmpty()) {
+        return;
+    }
+
+    d->mSaveThreadPool.start(new PlayListStoreLoadJob(*d, d->mFileName, receiver, member));
+}
+
+bool PlayListStore::takeLoaded(QVector<MediaPlayListEntry> &entries, int &currentTrack, bool &randomPlay, bool &repeatPlay)
+{
+    QMutexLocker locker(&d->mLoadedMutex);
+
+    if (d->mLoadedFileName.isEmpty() || d->mLoadedFileName != d->mFileName) {
+        return false;
+    }
+
+    entries = std::move(d->mLoadedEntries);
+    currentTrack = d->mLoadedCurrentTrack;
+    randomPlay = d->mLoadedRandomPlay;
+    repeatPlay = d->mLoadedRepeatPlay;
+
+    d->mLoadedFileName.clear();
+    d->mLoadedEntries.clear();
+
+    return true;
+}
+
+void PlayListStore::save(const QList<MediaPlayListEntry> &entries, const QList<MusicAudioTrack> &tracks,
+                         int currentTrack, bool randomPlay, bool repeatPlay)
+{
+    if (d->mFileName.isEmpty()) {
+        return;
+    }
+
+    d->mSaveThreadPool.start(new PlayListStoreJob(d->mFileName, entries, tracks, currentTrack, randomPlay, repeatPlay));
+}
+
+void PlayListStore::waitForDone()
+{
+    d->mSaveThreadPool.waitForDone();
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef PLAYLISTSTORE_H
+#define PLAYLISTSTORE_H
+
+#include "musicaudiotrack.h"
+
+#include <QList>
+#include <QString>
+#include <QVector>
+
+#include <memory>
+
+class PlayListStorePrivate;
+class QObject;
+class MediaPlayListEntry;
+
+/**
+ * Compact binary copy of the play list kept in a dedicated file.
+ *
+ * Each entry is stored by database id and track url, the names being only
+ * kept for entries that have neither. Saving takes implicitly shared copies
+ * of the play list and writes them from a background thread, the file being
+ * replaced atomically so that a crash never leaves a truncated play list.
+ * Loading runs on the same thread, after any pending save, then invokes the
+ * given slot of the receiver with a queued call so that it can take the
+ * decoded play list.
+ */
+class PlayListStore
+{
+
+public:
+
+    PlayListStore();
+
+    ~PlayListStore();
+
+    QString fileName() const;
+
+    void setFileName(const QString &fileName);
+
+    void load(QObject *receiver, const char *member);
+
+    bool takeLoaded(QVector<MediaPlayListEntry> &entries, int &currentTrack, bool &randomPlay, bool &repeatPlay);
+
+    void save(const QList<MediaPlayListEntry> &entries, const QList<MusicAudioTrack> &tracks,
+              int currentTrack, bool randomPlay, bool repeatPlay);
+
+    void waitForDone();
+
+private:
+
+    std::unique_ptr<PlayListStorePrivate> d;
+
+};
+
+#endif // PLAYLISTSTORE_H
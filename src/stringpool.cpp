@@ -0,0 +1,87 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#include "stringpool.h"
+
+#include <QMutex>
+#include <QMutexLocker>
+#include <QSet>
+
+namespace {
+
+class StringPoolData
+{
+public:
+
+    QMutex mMutex;
+
+    QSet<QString> mStrings;
+
+};
+
+}
+
+Q_GLOBAL_STATIC(StringPoolData, stringPoolData)
+
+QString StringPool::intern(const QString &value)
+{
+    if (value.isEmpty()) {
+        return value;
+    }
+
+    auto pool = stringPoolData();
+
+    QMutexLocker locker(&pool->mMutex);
+
+    auto itString = pool->mStrings.constFind(value);
+    if (itString != pool->mStrings.constEnd()) {
+        return *itString;
+    }
+
+    return *pool->mStrings.insert(value);
+}
+
+int StringPool::size()
+{
+    auto pool = stringPoolData();
+
+    QMutexLocker locker(&pool->mMutex);
+
+    return pool->mStrings.size();
+}
+
+int StringPool::purge()
+{
+    auto pool = stringPoolData();
+
+    QMutexLocker locker(&pool->mMutex);
+
+    auto removedCount = 0;
+
+    for (auto itString = pool->mStrings.begin(); itString != pool->mStrings.end(); ) {
+        if (itString->isDetached()) {
+            itString = pool->mStrings.erase(itString);
+            ++removedCount;
+        } else {
+            ++itString;
+        }
+    }
+
+    return removedCount;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2017 Matthieu Gallien <matthieu_gallien@yahoo.fr>
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Library General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Library General Public License for more details.
+ *
+ * You should have received a copy of the GNU Library General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+#ifndef STRINGPOOL_H
+#define STRINGPOOL_H
+
+#include <QString>
+
+namespace StringPool {
+
+/**
+ * Returns a string sharing its data with every other interned string of the same value.
+ */
+QString intern(const QString &value);
+
+int size();
+
+/**
+ * Drops the interned strings that are no longer referenced outside of the pool.
+ */
+int purge();
+
+}
+
+#endif // STRINGPOOL_H
@@ -21,12 +21,20 @@
 
 #include "databaseinterface.h"
 #include "elisautils.h"
+#include "audiotagreader.h"
+#include "stringpool.h"
 
 #include <KFileMetaData/ExtractorCollection>
 
 #include <QMimeDatabase>
+#include <QThreadPool>
+#include <QThreadStorage>
+#include <QRunnable>
+#include <QFileInfo>
+#include <QDirIterator>
 #include <QSet>
 #include <QList>
+#include <QVector>
 #include <QDebug>
 
 #include <array>
@@ -46,8 +54,61 @@ public:
 
     KFileMetaData::ExtractorCollection mExtractors;
 
+    AudioTagReader mTagReader;
+
     QMimeDatabase mMimeDb;
 
+    QThreadPool mScanThreadPool;
+
+};
+
+class ScanFilesResources
+{
+public:
+
+    QMimeDatabase mMimeDatabase;
+
+    KFileMetaData::ExtractorCollection mExtractors;
+
+    AudioTagReader mTagReader;
+
+};
+
+// one set per scan thread: the extractor plugins are not shared between threads
+static QThreadStorage<ScanFilesResources*> scanFilesResources;
+
+class ScanFilesJob : public QRunnable
+{
+public:
+
+    ScanFilesJob(const QVector<QUrl> &scanFiles, QVector<MusicAudioTrack> &tracks, int first, int last)
+        : mScanFiles(scanFiles), mTracks(tracks), mFirst(first), mLast(last)
+    {
+    }
+
+    void run() override
+    {
+        if (!scanFilesResources.hasLocalData()) {
+            scanFilesResources.setLocalData(new ScanFilesResources);
+        }
+
+        auto &resources = *scanFilesResources.localData();
+
+        for (int i = mFirst; i < mLast; ++i) {
+            mTracks[i] = ElisaUtils::scanOneFile(mScanFiles[i], resources.mMimeDatabase, resources.mExtractors, resources.mTagReader);
+        }
+    }
+
+private:
+
+    const QVector<QUrl> &mScanFiles;
+
+    QVector<MusicAudioTrack> &mTracks;
+
+    int mFirst;
+
+    int mLast;
+
 };
 
 TracksListener::TracksListener(DatabaseInterface *database, QObject *parent) : QObject(parent), d(std::make_unique<TracksListenerPrivate>())
@@ -121,7 +182,8 @@ void TracksListener::trackByNameInList(const QString &title, const QString &arti
 {
     auto newTrackId = d->mDatabase->trackIdFromTitleAlbumTrackDiscNumber(title, artist, album, trackNumber, discNumber);
     if (newTrackId == 0) {
-        auto newTrack = std::tuple<QString, QString, QString, int, int>(title, artist, album, trackNumber, discNumber);
+        auto newTrack = std::tuple<QString, QString, QString, int, int>(title, StringPool::intern(artist),
+                                                                        StringPool::intern(album), trackNumber, discNumber);
         d->mTracksByNameSet.push_back(newTrack);
 
         return;
@@ -136,18 +198,34 @@ void TracksListener::trackByNameInList(const QString &title, const QString &arti
     }
 }
 
+void TracksListener::tracksByNameInList(const QList<MusicAudioTrack> &tracks)
+{
+    const auto &allTracks = d->mDatabase->tracksFromTitleAlbumTrackDiscNumbers(tracks);
+
+    for (int i = 0; i < allTracks.size(); ++i) {
+        const auto &oneTrack = allTracks[i];
+
+        if (!oneTrack.isValid()) {
+            const auto &pendingTrack = tracks[i];
+            d->mTracksByNameSet.push_back(std::tuple<QString, QString, QString, int, int>(pendingTrack.title(), StringPool::intern(pendingTrack.artist()),
+                                                                                          StringPool::intern(pendingTrack.albumName()),
+                                                                                          pendingTrack.trackNumber(), pendingTrack.discNumber()));
+            continue;
+        }
+
+        d->mTracksByIdSet.insert(oneTrack.databaseId());
+
+        Q_EMIT trackHasChanged(oneTrack);
+    }
+}
+
 void TracksListener::trackByFileNameInList(const QUrl &fileName)
 {
-    qDebug() << "TracksListener::trackByFileNameInList" << fileName;
     auto newTrackId = d->mDatabase->trackIdFromFileName(fileName);
-    qDebug() << "TracksListener::trackByFileNameInList" << fileName << newTrackId;
     if (newTrackId == 0) {
         auto newTrack = scanOneFile(fileName);
 
-        qDebug() << "TracksListener::trackByFileNameInList" << fileName << newTrack;
-
         if (newTrack.isValid()) {
-            qDebug() << "TracksListener::trackByFileNameInList" << "trackHasChanged" << newTrack;
             Q_EMIT trackHasChanged(newTrack);
 
             return;
@@ -162,14 +240,76 @@ void TracksListener::trackByFileNameInList(const QUrl &fileName)
 
     auto newTrack = d->mDatabase->trackFromDatabaseId(newTrackId);
 
-    qDebug() << "TracksListener::trackByFileNameInList" << newTrackId << newTrack;
-
     if (newTrack.isValid()) {
-        qDebug() << "TracksListener::trackByFileNameInList" << "trackHasChanged" << newTrack;
         Q_EMIT trackHasChanged(newTrack);
     }
 }
 
+void TracksListener::tracksByFileNameInList(const QList<QUrl> &fileNames)
+{
+    const auto &allTracks = resolveFileNames(fileNames);
+
+    for (int i = 0; i < fileNames.size(); ++i) {
+        const auto &oneTrack = allTracks[i];
+
+        if (!oneTrack.isValid()) {
+            d->mTracksByFileNameSet.push_back(fileNames[i]);
+            continue;
+        }
+
+        if (oneTrack.databaseId() != 0) {
+            d->mTracksByIdSet.insert(oneTrack.databaseId());
+        }
+
+        Q_EMIT trackHasChanged(oneTrack);
+    }
+}
+
+QVector<MusicAudioTrack> TracksListener::resolveFileNames(const QList<QUrl> &fileNames)
+{
+    auto result = QVector<MusicAudioTrack>(fileNames.size());
+
+    const auto &knownTracks = d->mDatabase->tracksFromFileNames(fileNames);
+
+    auto unknownFiles = QVector<QUrl>();
+    auto unknownFilesPosition = QVector<int>();
+
+    for (int i = 0; i < fileNames.size(); ++i) {
+        const auto itTrack = knownTracks.constFind(fileNames[i]);
+
+        if (itTrack != knownTracks.constEnd()) {
+            result[i] = *itTrack;
+            continue;
+        }
+
+        if (fileNames[i].isLocalFile()) {
+            unknownFiles.push_back(fileNames[i]);
+            unknownFilesPosition.push_back(i);
+        }
+    }
+
+    if (unknownFiles.isEmpty()) {
+        return result;
+    }
+
+    auto scannedTracks = QVector<MusicAudioTrack>(unknownFiles.size());
+
+    const auto jobsCount = std::max(1, std::min(d->mScanThreadPool.maxThreadCount(), unknownFiles.size()));
+    const auto filesPerJob = (unknownFiles.size() + jobsCount - 1) / jobsCount;
+
+    for (int first = 0; first < unknownFiles.size(); first += filesPerJob) {
+        d->mScanThreadPool.start(new ScanFilesJob(unknownFiles, scannedTracks, first, std::min(first + filesPerJob, unknownFiles.size())));
+    }
+
+    d->mScanThreadPool.waitForDone();
+
+    for (int i = 0; i < unknownFiles.size(); ++i) {
+        result[unknownFilesPosition[i]] = scannedTracks[i];
+    }
+
+    return result;
+}
+
 void TracksListener::trackByIdInList(qulonglong newTrackId)
 {
     d->mTracksByIdSet.insert(newTrackId);
@@ -180,6 +320,74 @@ void TracksListener::trackByIdInList(qulonglong newTrackId)
     }
 }
 
+void TracksListener::tracksByIdInList(const QList<qulonglong> &newTrackIds)
+{
+    for (auto oneTrackId : newTrackIds) {
+        d->mTracksByIdSet.insert(oneTrackId);
+    }
+
+    const auto &allTracks = d->mDatabase->tracksFromDatabaseIds(newTrackIds);
+
+    for (const auto &oneTrack : allTracks) {
+        if (oneTrack.isValid()) {
+            Q_EMIT trackHasChanged(oneTrack);
+        }
+    }
+}
+
+void TracksListener::tracksByIdOrFileNameInList(const QList<qulonglong> &trackIds, const QList<QUrl> &fileNames)
+{
+    const auto &allTracks = d->mDatabase->tracksFromDatabaseIds(trackIds);
+
+    auto unknownFileNames = QList<QUrl>();
+
+    for (int i = 0; i < fileNames.size(); ++i) {
+        if (i >= allTracks.size() || !allTracks[i].isValid() || allTracks[i].resourceURI() != fileNames[i]) {
+            unknownFileNames.push_back(fileNames[i]);
+            continue;
+        }
+
+        d->mTracksByIdSet.insert(allTracks[i].databaseId());
+
+        Q_EMIT trackHasChanged(allTracks[i]);
+    }
+
+    if (!unknownFileNames.isEmpty()) {
+        tracksByFileNameInList(unknownFileNames);
+    }
+}
+
+void TracksListener::expandFileNamesInList(const QStringList &fileNames)
+{
+    auto result = QList<QUrl>();
+
+    for (const auto &oneFileName : fileNames) {
+        if (!QFileInfo(oneFileName).isDir()) {
+            result.push_back(QUrl::fromLocalFile(oneFileName));
+            continue;
+        }
+
+        auto directoryFiles = QStringList();
+
+        QDirIterator itFile(oneFileName, QDir::Files | QDir::Readable, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
+        while (itFile.hasNext()) {
+            const auto &oneFile = itFile.next();
+
+            if (d->mMimeDb.mimeTypeForFile(oneFile, QMimeDatabase::MatchExtension).name().startsWith(QStringLiteral("audio/"))) {
+                directoryFiles.push_back(oneFile);
+            }
+        }
+
+        std::sort(directoryFiles.begin(), directoryFiles.end());
+
+        for (const auto &oneFile : directoryFiles) {
+            result.push_back(QUrl::fromLocalFile(oneFile));
+        }
+    }
+
+    Q_EMIT fileNamesExpanded(result);
+}
+
 void TracksListener::newArtistInList(const QString &artist)
 {
     auto newTracks = d->mDatabase->tracksFromAuthor(artist);
@@ -196,7 +404,7 @@ void TracksListener::newArtistInList(const QString &artist)
 
 MusicAudioTrack TracksListener::scanOneFile(const QUrl &scanFile)
 {
-    return ElisaUtils::scanOneFile(scanFile, d->mMimeDb, d->mExtractors);
+    return ElisaUtils::scanOneFile(scanFile, d->mMimeDb, d->mExtractors, d->mTagReader);
 }
 
 
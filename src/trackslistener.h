@@ -21,6 +21,10 @@
 #define TRACKSLISTENER_H
 
 #include <QObject>
+#include <QList>
+#include <QVector>
+#include <QUrl>
+#include <QStringList>
 
 #include "musicaudiotrack.h"
 
@@ -39,6 +43,8 @@ public:
 
     ~TracksListener() override;
 
+    QVector<MusicAudioTrack> resolveFileNames(const QList<QUrl> &fileNames);
+
 Q_SIGNALS:
 
     void trackHasChanged(const MusicAudioTrack &audioTrack);
@@ -47,6 +53,8 @@ Q_SIGNALS:
 
     void albumAdded(const QList<MusicAudioTrack> &tracks);
 
+    void fileNamesExpanded(const QList<QUrl> &fileNames);
+
 public Q_SLOTS:
 
     void tracksAdded(const QList<MusicAudioTrack> &allTracks);
@@ -57,12 +65,22 @@ public Q_SLOTS:
 
     void trackByNameInList(const QString &title, const QString &artist, const QString &album, int trackNumber, int discNumber);
 
+    void tracksByNameInList(const QList<MusicAudioTrack> &tracks);
+
     void trackByFileNameInList(const QUrl &fileName);
 
+    void tracksByFileNameInList(const QList<QUrl> &fileNames);
+
     void trackByIdInList(qulonglong newTrackId);
 
+    void tracksByIdInList(const QList<qulonglong> &newTrackIds);
+
+    void tracksByIdOrFileNameInList(const QList<qulonglong> &trackIds, const QList<QUrl> &fileNames);
+
     void newArtistInList(const QString &artist);
 
+    void expandFileNamesInList(const QStringList &fileNames);
+
 private:
 
     MusicAudioTrack scanOneFile(const QUrl &scanFile);
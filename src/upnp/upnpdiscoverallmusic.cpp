@@ -208,9 +208,16 @@ void UpnpDiscoverAllMusic::contentChanged(const QString &uuid, const QString &pa
             return;
         }
 
-        const auto &allNewTracks = currentDidlParser->newMusicTracks();
+        const auto &covers = currentDidlParser->covers();
+        auto allNewTracks = currentDidlParser->newMusicTracks();
 
-        d->mAlbumDatabase->insertTracksList(allNewTracks, currentDidlParser->covers(), QStringLiteral("upnp"));
+        for (auto &oneTrack : allNewTracks) {
+            if (oneTrack.albumCover().isEmpty()) {
+                oneTrack.setAlbumCover(covers.value(oneTrack.albumName()));
+            }
+        }
+
+        d->mAlbumDatabase->insertTracksList(allNewTracks, QStringLiteral("upnp"));
     }
 }
 
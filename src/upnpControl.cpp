@@ -44,14 +44,16 @@
 #include "manageaudioplayer.h"
 #include "musicstatistics.h"
 #include "allalbumsmodel.h"
+#include "artistalbumsmodel.h"
 #include "albummodel.h"
 #include "allartistsmodel.h"
 #include "musicaudiotrack.h"
 #include "musiclistenersmanager.h"
-#include "albumfilterproxymodel.h"
+#include "librarysortfilterproxymodel.h"
 #include "elisaapplication.h"
 #include "audiowrapper.h"
 #include "alltracksmodel.h"
+#include "modeldiff.h"
 #include "notificationitem.h"
 #include "topnotificationmanager.h"
 #include "elisa_settings.h"
@@ -74,7 +76,6 @@
 #include <KCrash>
 #endif
 
-#include <QSortFilterProxyModel>
 
 #include <QIcon>
 #include <QAction>
@@ -146,12 +147,12 @@ int main(int argc, char *argv[])
     qmlRegisterType<MusicStatistics>("org.kde.elisa", 1, 0, "MusicStatistics");
     qmlRegisterType<ProgressIndicator>("org.kde.elisa", 1, 0, "ProgressIndicator");
     qmlRegisterType<AllAlbumsModel>("org.kde.elisa", 1, 0, "AllAlbumsModel");
+    qmlRegisterType<ArtistAlbumsModel>("org.kde.elisa", 1, 0, "ArtistAlbumsModel");
     qmlRegisterType<AllArtistsModel>("org.kde.elisa", 1, 0, "AllArtistsModel");
     qmlRegisterType<AlbumModel>("org.kde.elisa", 1, 0, "AlbumModel");
     qmlRegisterType<AllTracksModel>("org.kde.elisa", 1, 0, "AllTracksModel");
     qmlRegisterType<MusicListenersManager>("org.kde.elisa", 1, 0, "MusicListenersManager");
-    qmlRegisterType<QSortFilterProxyModel>("org.kde.elisa", 1, 0, "SortFilterProxyModel");
-    qmlRegisterType<AlbumFilterProxyModel>("org.kde.elisa", 1, 0, "AlbumFilterProxyModel");
+    qmlRegisterType<LibrarySortFilterProxyModel>("org.kde.elisa", 1, 0, "LibrarySortFilterProxyModel");
     qmlRegisterType<AudioWrapper>("org.kde.elisa", 1, 0, "AudioWrapper");
     qmlRegisterType<TopNotificationManager>("org.kde.elisa", 1, 0, "TopNotificationManager");
 
@@ -162,12 +163,19 @@ int main(int argc, char *argv[])
 
     qRegisterMetaType<QAbstractItemModel*>();
     qRegisterMetaType<QHash<QString,QUrl>>("QHash<QString,QUrl>");
+    qRegisterMetaType<QHash<QUrl,QUrl>>("QHash<QUrl,QUrl>");
+    qRegisterMetaType<QHash<QUrl,QDateTime>>("QHash<QUrl,QDateTime>");
     qRegisterMetaType<QList<MusicAudioTrack>>("QList<MusicAudioTrack>");
     qRegisterMetaType<QList<MusicAudioTrack>>("QVector<MusicAudioTrack>");
     qRegisterMetaType<QVector<qulonglong>>("QVector<qulonglong>");
+    qRegisterMetaType<QList<qulonglong>>("QList<qulonglong>");
     qRegisterMetaType<QHash<qulonglong,int>>("QHash<qulonglong,int>");
     qRegisterMetaType<MusicAlbum>("MusicAlbum");
     qRegisterMetaType<MusicArtist>("MusicArtist");
+    qRegisterMetaType<QList<MusicAlbum>>("QList<MusicAlbum>");
+    qRegisterMetaType<QList<MusicArtist>>("QList<MusicArtist>");
+    qRegisterMetaType<TracksModelDiff>("TracksModelDiff");
+    qRegisterMetaType<AlbumsModelDiff>("AlbumsModelDiff");
     qRegisterMetaType<QMap<QString, int>>();
     qRegisterMetaType<QAction*>();
     qRegisterMetaType<NotificationItem>("NotificationItem");